@@ -0,0 +1,268 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static FILE* Log_p = NULL;
+
+// Atomic as the parallel and queue benchmarks allocate from several threads
+static atomic_size_t AllocationCount;
+
+
+/* > Local Function Declarations **********************************************/
+
+static int
+CompareSamples(const void* Sample1_p, const void* Sample2_p);
+
+static double
+Percentile(const uint64_t *const Sorted_p, size_t Count, unsigned int Percent);
+
+static void
+LogName(const char *const Name_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+uint64_t
+BENCH_Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+void
+BENCH_Report(const char *const Name_p, size_t Operations, uint64_t Nanoseconds)
+{
+  double nsPerOp = (Operations != 0) ? (double)Nanoseconds / Operations : 0.0;
+  double mopsPerSec = (Nanoseconds != 0) ? Operations * 1000.0 / Nanoseconds : 0.0;
+
+  printf("%-48s %12zu ops %10.2f ns/op %10.2f Mops/s\n",
+         Name_p, Operations, nsPerOp, mopsPerSec);
+
+  if (Log_p != NULL)
+  {
+    LogName(Name_p);
+    fprintf(Log_p, ",\"ops\":%zu,\"ns_per_op\":%.3f}\n", Operations, nsPerOp);
+  }
+}
+
+void
+BENCH_ReportSamples(const char *const Name_p,
+                    size_t OpsPerSample,
+                    const uint64_t *const Samples_p,
+                    size_t SampleCount,
+                    size_t Allocations)
+{
+  uint64_t* sorted_p = malloc(SampleCount * sizeof(uint64_t));
+  uint64_t total = 0;
+  for (size_t i = 0; i < SampleCount; i++)
+  {
+    sorted_p[i] = Samples_p[i];
+    total += Samples_p[i];
+  }
+  qsort(sorted_p, SampleCount, sizeof(uint64_t), CompareSamples);
+
+  size_t operations = OpsPerSample * SampleCount;
+  double nsPerOp = (double)total / operations;
+  double p50 = Percentile(sorted_p, SampleCount, 50) / OpsPerSample;
+  double p90 = Percentile(sorted_p, SampleCount, 90) / OpsPerSample;
+  double p99 = Percentile(sorted_p, SampleCount, 99) / OpsPerSample;
+  double allocsPerOp = (double)Allocations / operations;
+  free(sorted_p);
+
+  printf("%-48s %12zu ops %10.2f ns/op  p50 %10.2f  p90 %10.2f  p99 %10.2f",
+         Name_p, operations, nsPerOp, p50, p90, p99);
+  if (BENCH_CountsAllocations())
+  {
+    printf(" %8.3f allocs/op", allocsPerOp);
+  }
+  printf("\n");
+
+  if (Log_p != NULL)
+  {
+    LogName(Name_p);
+    fprintf(Log_p, ",\"ops\":%zu,\"ns_per_op\":%.3f,\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f",
+            operations, nsPerOp, p50, p90, p99);
+    if (BENCH_CountsAllocations())
+    {
+      fprintf(Log_p, ",\"allocs_per_op\":%.4f", allocsPerOp);
+    }
+    fprintf(Log_p, "}\n");
+  }
+}
+
+bool
+BENCH_OpenLog(const char *const Path_p)
+{
+  BENCH_CloseLog();
+  Log_p = fopen(Path_p, "w");
+  return (Log_p != NULL);
+}
+
+void
+BENCH_CloseLog(void)
+{
+  if (Log_p != NULL)
+  {
+    fclose(Log_p);
+    Log_p = NULL;
+  }
+}
+
+size_t
+BENCH_Allocations(void)
+{
+  return atomic_load_explicit(&AllocationCount, memory_order_relaxed);
+}
+
+bool
+BENCH_CountsAllocations(void)
+{
+#ifdef BENCH_COUNT_ALLOCS
+  return true;
+#else
+  return false;
+#endif
+}
+
+void
+BENCH_ZipfCreate(BENCH_Zipf_t *const Zipf_p, size_t Size, unsigned int Seed)
+{
+  double sum = 0.0;
+
+  Zipf_p->Cumulative_p = malloc(Size * sizeof(double));
+  Zipf_p->Size = Size;
+  Zipf_p->Seed = Seed;
+  for (size_t i = 0; i < Size; i++)
+  {
+    sum += 1.0 / (double)(i + 1);
+    Zipf_p->Cumulative_p[i] = sum;
+  }
+}
+
+void
+BENCH_ZipfDestroy(BENCH_Zipf_t *const Zipf_p)
+{
+  free(Zipf_p->Cumulative_p);
+  Zipf_p->Cumulative_p = NULL;
+}
+
+size_t
+BENCH_ZipfNext(BENCH_Zipf_t *const Zipf_p)
+{
+  double target = Zipf_p->Cumulative_p[Zipf_p->Size - 1] * rand_r(&Zipf_p->Seed) /
+                  ((double)RAND_MAX + 1.0);
+  size_t low = 0;
+  size_t high = Zipf_p->Size - 1;
+
+  // First rank whose cumulative weight exceeds the target
+  while (low < high)
+  {
+    size_t middle = low + (high - low) / 2;
+    if (Zipf_p->Cumulative_p[middle] <= target)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+#ifdef BENCH_COUNT_ALLOCS
+
+//
+// ALLOCATION COUNTING, calls are redirected here by the --wrap linker option
+//
+
+void* __real_malloc(size_t Size);
+void* __real_calloc(size_t Count, size_t Size);
+void* __real_realloc(void* Pointer_p, size_t Size);
+
+void* __wrap_malloc(size_t Size);
+void* __wrap_calloc(size_t Count, size_t Size);
+void* __wrap_realloc(void* Pointer_p, size_t Size);
+
+void*
+__wrap_malloc(size_t Size)
+{
+  atomic_fetch_add_explicit(&AllocationCount, 1, memory_order_relaxed);
+  return __real_malloc(Size);
+}
+
+void*
+__wrap_calloc(size_t Count, size_t Size)
+{
+  atomic_fetch_add_explicit(&AllocationCount, 1, memory_order_relaxed);
+  return __real_calloc(Count, Size);
+}
+
+void*
+__wrap_realloc(void* Pointer_p, size_t Size)
+{
+  atomic_fetch_add_explicit(&AllocationCount, 1, memory_order_relaxed);
+  return __real_realloc(Pointer_p, Size);
+}
+
+#endif // BENCH_COUNT_ALLOCS
+
+
+/* > Local Function Definitions ***********************************************/
+
+static int
+CompareSamples(const void* Sample1_p, const void* Sample2_p)
+{
+  uint64_t sample1 = *(const uint64_t*)Sample1_p;
+  uint64_t sample2 = *(const uint64_t*)Sample2_p;
+  return (sample1 > sample2) - (sample1 < sample2);
+}
+
+// Nearest rank percentile of Count sorted samples
+static double
+Percentile(const uint64_t *const Sorted_p, size_t Count, unsigned int Percent)
+{
+  size_t rank = (Count * Percent + 99) / 100;
+  return (double)Sorted_p[(rank > 0) ? rank - 1 : 0];
+}
+
+// Starts a JSON object in the log with the name of the benchmark, escaping
+// quotes and backslashes; names hold no control characters
+static void
+LogName(const char *const Name_p)
+{
+  fputs("{\"name\":\"", Log_p);
+  for (const char* char_p = Name_p; *char_p != '\0'; char_p++)
+  {
+    if (*char_p == '"' || *char_p == '\\')
+    {
+      fputc('\\', Log_p);
+    }
+    fputc(*char_p, Log_p);
+  }
+  fputc('"', Log_p);
+}
@@ -0,0 +1,189 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+ * Benchmark Helpers
+ *
+ * Every result is printed as a line of text and, once BENCH_OpenLog() has
+ * been called, also appended to the log as one JSON object per line, for
+ * scripts that compare runs.
+ *
+ * Allocations are counted when bench.c is compiled with BENCH_COUNT_ALLOCS
+ * and the executable is linked with -Wl,--wrap=malloc,--wrap=calloc,
+ * --wrap=realloc (GNU ld), as the Makefile does. Only calls from the linked
+ * objects are seen, not those inside the C or C++ runtime.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Zipf Distribution over the ranks 0 .. Size-1, rank r drawn with a
+// probability proportional to 1/(r+1)
+//
+
+typedef struct BENCH_Zipf
+{
+  double*      Cumulative_p;
+  size_t       Size;
+  unsigned int Seed;
+} BENCH_Zipf_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return        Current time in nanoseconds
+ *
+ ******************************************************************************/
+uint64_t
+BENCH_Now(void);
+
+
+/**
+ * @brief Reports the result of a benchmark
+ *
+ * Prints one line with the name of the benchmark, the number of operations,
+ * the cost per operation and the throughput.
+ *
+ * @param[in]     Name_p       Name of the benchmark
+ * @param[in]     Operations   Number of operations performed
+ * @param[in]     Nanoseconds  Total time spent on the operations
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+BENCH_Report(const char *const Name_p, size_t Operations, uint64_t Nanoseconds);
+
+
+/**
+ * @brief Reports the result of a sampled benchmark
+ *
+ * Prints one line with the name of the benchmark, the number of operations,
+ * the mean cost per operation, the 50th, 90th and 99th percentile of the
+ * cost per operation over the samples, and the allocations per operation,
+ * if they are counted. Every sample timed OpsPerSample operations.
+ *
+ * @param[in]     Name_p        Name of the benchmark
+ * @param[in]     OpsPerSample  Number of operations in every sample
+ * @param[in]     Samples_p     Nanoseconds spent on every sample
+ * @param[in]     SampleCount   Number of samples, at least 1
+ * @param[in]     Allocations   Allocations made during all samples
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+BENCH_ReportSamples(const char *const Name_p,
+                    size_t OpsPerSample,
+                    const uint64_t *const Samples_p,
+                    size_t SampleCount,
+                    size_t Allocations);
+
+
+/**
+ * @brief Opens the machine-readable log
+ *
+ * Truncates the file at Path_p and appends one JSON object per reported
+ * result to it from then on.
+ *
+ * @param[in]     Path_p  Path of the log file
+ * @return        true on success, false if the file cannot be opened
+ *
+ ******************************************************************************/
+bool
+BENCH_OpenLog(const char *const Path_p);
+
+
+/**
+ * @brief Closes the machine-readable log
+ *
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+BENCH_CloseLog(void);
+
+
+/**
+ * @brief Returns the number of allocations made so far
+ *
+ * Counts the calls of malloc(), calloc() and realloc() since the start of
+ * the program. Always 0 when allocations are not counted, see
+ * BENCH_CountsAllocations().
+ *
+ * @return        Number of allocations
+ *
+ ******************************************************************************/
+size_t
+BENCH_Allocations(void);
+
+
+/**
+ * @brief Checks if allocations are counted
+ *
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+BENCH_CountsAllocations(void);
+
+
+/**
+ * @brief Creates a Zipf distribution
+ *
+ * @param[in]     Zipf_p  The distribution to be initialized.
+ * @param[in]     Size    Number of ranks, at least 1
+ * @param[in]     Seed    Seed of the random numbers
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+BENCH_ZipfCreate(BENCH_Zipf_t *const Zipf_p, size_t Size, unsigned int Seed);
+
+
+/**
+ * @brief Destroys a Zipf distribution
+ *
+ * @param[in]     Zipf_p  The distribution to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+BENCH_ZipfDestroy(BENCH_Zipf_t *const Zipf_p);
+
+
+/**
+ * @brief Draws a rank from a Zipf distribution
+ *
+ * Takes O(log Size).
+ *
+ * @param[in]     Zipf_p  Pointer to the distribution
+ * @return        A rank from 0 to Size-1, 0 being the most frequent
+ *
+ ******************************************************************************/
+size_t
+BENCH_ZipfNext(BENCH_Zipf_t *const Zipf_p);
+
+
+#endif // BENCH_H
@@ -0,0 +1,94 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "slist_bench.h"
+#include "slist_ops_bench.h"
+#include "ulist_bench.h"
+#include "dlist_bench.h"
+#include "queue_bench.h"
+#include "lazylist_bench.h"
+#include "slist_typed_bench.h"
+#include "slist_hpp_bench.h"
+#include "slist_parallel_bench.h"
+#include "skiplist_bench.h"
+#include "idxlist_bench.h"
+#include "slist_snapshot_bench.h"
+#include "plist_bench.h"
+
+typedef struct Suite
+{
+  const char* Name_p;
+  void (*Run_fp)(void);
+} Suite_t;
+
+static const Suite_t Suites[] =
+{
+  { "slist", Run_SLIST_Benchmarks },
+  { "slist_ops", Run_SLIST_OPS_Benchmarks },
+  { "ulist", Run_ULIST_Benchmarks },
+  { "dlist", Run_DLIST_Benchmarks },
+  { "queue", Run_QUEUE_Benchmarks },
+  { "lazylist", Run_LAZYLIST_Benchmarks },
+  { "slist_typed", Run_SLIST_TYPED_Benchmarks },
+  { "slist_hpp", Run_SLIST_HPP_Benchmarks },
+  { "slist_parallel", Run_SLIST_PARALLEL_Benchmarks },
+  { "skiplist", Run_SKIPLIST_Benchmarks },
+  { "idxlist", Run_IDXLIST_Benchmarks },
+  { "slist_snapshot", Run_SLIST_SNAPSHOT_Benchmarks },
+  { "plist", Run_PLIST_Benchmarks },
+};
+
+#define SUITE_COUNT  (sizeof(Suites) / sizeof(Suites[0]))
+
+// Usage: bench [--json FILE] [SUITE...]
+// Runs the named suites, or all of them, and appends every result to FILE as
+// one JSON object per line.
+int
+main(int argc, char* argv[])
+{
+  bool Selected[SUITE_COUNT] = { false };
+  bool AnySelected = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+    {
+      if (!BENCH_OpenLog(argv[++i]))
+      {
+        fprintf(stderr, "Cannot open %s\n", argv[i]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    size_t s = 0;
+    while (s < SUITE_COUNT && strcmp(argv[i], Suites[s].Name_p) != 0)
+    {
+      s++;
+    }
+    if (s == SUITE_COUNT)
+    {
+      fprintf(stderr, "Usage: %s [--json FILE] [SUITE...]\nSuites:", argv[0]);
+      for (s = 0; s < SUITE_COUNT; s++)
+      {
+        fprintf(stderr, " %s", Suites[s].Name_p);
+      }
+      fprintf(stderr, "\n");
+      return EXIT_FAILURE;
+    }
+    Selected[s] = true;
+    AnySelected = true;
+  }
+
+  for (size_t s = 0; s < SUITE_COUNT; s++)
+  {
+    if (!AnySelected || Selected[s])
+    {
+      Suites[s].Run_fp();
+    }
+  }
+  BENCH_CloseLog();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,234 @@
+/* > Includes *****************************************************************/
+#include "dlist.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void*
+UnlinkNode(DLIST_List_t *const List_p, DLIST_Node_t *const Node_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+DLIST_Create(DLIST_List_t *const List_p)
+{
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+  List_p->Length = 0;
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+DLIST_Destroy(DLIST_List_t *const List_p)
+{
+  DLIST_Node_t* node_p = List_p->Head_p;
+  while (node_p != NULL)
+  {
+    DLIST_Node_t* next_p = node_p->Next_p;
+    if (List_p->Callbacks.DataDestroy_fp != NULL)
+    {
+      List_p->Callbacks.DataDestroy_fp(node_p->Data_p);
+    }
+    free(node_p);
+    node_p = next_p;
+  }
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+  List_p->Length = 0;
+}
+
+bool
+DLIST_IsEmpty(const DLIST_List_t *const List_p)
+{
+  return (List_p->Head_p == NULL);
+}
+
+size_t
+DLIST_Length(const DLIST_List_t *const List_p)
+{
+  return List_p->Length;
+}
+
+void
+DLIST_InsertFirst(DLIST_List_t *const List_p, const void *const Data_p)
+{
+  DLIST_Node_t* newNode = malloc(sizeof(DLIST_Node_t));
+  newNode->Data_p = (void*)Data_p;
+  newNode->Prev_p = NULL;
+  newNode->Next_p = List_p->Head_p;
+
+  if (List_p->Head_p == NULL)
+  {
+    List_p->Tail_p = newNode;
+  }
+  else
+  {
+    List_p->Head_p->Prev_p = newNode;
+  }
+  List_p->Head_p = newNode;
+  List_p->Length++;
+}
+
+void
+DLIST_InsertLast(DLIST_List_t *const List_p, const void *const Data_p)
+{
+  DLIST_Node_t* newNode = malloc(sizeof(DLIST_Node_t));
+  newNode->Data_p = (void*)Data_p;
+  newNode->Next_p = NULL;
+  newNode->Prev_p = List_p->Tail_p;
+
+  if (List_p->Tail_p == NULL)
+  {
+    List_p->Head_p = newNode;
+  }
+  else
+  {
+    List_p->Tail_p->Next_p = newNode;
+  }
+  List_p->Tail_p = newNode;
+  List_p->Length++;
+}
+
+void*
+DLIST_RemoveFirst(DLIST_List_t *const List_p)
+{
+  return UnlinkNode(List_p, List_p->Head_p);
+}
+
+void*
+DLIST_RemoveLast(DLIST_List_t *const List_p)
+{
+  return UnlinkNode(List_p, List_p->Tail_p);
+}
+
+void*
+DLIST_RemoveSpecific(DLIST_List_t *const List_p, const void* const SearchData_p)
+{
+  DLIST_Node_t* node_p = List_p->Head_p;
+
+  while (node_p != NULL &&
+         List_p->Callbacks.DataCompare_fp(node_p->Data_p, SearchData_p) != 0)
+  {
+    node_p = node_p->Next_p;
+  }
+
+  if (node_p == NULL)
+  {
+    return NULL;
+  }
+  return UnlinkNode(List_p, node_p);
+}
+
+void
+DLIST_Print(const DLIST_List_t *const List_p)
+{
+  const DLIST_Node_t* print_p = List_p->Head_p;
+  while (print_p != NULL)
+  {
+    List_p->Callbacks.DataPrint_fp(print_p->Data_p);
+    print_p = print_p->Next_p;
+  }
+}
+
+void
+DLIST_SetDestroyFunction(DLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+DLIST_SetPrintFunction(DLIST_List_t *const List_p, DataPrint_t DataPrint_fp)
+{
+  List_p->Callbacks.DataPrint_fp = DataPrint_fp;
+}
+
+void
+DLIST_SetCompareFunction(DLIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+//
+// ITERATOR
+//
+
+void
+DLIST_IteratorInit(DLIST_Iterator_t *const Iterator_p,
+                   const DLIST_List_t *const List_p)
+{
+  Iterator_p->List_p = List_p;
+  Iterator_p->Node_p = List_p->Head_p;
+}
+
+bool
+DLIST_IteratorHasNext(const DLIST_Iterator_t *const Iterator_p)
+{
+  return (Iterator_p->Node_p != NULL);
+}
+
+void*
+DLIST_IteratorGetNext(DLIST_Iterator_t *const Iterator_p)
+{
+  void* Data_p = Iterator_p->Node_p->Data_p;
+  Iterator_p->Node_p = Iterator_p->Node_p->Next_p;
+  return Data_p;
+}
+
+void
+DLIST_IteratorReset(DLIST_Iterator_t *const Iterator_p)
+{
+  Iterator_p->Node_p = Iterator_p->List_p->Head_p;
+}
+
+/* > Local Function Definitions ***********************************************/
+
+// Removes Node_p from the list, frees it and returns its data
+static void*
+UnlinkNode(DLIST_List_t *const List_p, DLIST_Node_t *const Node_p)
+{
+  if (Node_p->Prev_p == NULL)
+  {
+    List_p->Head_p = Node_p->Next_p;
+  }
+  else
+  {
+    Node_p->Prev_p->Next_p = Node_p->Next_p;
+  }
+
+  if (Node_p->Next_p == NULL)
+  {
+    List_p->Tail_p = Node_p->Prev_p;
+  }
+  else
+  {
+    Node_p->Next_p->Prev_p = Node_p->Prev_p;
+  }
+
+  void* Data_p = Node_p->Data_p;
+  free(Node_p);
+  List_p->Length--;
+  return Data_p;
+}
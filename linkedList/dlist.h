@@ -0,0 +1,295 @@
+#ifndef DLIST_H
+#define DLIST_H
+
+/*
+ * Doubly Linked List
+ *
+ * Every node links to both neighbours, so the list can be used as a deque
+ * with constant time inserts and removes at both ends. The list uses the
+ * same callbacks as the singly linked list.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition
+//
+
+typedef struct DLIST_Node
+{
+  void*              Data_p;
+  struct DLIST_Node* Next_p;
+  struct DLIST_Node* Prev_p;
+} DLIST_Node_t;
+
+
+//
+// List Definition
+//
+
+typedef struct DLIST_List
+{
+  SLIST_Callbacks_t Callbacks;
+  DLIST_Node_t*     Head_p;
+  DLIST_Node_t*     Tail_p;
+  size_t            Length;
+} DLIST_List_t;
+
+
+//
+// Data Iterator
+//
+
+typedef struct DLIST_Iterator
+{
+  const DLIST_List_t* List_p;
+  const DLIST_Node_t* Node_p;
+} DLIST_Iterator_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates a doubly-linked list.
+ *
+ * @param[in]     List_p  The list to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_Create(DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Destroys a list
+ *
+ * Destroys a list created by DLIST_Create() and frees all nodes. The data in
+ * the list is freed by the function set by DLIST_SetDestroyFunction(). If no
+ * destroy function is set, the data in the nodes is not freed.
+ *
+ * @param[in]     List_p  The list to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_Destroy(DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+DLIST_IsEmpty(const DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Returns the number of elements in the list
+ *
+ * Returns the element count kept by the list. The list is not traversed.
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+DLIST_Length(const DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Inserts an item first in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_InsertFirst(DLIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Inserts an item last in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_InsertLast(DLIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Removes the first item in the list.
+ *
+ * Does not de-allocate the data in the removed node; this data is returned and
+ * should be de-allocated manually.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+DLIST_RemoveFirst(DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes the last item in the list.
+ *
+ * Does not de-allocate the data in the removed node; this data is returned and
+ * should be de-allocated manually. The operation takes constant time.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+DLIST_RemoveLast(DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Removes the first item in the list that is equal to SearchData_p, according
+ * to the comparison function.
+ * Does not de-allocate the removed data; this data is returned and should be
+ * de-allocated manually.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to remove
+ * @return        Pointer to the removed data, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+DLIST_RemoveSpecific(DLIST_List_t *const List_p, const void* const SearchData_p);
+
+
+/**
+ * @brief Print the list
+ *
+ * Calls the print function for the list for every node in the list.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_Print(const DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_SetDestroyFunction(DLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets print function for the list
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     DataPrint_fp  Pointer to the print function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_SetPrintFunction(DLIST_List_t *const List_p, DataPrint_t DataPrint_fp);
+
+
+/**
+ * @brief Sets comparison function for the list
+ *
+ * The function follows the same rules as for SLIST_SetCompareFunction().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_SetCompareFunction(DLIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+/**
+ * @brief Initializes an iterator
+ *
+ * Initializes an iterator placed by the caller, typically on the stack. The
+ * iterator does not modify the list and needs no destruction.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @param[in]     List_p      The list to be iterated.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_IteratorInit(DLIST_Iterator_t *const Iterator_p,
+                   const DLIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the iterator has more elements
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+DLIST_IteratorHasNext(const DLIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Returns the next element and advances the iterator
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        A pointer to the data of the current element
+ *
+ ******************************************************************************/
+void*
+DLIST_IteratorGetNext(DLIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Resets the iterator
+ *
+ * Moves the iterator back to the first element of the list.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+DLIST_IteratorReset(DLIST_Iterator_t *const Iterator_p);
+
+
+#endif // DLIST_H
@@ -0,0 +1,158 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "dlist.h"
+#include "dlist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define OPERATIONS_PER_RUN  1000000
+#define NODES_PER_RUN       100000000
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 1000, 10000, 100000, 1000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchSlistTailStack(size_t Size);
+
+static void
+BenchDlistTailStack(size_t Size);
+
+static void
+BenchDlistDeque(size_t Size);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_DLIST_Benchmarks(void)
+{
+  printf("Remove at the tail: singly vs doubly linked\n");
+
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchSlistTailStack(ListSizes[i]);
+    BenchDlistTailStack(ListSizes[i]);
+    BenchDlistDeque(ListSizes[i]);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Pushes and pops at the tail of a list holding Size elements. SLIST walks
+// the whole list on every pop, so the number of operations is capped to keep
+// the run time bounded.
+static void
+BenchSlistTailStack(size_t Size)
+{
+  SLIST_List_t List;
+  static int Data;
+  char Name[64];
+  size_t Operations = NODES_PER_RUN / Size;
+
+  if (Operations > OPERATIONS_PER_RUN)
+  {
+    Operations = OPERATIONS_PER_RUN;
+  }
+
+  SLIST_Create(&List);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Operations; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+    SLIST_RemoveLast(&List);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "TailStack/slist/N=%zu", Size);
+  BENCH_Report(Name, Operations * 2, Elapsed);
+
+  SLIST_Destroy(&List);
+}
+
+static void
+BenchDlistTailStack(size_t Size)
+{
+  DLIST_List_t List;
+  static int Data;
+  char Name[64];
+
+  DLIST_Create(&List);
+  for (size_t i = 0; i < Size; i++)
+  {
+    DLIST_InsertLast(&List, &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < OPERATIONS_PER_RUN; i++)
+  {
+    DLIST_InsertLast(&List, &Data);
+    DLIST_RemoveLast(&List);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "TailStack/dlist/N=%zu", Size);
+  BENCH_Report(Name, (size_t)OPERATIONS_PER_RUN * 2, Elapsed);
+
+  DLIST_Destroy(&List);
+}
+
+// Uses both ends like a work-stealing deque: the owner pushes and pops at the
+// tail while a thief takes from the head
+static void
+BenchDlistDeque(size_t Size)
+{
+  DLIST_List_t List;
+  static int Data;
+  char Name[64];
+
+  DLIST_Create(&List);
+  for (size_t i = 0; i < Size; i++)
+  {
+    DLIST_InsertLast(&List, &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < OPERATIONS_PER_RUN; i++)
+  {
+    DLIST_InsertLast(&List, &Data);
+    DLIST_InsertLast(&List, &Data);
+    DLIST_RemoveLast(&List);
+    DLIST_RemoveFirst(&List);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Deque/dlist/N=%zu", Size);
+  BENCH_Report(Name, (size_t)OPERATIONS_PER_RUN * 4, Elapsed);
+
+  DLIST_Destroy(&List);
+}
@@ -0,0 +1,26 @@
+#ifndef DLIST_BENCH_H
+#define DLIST_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_DLIST_Benchmarks(void);
+
+
+#endif // DLIST_BENCH_H
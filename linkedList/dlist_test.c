@@ -0,0 +1,305 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "dlist.h"
+#include "dlist_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TEST_ELEMENTS  50
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int Numbers[TEST_ELEMENTS];
+static int DestroyCount = 0;
+static int PrintCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p);
+
+static void
+TestInsertBothEnds(CuTest* Test_p);
+
+static void
+TestRemoveFirstLast(CuTest* Test_p);
+
+static void
+TestRemoveSpecific(CuTest* Test_p);
+
+static void
+TestPrintAndDestroy(CuTest* Test_p);
+
+static void
+TestIterator(CuTest* Test_p);
+
+static CuSuite*
+Get_DLIST_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_DLIST_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_DLIST_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+DataDestroy(void* const Data_p)
+{
+  DestroyCount++;
+  free(Data_p);
+}
+
+static void
+DataPrint(const void* const Data_p)
+{
+  (void)Data_p;
+  PrintCount++;
+}
+
+static int
+DataCompare(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+// Fills the list with 0 .. TEST_ELEMENTS-1 in order, using both ends
+static void
+FillList(DLIST_List_t *const List_p)
+{
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Numbers[i] = i;
+  }
+  for (int i = TEST_ELEMENTS / 2; i < TEST_ELEMENTS; i++)
+  {
+    DLIST_InsertLast(List_p, &Numbers[i]);
+  }
+  for (int i = TEST_ELEMENTS / 2 - 1; i >= 0; i--)
+  {
+    DLIST_InsertFirst(List_p, &Numbers[i]);
+  }
+}
+
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p)
+{
+  DLIST_List_t List;
+
+  DLIST_Create(&List);
+
+  CuAssertTrue(Test_p, DLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, DLIST_Length(&List) == 0);
+
+  DLIST_Destroy(&List);
+
+  CuAssertTrue(Test_p, DLIST_IsEmpty(&List) == true);
+}
+
+
+static void
+TestInsertBothEnds(CuTest* Test_p)
+{
+  DLIST_List_t List;
+  DLIST_Iterator_t It;
+
+  DLIST_Create(&List);
+  FillList(&List);
+
+  CuAssertTrue(Test_p, DLIST_Length(&List) == TEST_ELEMENTS);
+
+  // The backward links mirror the forward links
+  int Expected = TEST_ELEMENTS - 1;
+  for (DLIST_Node_t* Node_p = List.Tail_p; Node_p != NULL; Node_p = Node_p->Prev_p)
+  {
+    CuAssertIntEquals(Test_p, Expected, *(int*)Node_p->Data_p);
+    Expected--;
+  }
+  CuAssertIntEquals(Test_p, -1, Expected);
+
+  Expected = 0;
+  DLIST_IteratorInit(&It, &List);
+  while (DLIST_IteratorHasNext(&It))
+  {
+    CuAssertIntEquals(Test_p, Expected, *(int*)DLIST_IteratorGetNext(&It));
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+
+  DLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveFirstLast(CuTest* Test_p)
+{
+  DLIST_List_t List;
+
+  DLIST_Create(&List);
+  FillList(&List);
+
+  for (int i = 0; i < TEST_ELEMENTS / 2; i++)
+  {
+    CuAssertIntEquals(Test_p, i, *(int*)DLIST_RemoveFirst(&List));
+    CuAssertIntEquals(Test_p, TEST_ELEMENTS - 1 - i, *(int*)DLIST_RemoveLast(&List));
+    CuAssertTrue(Test_p, DLIST_Length(&List) == (size_t)(TEST_ELEMENTS - 2 * (i + 1)));
+  }
+  CuAssertTrue(Test_p, DLIST_IsEmpty(&List) == true);
+  CuAssertPtrEquals(Test_p, NULL, List.Tail_p);
+  CuAssertTrue(Test_p, DLIST_Length(&List) == 0);
+
+  // The list is usable again after being emptied
+  DLIST_InsertLast(&List, &Numbers[7]);
+  CuAssertIntEquals(Test_p, 7, *(int*)DLIST_RemoveLast(&List));
+
+  DLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveSpecific(CuTest* Test_p)
+{
+  DLIST_List_t List;
+  int Missing = TEST_ELEMENTS;
+
+  DLIST_Create(&List);
+  DLIST_SetCompareFunction(&List, DataCompare);
+  FillList(&List);
+
+  CuAssertPtrEquals(Test_p, NULL, DLIST_RemoveSpecific(&List, &Missing));
+
+  // Remove every odd number, then every even number from the back
+  for (int i = 1; i < TEST_ELEMENTS; i += 2)
+  {
+    CuAssertPtrEquals(Test_p, &Numbers[i], DLIST_RemoveSpecific(&List, &Numbers[i]));
+  }
+  CuAssertTrue(Test_p, DLIST_Length(&List) == TEST_ELEMENTS / 2);
+
+  int Expected = 0;
+  DLIST_Iterator_t It;
+  DLIST_IteratorInit(&It, &List);
+  while (DLIST_IteratorHasNext(&It))
+  {
+    CuAssertIntEquals(Test_p, Expected, *(int*)DLIST_IteratorGetNext(&It));
+    Expected += 2;
+  }
+
+  for (int i = TEST_ELEMENTS - 2; i >= 0; i -= 2)
+  {
+    CuAssertPtrEquals(Test_p, &Numbers[i], DLIST_RemoveSpecific(&List, &Numbers[i]));
+  }
+  CuAssertTrue(Test_p, DLIST_IsEmpty(&List) == true);
+  CuAssertPtrEquals(Test_p, NULL, List.Tail_p);
+
+  DLIST_Destroy(&List);
+}
+
+
+static void
+TestPrintAndDestroy(CuTest* Test_p)
+{
+  DLIST_List_t List;
+
+  DLIST_Create(&List);
+  DLIST_SetDestroyFunction(&List, DataDestroy);
+  DLIST_SetPrintFunction(&List, DataPrint);
+
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    DLIST_InsertLast(&List, malloc(sizeof(int)));
+  }
+
+  PrintCount = 0;
+  DLIST_Print(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, PrintCount);
+
+  DestroyCount = 0;
+  DLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, DestroyCount);
+  CuAssertTrue(Test_p, DLIST_IsEmpty(&List) == true);
+}
+
+
+static void
+TestIterator(CuTest* Test_p)
+{
+  DLIST_List_t List;
+  DLIST_Iterator_t It;
+
+  DLIST_Create(&List);
+  FillList(&List);
+
+  DLIST_IteratorInit(&It, &List);
+  for (int Pass = 0; Pass < 2; Pass++)
+  {
+    int Expected = 0;
+    while (DLIST_IteratorHasNext(&It))
+    {
+      CuAssertIntEquals(Test_p, Expected, *(int*)DLIST_IteratorGetNext(&It));
+      Expected++;
+    }
+    CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+    DLIST_IteratorReset(&It);
+  }
+
+  // Iterating does not change the list
+  CuAssertTrue(Test_p, DLIST_Length(&List) == TEST_ELEMENTS);
+
+  DLIST_Destroy(&List);
+}
+
+
+static CuSuite*
+Get_DLIST_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestInsertBothEnds);
+  SUITE_ADD_TEST(Suite_p, TestRemoveFirstLast);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecific);
+  SUITE_ADD_TEST(Suite_p, TestPrintAndDestroy);
+  SUITE_ADD_TEST(Suite_p, TestIterator);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef DLIST_TEST_H
+#define DLIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_DLIST_Tests(void);
+
+
+#endif // DLIST_TEST_H
@@ -0,0 +1,385 @@
+/* > Includes *****************************************************************/
+#include "idxlist.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+// Number of slots allocated by the first insert
+#define IDXLIST_MIN_CAPACITY  16
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static bool
+Resize(IDXLIST_List_t *const List_p, size_t Capacity);
+
+static uint32_t
+AllocSlot(IDXLIST_List_t *const List_p);
+
+static void
+FreeSlot(IDXLIST_List_t *const List_p, uint32_t Slot);
+
+static void*
+UnlinkSlot(IDXLIST_List_t *const List_p, uint32_t Previous, uint32_t Slot);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+IDXLIST_Create(IDXLIST_List_t *const List_p)
+{
+  List_p->Data_pp = NULL;
+  List_p->Next_p = NULL;
+  List_p->Head = IDXLIST_NONE;
+  List_p->Tail = IDXLIST_NONE;
+  List_p->Free = IDXLIST_NONE;
+  List_p->Used = 0;
+  List_p->Capacity = 0;
+  List_p->Length = 0;
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+IDXLIST_Destroy(IDXLIST_List_t *const List_p)
+{
+  if (List_p->Callbacks.DataDestroy_fp != NULL)
+  {
+    for (uint32_t slot = List_p->Head; slot != IDXLIST_NONE; slot = List_p->Next_p[slot])
+    {
+      List_p->Callbacks.DataDestroy_fp(List_p->Data_pp[slot]);
+    }
+  }
+  free(List_p->Data_pp);
+  free(List_p->Next_p);
+  List_p->Data_pp = NULL;
+  List_p->Next_p = NULL;
+  List_p->Head = IDXLIST_NONE;
+  List_p->Tail = IDXLIST_NONE;
+  List_p->Free = IDXLIST_NONE;
+  List_p->Used = 0;
+  List_p->Capacity = 0;
+  List_p->Length = 0;
+}
+
+bool
+IDXLIST_IsEmpty(const IDXLIST_List_t *const List_p)
+{
+  return (List_p->Head == IDXLIST_NONE);
+}
+
+size_t
+IDXLIST_Length(const IDXLIST_List_t *const List_p)
+{
+  return List_p->Length;
+}
+
+bool
+IDXLIST_Reserve(IDXLIST_List_t *const List_p, size_t Capacity)
+{
+  if (Capacity <= List_p->Capacity)
+  {
+    return true;
+  }
+  if (Capacity > IDXLIST_MAX_LENGTH)
+  {
+    return false;
+  }
+  return Resize(List_p, Capacity);
+}
+
+bool
+IDXLIST_InsertFirst(IDXLIST_List_t *const List_p, const void *const Data_p)
+{
+  uint32_t slot = AllocSlot(List_p);
+  if (slot == IDXLIST_NONE)
+  {
+    return false;
+  }
+
+  List_p->Data_pp[slot] = (void*)Data_p;
+  List_p->Next_p[slot] = List_p->Head;
+  List_p->Head = slot;
+  if (List_p->Tail == IDXLIST_NONE)
+  {
+    List_p->Tail = slot;
+  }
+  List_p->Length++;
+  return true;
+}
+
+bool
+IDXLIST_InsertLast(IDXLIST_List_t *const List_p, const void *const Data_p)
+{
+  uint32_t slot = AllocSlot(List_p);
+  if (slot == IDXLIST_NONE)
+  {
+    return false;
+  }
+
+  List_p->Data_pp[slot] = (void*)Data_p;
+  List_p->Next_p[slot] = IDXLIST_NONE;
+  if (List_p->Tail == IDXLIST_NONE)
+  {
+    List_p->Head = slot;
+  }
+  else
+  {
+    List_p->Next_p[List_p->Tail] = slot;
+  }
+  List_p->Tail = slot;
+  List_p->Length++;
+  return true;
+}
+
+void*
+IDXLIST_RemoveFirst(IDXLIST_List_t *const List_p)
+{
+  return UnlinkSlot(List_p, IDXLIST_NONE, List_p->Head);
+}
+
+void*
+IDXLIST_RemoveLast(IDXLIST_List_t *const List_p)
+{
+  uint32_t previous = IDXLIST_NONE;
+  if (List_p->Head != List_p->Tail)
+  {
+    previous = List_p->Head;
+    while (List_p->Next_p[previous] != List_p->Tail)
+    {
+      previous = List_p->Next_p[previous];
+    }
+  }
+  return UnlinkSlot(List_p, previous, List_p->Tail);
+}
+
+void*
+IDXLIST_RemoveSpecific(IDXLIST_List_t *const List_p, const void* const SearchData_p)
+{
+  uint32_t previous = IDXLIST_NONE;
+  for (uint32_t slot = List_p->Head; slot != IDXLIST_NONE; slot = List_p->Next_p[slot])
+  {
+    if (List_p->Callbacks.DataCompare_fp(List_p->Data_pp[slot], SearchData_p) == 0)
+    {
+      return UnlinkSlot(List_p, previous, slot);
+    }
+    previous = slot;
+  }
+  return NULL;
+}
+
+void*
+IDXLIST_Find(const IDXLIST_List_t *const List_p, const void* const SearchData_p)
+{
+  for (uint32_t slot = List_p->Head; slot != IDXLIST_NONE; slot = List_p->Next_p[slot])
+  {
+    if (List_p->Callbacks.DataCompare_fp(List_p->Data_pp[slot], SearchData_p) == 0)
+    {
+      return List_p->Data_pp[slot];
+    }
+  }
+  return NULL;
+}
+
+bool
+IDXLIST_Compact(IDXLIST_List_t *const List_p)
+{
+  size_t length = List_p->Length;
+  void** data_pp = NULL;
+  uint32_t* next_p = NULL;
+
+  if (length > 0)
+  {
+    data_pp = malloc(length * sizeof(void*));
+    next_p = malloc(length * sizeof(uint32_t));
+    if (data_pp == NULL || next_p == NULL)
+    {
+      free(data_pp);
+      free(next_p);
+      return false;
+    }
+  }
+
+  uint32_t count = 0;
+  for (uint32_t slot = List_p->Head; slot != IDXLIST_NONE; slot = List_p->Next_p[slot])
+  {
+    data_pp[count] = List_p->Data_pp[slot];
+    next_p[count] = count + 1;
+    count++;
+  }
+
+  free(List_p->Data_pp);
+  free(List_p->Next_p);
+  List_p->Data_pp = data_pp;
+  List_p->Next_p = next_p;
+  List_p->Free = IDXLIST_NONE;
+  List_p->Used = count;
+  List_p->Capacity = length;
+  if (length > 0)
+  {
+    next_p[count - 1] = IDXLIST_NONE;
+    List_p->Head = 0;
+    List_p->Tail = count - 1;
+  }
+  return true;
+}
+
+void
+IDXLIST_Print(const IDXLIST_List_t *const List_p)
+{
+  for (uint32_t slot = List_p->Head; slot != IDXLIST_NONE; slot = List_p->Next_p[slot])
+  {
+    List_p->Callbacks.DataPrint_fp(List_p->Data_pp[slot]);
+  }
+}
+
+void
+IDXLIST_SetDestroyFunction(IDXLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+IDXLIST_SetPrintFunction(IDXLIST_List_t *const List_p, DataPrint_t DataPrint_fp)
+{
+  List_p->Callbacks.DataPrint_fp = DataPrint_fp;
+}
+
+void
+IDXLIST_SetCompareFunction(IDXLIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+//
+// ITERATOR
+//
+
+void
+IDXLIST_IteratorInit(IDXLIST_Iterator_t *const Iterator_p,
+                     const IDXLIST_List_t *const List_p)
+{
+  Iterator_p->List_p = List_p;
+  IDXLIST_IteratorReset(Iterator_p);
+}
+
+bool
+IDXLIST_IteratorHasNext(const IDXLIST_Iterator_t *const Iterator_p)
+{
+  return (Iterator_p->Slot != IDXLIST_NONE);
+}
+
+void*
+IDXLIST_IteratorGetNext(IDXLIST_Iterator_t *const Iterator_p)
+{
+  uint32_t slot = Iterator_p->Slot;
+  Iterator_p->Slot = Iterator_p->List_p->Next_p[slot];
+  return Iterator_p->List_p->Data_pp[slot];
+}
+
+void
+IDXLIST_IteratorReset(IDXLIST_Iterator_t *const Iterator_p)
+{
+  Iterator_p->Slot = Iterator_p->List_p->Head;
+}
+
+/* > Local Function Definitions ***********************************************/
+
+// Reallocates both arrays to Capacity slots. The links are slot numbers, so
+// the contents need no fixup when realloc() moves them.
+static bool
+Resize(IDXLIST_List_t *const List_p, size_t Capacity)
+{
+  void** data_pp = realloc(List_p->Data_pp, Capacity * sizeof(void*));
+  if (data_pp == NULL)
+  {
+    return false;
+  }
+  List_p->Data_pp = data_pp;
+
+  uint32_t* next_p = realloc(List_p->Next_p, Capacity * sizeof(uint32_t));
+  if (next_p == NULL)
+  {
+    return false;
+  }
+  List_p->Next_p = next_p;
+  List_p->Capacity = Capacity;
+  return true;
+}
+
+// Returns a slot for a new node, recycled or never used, growing the arrays
+// when needed, or IDXLIST_NONE if the list is full or out of memory
+static uint32_t
+AllocSlot(IDXLIST_List_t *const List_p)
+{
+  uint32_t slot = List_p->Free;
+  if (slot != IDXLIST_NONE)
+  {
+    List_p->Free = List_p->Next_p[slot];
+    return slot;
+  }
+
+  if (List_p->Used == List_p->Capacity)
+  {
+    size_t capacity = (List_p->Capacity == 0) ? IDXLIST_MIN_CAPACITY : 2 * List_p->Capacity;
+    if (capacity > IDXLIST_MAX_LENGTH)
+    {
+      capacity = IDXLIST_MAX_LENGTH;
+    }
+    if (capacity == List_p->Capacity || !Resize(List_p, capacity))
+    {
+      return IDXLIST_NONE;
+    }
+  }
+  return List_p->Used++;
+}
+
+static void
+FreeSlot(IDXLIST_List_t *const List_p, uint32_t Slot)
+{
+  List_p->Next_p[Slot] = List_p->Free;
+  List_p->Free = Slot;
+}
+
+// Removes the node in Slot, which follows Previous (IDXLIST_NONE for the
+// head), from the list, frees the slot and returns the data
+static void*
+UnlinkSlot(IDXLIST_List_t *const List_p, uint32_t Previous, uint32_t Slot)
+{
+  void* data_p = List_p->Data_pp[Slot];
+  uint32_t next = List_p->Next_p[Slot];
+
+  if (Previous == IDXLIST_NONE)
+  {
+    List_p->Head = next;
+  }
+  else
+  {
+    List_p->Next_p[Previous] = next;
+  }
+  if (List_p->Tail == Slot)
+  {
+    List_p->Tail = Previous;
+  }
+  FreeSlot(List_p, Slot);
+  List_p->Length--;
+  return data_p;
+}
@@ -0,0 +1,365 @@
+#ifndef IDXLIST_H
+#define IDXLIST_H
+
+/*
+ * Index Linked List
+ *
+ * A singly linked list whose nodes are slots in two growable arrays, one for
+ * the data pointers and one for the links, with 32-bit slot numbers instead
+ * of pointers as links. A node costs sizeof(void*) + 4 bytes instead of the
+ * 16 bytes of an SLIST_Node_t plus allocator overhead, a scan follows a
+ * dense array of links, and as no link holds an address the arrays can be
+ * moved in memory, e.g. by realloc(), without any fixup. Free slots are kept
+ * on a free list threaded through the link array. The list uses the same
+ * callbacks as the singly linked list and holds at most IDXLIST_MAX_LENGTH
+ * elements.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+// Link value of the last node and of an empty list
+#define IDXLIST_NONE        UINT32_MAX
+
+#define IDXLIST_MAX_LENGTH  ((size_t)UINT32_MAX)
+
+//
+// Iterates over the data of every element in the list. Variable must be a
+// pointer to the data type of the list. The list must not be modified while
+// iterating.
+//
+#define IDXLIST_FOREACH(Variable, List_p)                                       \
+  for (uint32_t Variable##_Slot = (List_p)->Head;                               \
+       Variable##_Slot != IDXLIST_NONE &&                                       \
+       ((Variable) = (List_p)->Data_pp[Variable##_Slot], 1);                    \
+       Variable##_Slot = (List_p)->Next_p[Variable##_Slot])
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// List Definition
+//
+// Slot i of the list holds its data in Data_pp[i] and the slot of the next
+// node in Next_p[i]. Slots below Used that are not in the list are chained
+// from Free through Next_p, slots from Used up to Capacity were never used.
+//
+
+typedef struct IDXLIST_List
+{
+  SLIST_Callbacks_t Callbacks;
+  void**            Data_pp;
+  uint32_t*         Next_p;
+  uint32_t          Head;
+  uint32_t          Tail;
+  uint32_t          Free;
+  uint32_t          Used;
+  size_t            Capacity;
+  size_t            Length;
+} IDXLIST_List_t;
+
+
+//
+// Data Cursor, a value type placed by the caller
+//
+
+typedef struct IDXLIST_Iterator
+{
+  const IDXLIST_List_t* List_p;
+  uint32_t              Slot;
+} IDXLIST_Iterator_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates an empty index linked list. No memory is allocated until the first
+ * insert.
+ *
+ * @param[in]     List_p  The list to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_Create(IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Destroys a list
+ *
+ * Destroys a list created by IDXLIST_Create() and frees both arrays. The data
+ * in the list is freed by the function set by IDXLIST_SetDestroyFunction().
+ * If no destroy function is set, the data is not freed.
+ *
+ * @param[in]     List_p  The list to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_Destroy(IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+IDXLIST_IsEmpty(const IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Returns the number of elements in the list
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+IDXLIST_Length(const IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Reserves slots for a number of elements
+ *
+ * Grows the arrays so that the list holds Capacity elements without another
+ * allocation. Does nothing if the list has that many slots already.
+ *
+ * @param[in]     List_p    Pointer to the list
+ * @param[in]     Capacity  Number of elements, at most IDXLIST_MAX_LENGTH
+ * @return        true on success, false if out of memory
+ *
+ ******************************************************************************/
+bool
+IDXLIST_Reserve(IDXLIST_List_t *const List_p, size_t Capacity);
+
+
+/**
+ * @brief Inserts an item first in the list
+ *
+ * Takes a free slot, doubling the arrays when there is none.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        true on success, false if the list is full or out of memory
+ *
+ ******************************************************************************/
+bool
+IDXLIST_InsertFirst(IDXLIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Inserts an item last in the list
+ *
+ * Takes a free slot, doubling the arrays when there is none.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        true on success, false if the list is full or out of memory
+ *
+ ******************************************************************************/
+bool
+IDXLIST_InsertLast(IDXLIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Removes the first item in the list.
+ *
+ * Does not de-allocate the data in the removed node; this data is returned and
+ * should be de-allocated manually.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+IDXLIST_RemoveFirst(IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes the last item in the list.
+ *
+ * Does not de-allocate the data in the removed node; this data is returned and
+ * should be de-allocated manually. Traverses the list to find the new tail.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+IDXLIST_RemoveLast(IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Removes the first item in the list that is equal to SearchData_p, according
+ * to the comparison function.
+ * Does not de-allocate the removed data; this data is returned and should be
+ * de-allocated manually.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to remove
+ * @return        Pointer to the removed data, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+IDXLIST_RemoveSpecific(IDXLIST_List_t *const List_p, const void* const SearchData_p);
+
+
+/**
+ * @brief Finds a specific item in the list
+ *
+ * Returns the first item in the list that is equal to SearchData_p, according
+ * to the comparison function, without removing it.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to search for
+ * @return        Pointer to the data in the list, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+IDXLIST_Find(const IDXLIST_List_t *const List_p, const void* const SearchData_p);
+
+
+/**
+ * @brief Relays the list out in traversal order
+ *
+ * Copies the elements into new arrays of exactly Length slots, slot i
+ * holding element i, and frees the old arrays, so that a scan reads both
+ * arrays sequentially and no memory is kept for free slots. Takes O(n).
+ * Iterators must be initialized again.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        true on success, false if out of memory, in which case the
+ *                list is unchanged
+ *
+ ******************************************************************************/
+bool
+IDXLIST_Compact(IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Print the list
+ *
+ * Calls the print function for the list for every element in the list.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_Print(const IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_SetDestroyFunction(IDXLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets print function for the list
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     DataPrint_fp  Pointer to the print function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_SetPrintFunction(IDXLIST_List_t *const List_p, DataPrint_t DataPrint_fp);
+
+
+/**
+ * @brief Sets comparison function for the list
+ *
+ * The function follows the same rules as for SLIST_SetCompareFunction().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_SetCompareFunction(IDXLIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+/**
+ * @brief Initializes an iterator
+ *
+ * Initializes an iterator placed by the caller, typically on the stack. The
+ * iterator does not modify the list and needs no destruction.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @param[in]     List_p      The list to be iterated.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_IteratorInit(IDXLIST_Iterator_t *const Iterator_p,
+                     const IDXLIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the iterator has more elements
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+IDXLIST_IteratorHasNext(const IDXLIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Returns the next element and advances the iterator
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        A pointer to the data of the current element
+ *
+ ******************************************************************************/
+void*
+IDXLIST_IteratorGetNext(IDXLIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Resets the iterator
+ *
+ * Moves the iterator back to the first element of the list.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+IDXLIST_IteratorReset(IDXLIST_Iterator_t *const Iterator_p);
+
+
+#endif // IDXLIST_H
@@ -0,0 +1,193 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "idxlist.h"
+#include "slist.h"
+#include "idxlist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SCAN_ROUNDS  10
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 1000000, 10000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchSlist(size_t Size, bool UsePool);
+
+static void
+BenchIdxlist(size_t Size);
+
+static void
+ReportFootprint(const char *const Name_p, size_t Bytes, size_t Size);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_IDXLIST_Benchmarks(void)
+{
+  printf("Compact nodes: SLIST (%zu byte nodes) vs IDXLIST (%zu byte slots)\n",
+         sizeof(SLIST_Node_t), sizeof(void*) + sizeof(uint32_t));
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchSlist(ListSizes[i], false);
+    BenchSlist(ListSizes[i], true);
+    BenchIdxlist(ListSizes[i]);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Fills, scans and drains an SLIST of Size elements, and reports the memory
+// taken by its nodes. For malloc'ed nodes only the requested size is known.
+static void
+BenchSlist(size_t Size, bool UsePool)
+{
+  SLIST_List_t List;
+  char Name[64];
+  static int Data;
+  volatile long Sink;
+  const char* Kind_p = UsePool ? "slist-pool" : "slist-malloc";
+
+  if (UsePool)
+  {
+    SLIST_CreateWithPool(&List, 0);
+  }
+  else
+  {
+    SLIST_Create(&List);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Fill/%s/N=%zu", Kind_p, Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  size_t Bytes = Size * sizeof(SLIST_Node_t);
+  if (UsePool)
+  {
+    Bytes = 0;
+    for (NODEPOOL_Slab_t* Slab_p = List.Pool_p->Slabs_p; Slab_p != NULL; Slab_p = Slab_p->Next_p)
+    {
+      Bytes += List.Pool_p->BlocksPerSlab * List.Pool_p->BlockSize;
+    }
+  }
+  snprintf(Name, sizeof(Name), "Footprint/%s/N=%zu", Kind_p, Size);
+  ReportFootprint(Name, Bytes, Size);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    long Sum = 0;
+    int* Number_p;
+    SLIST_FOREACH(Number_p, &List)
+    {
+      Sum += (long)(Number_p != NULL);
+    }
+    Sink = Sum;
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Scan/%s/N=%zu", Kind_p, Size);
+  BENCH_Report(Name, SCAN_ROUNDS * Size, Elapsed);
+
+  Start = BENCH_Now();
+  while (!SLIST_IsEmpty(&List))
+  {
+    SLIST_RemoveFirst(&List);
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Drain/%s/N=%zu", Kind_p, Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  (void)Sink;
+  SLIST_Destroy(&List);
+}
+
+// Same as BenchSlist() for an IDXLIST, whose footprint is both arrays
+static void
+BenchIdxlist(size_t Size)
+{
+  IDXLIST_List_t List;
+  char Name[64];
+  static int Data;
+  volatile long Sink;
+
+  IDXLIST_Create(&List);
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    IDXLIST_InsertLast(&List, &Data);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Fill/idxlist/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  snprintf(Name, sizeof(Name), "Footprint/idxlist/N=%zu", Size);
+  ReportFootprint(Name, List.Capacity * (sizeof(void*) + sizeof(uint32_t)), Size);
+  IDXLIST_Compact(&List);
+  snprintf(Name, sizeof(Name), "Footprint/idxlist-compacted/N=%zu", Size);
+  ReportFootprint(Name, List.Capacity * (sizeof(void*) + sizeof(uint32_t)), Size);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    long Sum = 0;
+    int* Number_p;
+    IDXLIST_FOREACH(Number_p, &List)
+    {
+      Sum += (long)(Number_p != NULL);
+    }
+    Sink = Sum;
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Scan/idxlist/N=%zu", Size);
+  BENCH_Report(Name, SCAN_ROUNDS * Size, Elapsed);
+
+  Start = BENCH_Now();
+  while (!IDXLIST_IsEmpty(&List))
+  {
+    IDXLIST_RemoveFirst(&List);
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Drain/idxlist/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  (void)Sink;
+  IDXLIST_Destroy(&List);
+}
+
+static void
+ReportFootprint(const char *const Name_p, size_t Bytes, size_t Size)
+{
+  printf("%-48s %12zu bytes %10.2f bytes/element\n",
+         Name_p, Bytes, (double)Bytes / Size);
+}
@@ -0,0 +1,26 @@
+#ifndef IDXLIST_BENCH_H
+#define IDXLIST_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_IDXLIST_Benchmarks(void);
+
+
+#endif // IDXLIST_BENCH_H
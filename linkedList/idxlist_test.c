@@ -0,0 +1,409 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "idxlist.h"
+#include "idxlist_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TEST_ELEMENTS  50
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int Numbers[TEST_ELEMENTS];
+static int DestroyCount = 0;
+static int PrintCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p);
+
+static void
+TestInsertGrows(CuTest* Test_p);
+
+static void
+TestRemoveFirstLast(CuTest* Test_p);
+
+static void
+TestRemoveSpecificRecyclesSlots(CuTest* Test_p);
+
+static void
+TestFind(CuTest* Test_p);
+
+static void
+TestCompact(CuTest* Test_p);
+
+static void
+TestPrintAndDestroy(CuTest* Test_p);
+
+static void
+TestIterator(CuTest* Test_p);
+
+static CuSuite*
+Get_IDXLIST_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_IDXLIST_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_IDXLIST_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+DataDestroy(void* const Data_p)
+{
+  DestroyCount++;
+  free(Data_p);
+}
+
+static void
+DataPrint(const void* const Data_p)
+{
+  (void)Data_p;
+  PrintCount++;
+}
+
+static int
+DataCompare(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+// Fills the list with 0 .. TEST_ELEMENTS-1 in order, using both ends
+static void
+FillList(IDXLIST_List_t *const List_p)
+{
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Numbers[i] = i;
+  }
+  for (int i = TEST_ELEMENTS / 2; i < TEST_ELEMENTS; i++)
+  {
+    IDXLIST_InsertLast(List_p, &Numbers[i]);
+  }
+  for (int i = TEST_ELEMENTS / 2 - 1; i >= 0; i--)
+  {
+    IDXLIST_InsertFirst(List_p, &Numbers[i]);
+  }
+}
+
+// Checks that the list holds exactly the numbers in Expected_p, in order
+static void
+AssertContents(CuTest* Test_p, const IDXLIST_List_t *const List_p,
+               const int *const Expected_p, size_t Count)
+{
+  size_t Index = 0;
+  int* Number_p;
+  IDXLIST_FOREACH(Number_p, List_p)
+  {
+    CuAssertTrue(Test_p, Index < Count);
+    CuAssertIntEquals(Test_p, Expected_p[Index], *Number_p);
+    Index++;
+  }
+  CuAssertTrue(Test_p, Index == Count);
+  CuAssertTrue(Test_p, IDXLIST_Length(List_p) == Count);
+  if (Count > 0)
+  {
+    CuAssertIntEquals(Test_p, Expected_p[Count - 1], *(int*)List_p->Data_pp[List_p->Tail]);
+  }
+}
+
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+
+  IDXLIST_Create(&List);
+
+  CuAssertTrue(Test_p, IDXLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, IDXLIST_Length(&List) == 0);
+  CuAssertPtrEquals(Test_p, NULL, List.Data_pp);
+
+  IDXLIST_Destroy(&List);
+
+  CuAssertTrue(Test_p, IDXLIST_IsEmpty(&List) == true);
+}
+
+
+static void
+TestInsertGrows(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+
+  IDXLIST_Create(&List);
+  FillList(&List);
+
+  CuAssertTrue(Test_p, IDXLIST_Length(&List) == TEST_ELEMENTS);
+  CuAssertTrue(Test_p, List.Capacity >= TEST_ELEMENTS);
+  CuAssertTrue(Test_p, List.Used == TEST_ELEMENTS);
+
+  int Expected = 0;
+  int* Number_p;
+  IDXLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+
+  // Reserving never shrinks the arrays
+  CuAssertTrue(Test_p, IDXLIST_Reserve(&List, 1000));
+  CuAssertTrue(Test_p, List.Capacity == 1000);
+  CuAssertTrue(Test_p, IDXLIST_Reserve(&List, 10));
+  CuAssertTrue(Test_p, List.Capacity == 1000);
+  CuAssertTrue(Test_p, IDXLIST_Length(&List) == TEST_ELEMENTS);
+
+  IDXLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveFirstLast(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+
+  IDXLIST_Create(&List);
+  FillList(&List);
+
+  for (int i = 0; i < TEST_ELEMENTS / 2; i++)
+  {
+    CuAssertIntEquals(Test_p, i, *(int*)IDXLIST_RemoveFirst(&List));
+    CuAssertIntEquals(Test_p, TEST_ELEMENTS - 1 - i, *(int*)IDXLIST_RemoveLast(&List));
+    CuAssertTrue(Test_p, IDXLIST_Length(&List) == (size_t)(TEST_ELEMENTS - 2 * (i + 1)));
+  }
+  CuAssertTrue(Test_p, IDXLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, List.Tail == IDXLIST_NONE);
+
+  // The list is usable again after being emptied
+  IDXLIST_InsertLast(&List, &Numbers[7]);
+  CuAssertIntEquals(Test_p, 7, *(int*)IDXLIST_RemoveLast(&List));
+
+  IDXLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveSpecificRecyclesSlots(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+  int Missing = TEST_ELEMENTS;
+
+  IDXLIST_Create(&List);
+  IDXLIST_SetCompareFunction(&List, DataCompare);
+  FillList(&List);
+  size_t Capacity = List.Capacity;
+
+  CuAssertPtrEquals(Test_p, NULL, IDXLIST_RemoveSpecific(&List, &Missing));
+
+  for (int i = 1; i < TEST_ELEMENTS; i += 2)
+  {
+    CuAssertPtrEquals(Test_p, &Numbers[i], IDXLIST_RemoveSpecific(&List, &Numbers[i]));
+  }
+  CuAssertTrue(Test_p, IDXLIST_Length(&List) == TEST_ELEMENTS / 2);
+
+  int Expected = 0;
+  int* Number_p;
+  IDXLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected += 2;
+  }
+
+  // The freed slots are taken before the arrays grow again
+  for (int i = 1; i < TEST_ELEMENTS; i += 2)
+  {
+    IDXLIST_InsertLast(&List, &Numbers[i]);
+  }
+  CuAssertTrue(Test_p, List.Capacity == Capacity);
+  CuAssertTrue(Test_p, List.Used == TEST_ELEMENTS);
+  CuAssertTrue(Test_p, List.Free == IDXLIST_NONE);
+
+  CuAssertPtrEquals(Test_p, &Numbers[TEST_ELEMENTS - 1],
+                    IDXLIST_RemoveSpecific(&List, &Numbers[TEST_ELEMENTS - 1]));
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS - 3, *(int*)List.Data_pp[List.Tail]);
+
+  IDXLIST_Destroy(&List);
+}
+
+
+static void
+TestFind(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+  int Missing = TEST_ELEMENTS;
+  int Key = 17;
+
+  IDXLIST_Create(&List);
+  IDXLIST_SetCompareFunction(&List, DataCompare);
+  CuAssertPtrEquals(Test_p, NULL, IDXLIST_Find(&List, &Key));
+
+  FillList(&List);
+
+  // The stored data is returned, not the search key
+  CuAssertPtrEquals(Test_p, &Numbers[17], IDXLIST_Find(&List, &Key));
+  CuAssertPtrEquals(Test_p, NULL, IDXLIST_Find(&List, &Missing));
+  CuAssertTrue(Test_p, IDXLIST_Length(&List) == TEST_ELEMENTS);
+
+  IDXLIST_Destroy(&List);
+}
+
+
+static void
+TestCompact(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+
+  IDXLIST_Create(&List);
+  IDXLIST_SetCompareFunction(&List, DataCompare);
+  CuAssertTrue(Test_p, IDXLIST_Compact(&List));
+  CuAssertTrue(Test_p, List.Capacity == 0);
+
+  FillList(&List);
+  for (int i = 0; i < TEST_ELEMENTS; i += 2)
+  {
+    IDXLIST_RemoveSpecific(&List, &Numbers[i]);
+  }
+  IDXLIST_InsertFirst(&List, &Numbers[0]);
+
+  CuAssertTrue(Test_p, IDXLIST_Compact(&List));
+  CuAssertTrue(Test_p, List.Capacity == TEST_ELEMENTS / 2 + 1);
+  CuAssertTrue(Test_p, List.Free == IDXLIST_NONE);
+  AssertContents(Test_p, &List, (int[]){ 0, 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21,
+                                         23, 25, 27, 29, 31, 33, 35, 37, 39, 41,
+                                         43, 45, 47, 49 }, TEST_ELEMENTS / 2 + 1);
+
+  // Slot i holds element i
+  for (uint32_t Slot = 0; Slot < List.Used; Slot++)
+  {
+    CuAssertTrue(Test_p, List.Next_p[Slot] == ((Slot + 1 < List.Used) ? Slot + 1 : IDXLIST_NONE));
+  }
+
+  // The full arrays grow on the next insert
+  IDXLIST_InsertLast(&List, &Numbers[2]);
+  CuAssertTrue(Test_p, List.Capacity == 2 * (TEST_ELEMENTS / 2 + 1));
+  CuAssertIntEquals(Test_p, 2, *(int*)IDXLIST_RemoveLast(&List));
+
+  while (!IDXLIST_IsEmpty(&List))
+  {
+    IDXLIST_RemoveFirst(&List);
+  }
+  CuAssertTrue(Test_p, IDXLIST_Compact(&List));
+  CuAssertPtrEquals(Test_p, NULL, List.Data_pp);
+  CuAssertTrue(Test_p, List.Head == IDXLIST_NONE);
+  IDXLIST_InsertLast(&List, &Numbers[3]);
+  AssertContents(Test_p, &List, (int[]){ 3 }, 1);
+
+  IDXLIST_Destroy(&List);
+}
+
+
+static void
+TestPrintAndDestroy(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+
+  IDXLIST_Create(&List);
+  IDXLIST_SetDestroyFunction(&List, DataDestroy);
+  IDXLIST_SetPrintFunction(&List, DataPrint);
+
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    IDXLIST_InsertLast(&List, malloc(sizeof(int)));
+  }
+
+  PrintCount = 0;
+  IDXLIST_Print(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, PrintCount);
+
+  DestroyCount = 0;
+  IDXLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, DestroyCount);
+  CuAssertTrue(Test_p, IDXLIST_IsEmpty(&List) == true);
+}
+
+
+static void
+TestIterator(CuTest* Test_p)
+{
+  IDXLIST_List_t List;
+  IDXLIST_Iterator_t It;
+
+  IDXLIST_Create(&List);
+  FillList(&List);
+
+  IDXLIST_IteratorInit(&It, &List);
+  for (int Pass = 0; Pass < 2; Pass++)
+  {
+    int Expected = 0;
+    while (IDXLIST_IteratorHasNext(&It))
+    {
+      CuAssertIntEquals(Test_p, Expected, *(int*)IDXLIST_IteratorGetNext(&It));
+      Expected++;
+    }
+    CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+    IDXLIST_IteratorReset(&It);
+  }
+
+  // Iterating does not change the list
+  CuAssertTrue(Test_p, IDXLIST_Length(&List) == TEST_ELEMENTS);
+
+  IDXLIST_Destroy(&List);
+}
+
+
+static CuSuite*
+Get_IDXLIST_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestInsertGrows);
+  SUITE_ADD_TEST(Suite_p, TestRemoveFirstLast);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecificRecyclesSlots);
+  SUITE_ADD_TEST(Suite_p, TestFind);
+  SUITE_ADD_TEST(Suite_p, TestCompact);
+  SUITE_ADD_TEST(Suite_p, TestPrintAndDestroy);
+  SUITE_ADD_TEST(Suite_p, TestIterator);
+
+  return Suite_p;
+}
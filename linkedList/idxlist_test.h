@@ -0,0 +1,26 @@
+#ifndef IDXLIST_TEST_H
+#define IDXLIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_IDXLIST_Tests(void);
+
+
+#endif // IDXLIST_TEST_H
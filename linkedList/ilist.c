@@ -0,0 +1,243 @@
+/* > Includes *****************************************************************/
+#include "ilist.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+#define LINK_OF(List_p, Data_p) \
+  ((ILIST_Link_t*)((char*)(Data_p) + (List_p)->LinkOffset))
+
+#define DATA_OF(List_p, Link_p) \
+  ((void*)((char*)(Link_p) - (List_p)->LinkOffset))
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void*
+UnlinkAfter(ILIST_List_t *const List_p,
+            ILIST_Link_t *const Previous_p,
+            ILIST_Link_t *const Link_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+ILIST_Create(ILIST_List_t *const List_p, size_t LinkOffset)
+{
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+  List_p->LinkOffset = LinkOffset;
+  List_p->Length = 0;
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+ILIST_Destroy(ILIST_List_t *const List_p)
+{
+  if (List_p->Callbacks.DataDestroy_fp != NULL)
+  {
+    ILIST_Link_t* link_p = List_p->Head_p;
+    while (link_p != NULL)
+    {
+      // The link lives inside the struct, so read it before destroying
+      ILIST_Link_t* next_p = link_p->Next_p;
+      List_p->Callbacks.DataDestroy_fp(DATA_OF(List_p, link_p));
+      link_p = next_p;
+    }
+  }
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+  List_p->Length = 0;
+}
+
+bool
+ILIST_IsEmpty(const ILIST_List_t *const List_p)
+{
+  return (List_p->Head_p == NULL);
+}
+
+size_t
+ILIST_Length(const ILIST_List_t *const List_p)
+{
+  return List_p->Length;
+}
+
+void
+ILIST_InsertFirst(ILIST_List_t *const List_p, const void *const Data_p)
+{
+  ILIST_Link_t* link_p = LINK_OF(List_p, Data_p);
+
+  link_p->Next_p = List_p->Head_p;
+  if (List_p->Head_p == NULL)
+  {
+    List_p->Tail_p = link_p;
+  }
+  List_p->Head_p = link_p;
+  List_p->Length++;
+}
+
+void
+ILIST_InsertLast(ILIST_List_t *const List_p, const void *const Data_p)
+{
+  ILIST_Link_t* link_p = LINK_OF(List_p, Data_p);
+
+  link_p->Next_p = NULL;
+  if (List_p->Tail_p == NULL)
+  {
+    List_p->Head_p = link_p;
+  }
+  else
+  {
+    List_p->Tail_p->Next_p = link_p;
+  }
+  List_p->Tail_p = link_p;
+  List_p->Length++;
+}
+
+void*
+ILIST_RemoveFirst(ILIST_List_t *const List_p)
+{
+  return UnlinkAfter(List_p, NULL, List_p->Head_p);
+}
+
+void*
+ILIST_RemoveLast(ILIST_List_t *const List_p)
+{
+  ILIST_Link_t* previous_p = NULL;
+
+  if (List_p->Head_p != List_p->Tail_p)
+  {
+    previous_p = List_p->Head_p;
+    while (previous_p->Next_p != List_p->Tail_p)
+    {
+      previous_p = previous_p->Next_p;
+    }
+  }
+  return UnlinkAfter(List_p, previous_p, List_p->Tail_p);
+}
+
+void*
+ILIST_RemoveSpecific(ILIST_List_t *const List_p, const void* const SearchData_p)
+{
+  ILIST_Link_t* previous_p = NULL;
+  ILIST_Link_t* link_p = List_p->Head_p;
+
+  while (link_p != NULL &&
+         List_p->Callbacks.DataCompare_fp(DATA_OF(List_p, link_p), SearchData_p) != 0)
+  {
+    previous_p = link_p;
+    link_p = link_p->Next_p;
+  }
+
+  if (link_p == NULL)
+  {
+    return NULL;
+  }
+  return UnlinkAfter(List_p, previous_p, link_p);
+}
+
+void
+ILIST_Print(const ILIST_List_t *const List_p)
+{
+  const ILIST_Link_t* print_p = List_p->Head_p;
+  while (print_p != NULL)
+  {
+    List_p->Callbacks.DataPrint_fp(DATA_OF(List_p, print_p));
+    print_p = print_p->Next_p;
+  }
+}
+
+void
+ILIST_SetDestroyFunction(ILIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+ILIST_SetPrintFunction(ILIST_List_t *const List_p, DataPrint_t DataPrint_fp)
+{
+  List_p->Callbacks.DataPrint_fp = DataPrint_fp;
+}
+
+void
+ILIST_SetCompareFunction(ILIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+//
+// ITERATOR
+//
+
+void
+ILIST_IteratorInit(ILIST_Iterator_t *const Iterator_p,
+                   const ILIST_List_t *const List_p)
+{
+  Iterator_p->List_p = List_p;
+  Iterator_p->Link_p = List_p->Head_p;
+}
+
+bool
+ILIST_IteratorHasNext(const ILIST_Iterator_t *const Iterator_p)
+{
+  return (Iterator_p->Link_p != NULL);
+}
+
+void*
+ILIST_IteratorGetNext(ILIST_Iterator_t *const Iterator_p)
+{
+  const ILIST_Link_t* link_p = Iterator_p->Link_p;
+  Iterator_p->Link_p = link_p->Next_p;
+  return DATA_OF(Iterator_p->List_p, link_p);
+}
+
+void
+ILIST_IteratorReset(ILIST_Iterator_t *const Iterator_p)
+{
+  Iterator_p->Link_p = Iterator_p->List_p->Head_p;
+}
+
+/* > Local Function Definitions ***********************************************/
+
+// Unlinks Link_p, which follows Previous_p (NULL for the head), and returns
+// the containing struct
+static void*
+UnlinkAfter(ILIST_List_t *const List_p,
+            ILIST_Link_t *const Previous_p,
+            ILIST_Link_t *const Link_p)
+{
+  if (Previous_p == NULL)
+  {
+    List_p->Head_p = Link_p->Next_p;
+  }
+  else
+  {
+    Previous_p->Next_p = Link_p->Next_p;
+  }
+  if (List_p->Tail_p == Link_p)
+  {
+    List_p->Tail_p = Previous_p;
+  }
+  Link_p->Next_p = NULL;
+  List_p->Length--;
+  return DATA_OF(List_p, Link_p);
+}
@@ -0,0 +1,311 @@
+#ifndef ILIST_H
+#define ILIST_H
+
+/*
+ * Intrusive Singly Linked List
+ *
+ * The link is embedded as an ILIST_Link_t member in the user's struct, and
+ * the list recovers the struct from the link with the offset of that member.
+ * No memory is allocated by any operation. The data pointers passed to and
+ * returned by the list, as well as the callbacks, refer to the containing
+ * structs.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+// Returns the struct of type Type containing the link Link_p as member Member
+#define ILIST_CONTAINER_OF(Link_p, Type, Member) \
+  ((Type*)((char*)(Link_p) - offsetof(Type, Member)))
+
+// Creates a list of structs of type Type linked through member Member
+#define ILIST_CREATE(List_p, Type, Member) \
+  ILIST_Create((List_p), offsetof(Type, Member))
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Link Definition, embedded in the user's struct
+//
+
+typedef struct ILIST_Link
+{
+  struct ILIST_Link* Next_p;
+} ILIST_Link_t;
+
+
+//
+// List Definition
+//
+
+typedef struct ILIST_List
+{
+  SLIST_Callbacks_t Callbacks;
+  ILIST_Link_t*     Head_p;
+  ILIST_Link_t*     Tail_p;
+  size_t            LinkOffset;
+  size_t            Length;
+} ILIST_List_t;
+
+
+//
+// Data Iterator
+//
+
+typedef struct ILIST_Iterator
+{
+  const ILIST_List_t* List_p;
+  const ILIST_Link_t* Link_p;
+} ILIST_Iterator_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates an intrusive singly-linked list. ILIST_CREATE() computes the link
+ * offset from the struct type and the name of the link member.
+ *
+ * @param[in]     List_p      The list to be initialized.
+ * @param[in]     LinkOffset  Offset of the ILIST_Link_t member in the
+ *                            containing struct.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_Create(ILIST_List_t *const List_p, size_t LinkOffset);
+
+
+/**
+ * @brief Destroys a list
+ *
+ * Destroys a list created by ILIST_Create(). The structs in the list are
+ * freed by the function set by ILIST_SetDestroyFunction(). If no destroy
+ * function is set, the structs are only unlinked.
+ *
+ * @param[in]     List_p  The list to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_Destroy(ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+ILIST_IsEmpty(const ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Returns the number of elements in the list
+ *
+ * Returns the element count kept by the list. The list is not traversed.
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+ILIST_Length(const ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Inserts an item first in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The struct to insert; it must not be in any list
+ *                        through the same link member
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_InsertFirst(ILIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Inserts an item last in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The struct to insert; it must not be in any list
+ *                        through the same link member
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_InsertLast(ILIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Removes the first item in the list.
+ *
+ * Only unlinks the struct; the struct is returned and should be
+ * de-allocated manually.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed struct
+ *
+ ******************************************************************************/
+void*
+ILIST_RemoveFirst(ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes the last item in the list.
+ *
+ * Only unlinks the struct; the struct is returned and should be
+ * de-allocated manually. The list is traversed to find the
+ * predecessor of the last struct.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed struct
+ *
+ ******************************************************************************/
+void*
+ILIST_RemoveLast(ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Removes the first item in the list that is equal to SearchData_p, according
+ * to the comparison function.
+ * Only unlinks the struct; the struct is returned and should be
+ * de-allocated manually.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to remove
+ * @return        Pointer to the removed struct, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+ILIST_RemoveSpecific(ILIST_List_t *const List_p, const void* const SearchData_p);
+
+
+/**
+ * @brief Print the list
+ *
+ * Calls the print function for the list for every struct in the list.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_Print(const ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_SetDestroyFunction(ILIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets print function for the list
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     DataPrint_fp  Pointer to the print function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_SetPrintFunction(ILIST_List_t *const List_p, DataPrint_t DataPrint_fp);
+
+
+/**
+ * @brief Sets comparison function for the list
+ *
+ * The function follows the same rules as for SLIST_SetCompareFunction().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_SetCompareFunction(ILIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+/**
+ * @brief Initializes an iterator
+ *
+ * Initializes an iterator placed by the caller, typically on the stack. The
+ * iterator does not modify the list and needs no destruction.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @param[in]     List_p      The list to be iterated.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_IteratorInit(ILIST_Iterator_t *const Iterator_p,
+                   const ILIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the iterator has more elements
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+ILIST_IteratorHasNext(const ILIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Returns the next element and advances the iterator
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        A pointer to the data of the current element
+ *
+ ******************************************************************************/
+void*
+ILIST_IteratorGetNext(ILIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Resets the iterator
+ *
+ * Moves the iterator back to the first element of the list.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ILIST_IteratorReset(ILIST_Iterator_t *const Iterator_p);
+
+
+#endif // ILIST_H
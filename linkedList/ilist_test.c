@@ -0,0 +1,297 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "ilist.h"
+#include "ilist_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TEST_ELEMENTS  10
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct Item
+{
+  int          Number;
+  ILIST_Link_t Link;
+  ILIST_Link_t OtherLink;
+} Item_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static Item_t Items[TEST_ELEMENTS];
+static int DestroyCount = 0;
+static int PrintCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p);
+
+static void
+TestInsertFirstLast(CuTest* Test_p);
+
+static void
+TestRemoveFirstLast(CuTest* Test_p);
+
+static void
+TestRemoveSpecific(CuTest* Test_p);
+
+static void
+TestPrintAndDestroy(CuTest* Test_p);
+
+static void
+TestTwoListsOneItem(CuTest* Test_p);
+
+static CuSuite*
+Get_ILIST_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_ILIST_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_ILIST_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+DataDestroy(void* const Data_p)
+{
+  DestroyCount++;
+  free(Data_p);
+}
+
+static void
+DataPrint(const void* const Data_p)
+{
+  (void)Data_p;
+  PrintCount++;
+}
+
+static int
+DataCompare(const void* const Data1_p, const void* const Data2_p)
+{
+  const Item_t* Item_p = Data1_p;
+  int Number = *(const int*)Data2_p;
+  return (Item_p->Number > Number) - (Item_p->Number < Number);
+}
+
+// Fills the list with Items[0] .. Items[TEST_ELEMENTS-1] in order
+static void
+FillList(ILIST_List_t *const List_p)
+{
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Items[i].Number = i;
+  }
+  for (int i = TEST_ELEMENTS / 2; i < TEST_ELEMENTS; i++)
+  {
+    ILIST_InsertLast(List_p, &Items[i]);
+  }
+  for (int i = TEST_ELEMENTS / 2 - 1; i >= 0; i--)
+  {
+    ILIST_InsertFirst(List_p, &Items[i]);
+  }
+}
+
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p)
+{
+  ILIST_List_t List;
+
+  ILIST_CREATE(&List, Item_t, Link);
+
+  CuAssertTrue(Test_p, ILIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, ILIST_Length(&List) == 0);
+  CuAssertTrue(Test_p, List.LinkOffset == offsetof(Item_t, Link));
+
+  ILIST_Destroy(&List);
+
+  CuAssertTrue(Test_p, ILIST_IsEmpty(&List) == true);
+}
+
+
+static void
+TestInsertFirstLast(CuTest* Test_p)
+{
+  ILIST_List_t List;
+  ILIST_Iterator_t It;
+
+  ILIST_CREATE(&List, Item_t, Link);
+  FillList(&List);
+
+  CuAssertTrue(Test_p, ILIST_Length(&List) == TEST_ELEMENTS);
+  CuAssertPtrEquals(Test_p, &Items[0], ILIST_CONTAINER_OF(List.Head_p, Item_t, Link));
+  CuAssertPtrEquals(Test_p, &Items[TEST_ELEMENTS - 1],
+                    ILIST_CONTAINER_OF(List.Tail_p, Item_t, Link));
+
+  for (int Pass = 0; Pass < 2; Pass++)
+  {
+    int Expected = 0;
+    ILIST_IteratorInit(&It, &List);
+    while (ILIST_IteratorHasNext(&It))
+    {
+      Item_t* Item_p = ILIST_IteratorGetNext(&It);
+      CuAssertPtrEquals(Test_p, &Items[Expected], Item_p);
+      Expected++;
+    }
+    CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+  }
+
+  ILIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveFirstLast(CuTest* Test_p)
+{
+  ILIST_List_t List;
+
+  ILIST_CREATE(&List, Item_t, Link);
+  FillList(&List);
+
+  for (int i = 0; i < TEST_ELEMENTS / 2; i++)
+  {
+    CuAssertPtrEquals(Test_p, &Items[i], ILIST_RemoveFirst(&List));
+    CuAssertPtrEquals(Test_p, &Items[TEST_ELEMENTS - 1 - i], ILIST_RemoveLast(&List));
+  }
+  CuAssertTrue(Test_p, ILIST_IsEmpty(&List) == true);
+  CuAssertPtrEquals(Test_p, NULL, List.Tail_p);
+  CuAssertTrue(Test_p, ILIST_Length(&List) == 0);
+
+  ILIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveSpecific(CuTest* Test_p)
+{
+  ILIST_List_t List;
+  int Missing = TEST_ELEMENTS;
+
+  ILIST_CREATE(&List, Item_t, Link);
+  ILIST_SetCompareFunction(&List, DataCompare);
+  FillList(&List);
+
+  CuAssertPtrEquals(Test_p, NULL, ILIST_RemoveSpecific(&List, &Missing));
+
+  // Middle, last and first item
+  int Middle = TEST_ELEMENTS / 2;
+  int Last = TEST_ELEMENTS - 1;
+  int First = 0;
+  CuAssertPtrEquals(Test_p, &Items[Middle], ILIST_RemoveSpecific(&List, &Middle));
+  CuAssertPtrEquals(Test_p, &Items[Last], ILIST_RemoveSpecific(&List, &Last));
+  CuAssertPtrEquals(Test_p, &Items[Last - 1], ILIST_CONTAINER_OF(List.Tail_p, Item_t, Link));
+  CuAssertPtrEquals(Test_p, &Items[First], ILIST_RemoveSpecific(&List, &First));
+  CuAssertPtrEquals(Test_p, &Items[1], ILIST_CONTAINER_OF(List.Head_p, Item_t, Link));
+  CuAssertTrue(Test_p, ILIST_Length(&List) == TEST_ELEMENTS - 3);
+
+  ILIST_Destroy(&List);
+}
+
+
+static void
+TestPrintAndDestroy(CuTest* Test_p)
+{
+  ILIST_List_t List;
+
+  ILIST_CREATE(&List, Item_t, Link);
+  ILIST_SetDestroyFunction(&List, DataDestroy);
+  ILIST_SetPrintFunction(&List, DataPrint);
+
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Item_t* Item_p = malloc(sizeof(Item_t));
+    Item_p->Number = i;
+    ILIST_InsertLast(&List, Item_p);
+  }
+
+  PrintCount = 0;
+  ILIST_Print(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, PrintCount);
+
+  DestroyCount = 0;
+  ILIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, DestroyCount);
+  CuAssertTrue(Test_p, ILIST_IsEmpty(&List) == true);
+}
+
+
+static void
+TestTwoListsOneItem(CuTest* Test_p)
+{
+  ILIST_List_t List;
+  ILIST_List_t OtherList;
+
+  ILIST_CREATE(&List, Item_t, Link);
+  ILIST_CREATE(&OtherList, Item_t, OtherLink);
+
+  // The same items are in both lists, in opposite order
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Items[i].Number = i;
+    ILIST_InsertLast(&List, &Items[i]);
+    ILIST_InsertFirst(&OtherList, &Items[i]);
+  }
+
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Item_t* Item_p = ILIST_RemoveFirst(&List);
+    Item_t* OtherItem_p = ILIST_RemoveFirst(&OtherList);
+    CuAssertIntEquals(Test_p, i, Item_p->Number);
+    CuAssertIntEquals(Test_p, TEST_ELEMENTS - 1 - i, OtherItem_p->Number);
+  }
+
+  ILIST_Destroy(&List);
+  ILIST_Destroy(&OtherList);
+}
+
+
+static CuSuite*
+Get_ILIST_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestInsertFirstLast);
+  SUITE_ADD_TEST(Suite_p, TestRemoveFirstLast);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecific);
+  SUITE_ADD_TEST(Suite_p, TestPrintAndDestroy);
+  SUITE_ADD_TEST(Suite_p, TestTwoListsOneItem);
+
+  return Suite_p;
+}
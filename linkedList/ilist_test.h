@@ -0,0 +1,26 @@
+#ifndef ILIST_TEST_H
+#define ILIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_ILIST_Tests(void);
+
+
+#endif // ILIST_TEST_H
@@ -0,0 +1,460 @@
+/* > Includes *****************************************************************/
+#include "lazylist.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+// Number of nodes a handle retires between attempts to advance the epoch
+#define RECLAIM_INTERVAL  64
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static LAZYLIST_Node_t*
+NewNode(const void *const Data_p);
+
+static void
+FreeNode(LAZYLIST_Node_t *const Node_p);
+
+static void
+ReclaimNode(const LAZYLIST_List_t *const List_p, LAZYLIST_Node_t *const Node_p);
+
+static void
+Enter(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p);
+
+static void
+Exit(LAZYLIST_Handle_t *const Handle_p);
+
+static void
+Retire(LAZYLIST_List_t *const List_p,
+       LAZYLIST_Handle_t *const Handle_p,
+       LAZYLIST_Node_t *const Node_p);
+
+static void
+TryAdvanceEpoch(LAZYLIST_List_t *const List_p);
+
+static void
+Reclaim(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p);
+
+static void
+Find(LAZYLIST_List_t *const List_p,
+     const void *const SearchData_p,
+     LAZYLIST_Node_t** Previous_pp,
+     LAZYLIST_Node_t** Current_pp);
+
+static bool
+Validate(LAZYLIST_Node_t *const Previous_p, LAZYLIST_Node_t *const Current_p);
+
+static bool
+IsEqual(const LAZYLIST_List_t *const List_p,
+        const LAZYLIST_Node_t *const Node_p,
+        const void *const SearchData_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+//
+// Head_p and Tail_p are sentinels without data; every search stops at
+// Tail_p. A node is reachable from Head_p exactly as long as it is not
+// marked, apart from the short window between marking and unlinking while
+// both neighbours are locked.
+//
+
+void
+LAZYLIST_Create(LAZYLIST_List_t *const List_p)
+{
+  List_p->Head_p = NewNode(NULL);
+  List_p->Tail_p = NewNode(NULL);
+  atomic_init(&List_p->Head_p->Next_p, List_p->Tail_p);
+  atomic_init(&List_p->Length, 0);
+  atomic_init(&List_p->Epoch, 0);
+  atomic_init(&List_p->Handles_p, NULL);
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+LAZYLIST_Destroy(LAZYLIST_List_t *const List_p)
+{
+  LAZYLIST_Node_t* node_p = atomic_load(&List_p->Head_p->Next_p);
+  while (node_p != List_p->Tail_p)
+  {
+    LAZYLIST_Node_t* next_p = atomic_load(&node_p->Next_p);
+    ReclaimNode(List_p, node_p);
+    node_p = next_p;
+  }
+  FreeNode(List_p->Head_p);
+  FreeNode(List_p->Tail_p);
+
+  LAZYLIST_Handle_t* handle_p = atomic_load(&List_p->Handles_p);
+  while (handle_p != NULL)
+  {
+    LAZYLIST_Handle_t* next_p = handle_p->Next_p;
+    LAZYLIST_Node_t* retired_p = handle_p->Retired_p;
+    while (retired_p != NULL)
+    {
+      LAZYLIST_Node_t* nextRetired_p = retired_p->RetiredNext_p;
+      ReclaimNode(List_p, retired_p);
+      retired_p = nextRetired_p;
+    }
+    free(handle_p);
+    handle_p = next_p;
+  }
+
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+  atomic_store(&List_p->Length, 0);
+  atomic_store(&List_p->Handles_p, NULL);
+}
+
+LAZYLIST_Handle_t*
+LAZYLIST_Register(LAZYLIST_List_t *const List_p)
+{
+  // Reuse a released handle if there is one
+  for (LAZYLIST_Handle_t* handle_p = atomic_load(&List_p->Handles_p);
+       handle_p != NULL;
+       handle_p = handle_p->Next_p)
+  {
+    bool inUse = false;
+    if (!atomic_load_explicit(&handle_p->InUse, memory_order_relaxed) &&
+        atomic_compare_exchange_strong(&handle_p->InUse, &inUse, true))
+    {
+      return handle_p;
+    }
+  }
+
+  LAZYLIST_Handle_t* newHandle = malloc(sizeof(LAZYLIST_Handle_t));
+  atomic_init(&newHandle->InUse, true);
+  atomic_init(&newHandle->Active, false);
+  atomic_init(&newHandle->LocalEpoch, 0);
+  newHandle->Retired_p = NULL;
+  newHandle->RetiredCount = 0;
+
+  LAZYLIST_Handle_t* head_p = atomic_load(&List_p->Handles_p);
+  do
+  {
+    newHandle->Next_p = head_p;
+  } while (!atomic_compare_exchange_weak(&List_p->Handles_p, &head_p, newHandle));
+
+  return newHandle;
+}
+
+void
+LAZYLIST_Unregister(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p)
+{
+  TryAdvanceEpoch(List_p);
+  Reclaim(List_p, Handle_p);
+  atomic_store(&Handle_p->InUse, false);
+}
+
+size_t
+LAZYLIST_Length(const LAZYLIST_List_t *const List_p)
+{
+  return atomic_load_explicit(&List_p->Length, memory_order_relaxed);
+}
+
+bool
+LAZYLIST_Insert(LAZYLIST_List_t *const List_p,
+                LAZYLIST_Handle_t *const Handle_p,
+                const void *const Data_p)
+{
+  bool inserted = false;
+
+  Enter(List_p, Handle_p);
+  for (;;)
+  {
+    LAZYLIST_Node_t* previous_p;
+    LAZYLIST_Node_t* current_p;
+    Find(List_p, Data_p, &previous_p, &current_p);
+
+    pthread_mutex_lock(&previous_p->Lock);
+    pthread_mutex_lock(&current_p->Lock);
+
+    bool valid = Validate(previous_p, current_p);
+    if (valid && !IsEqual(List_p, current_p, Data_p))
+    {
+      LAZYLIST_Node_t* newNode = NewNode(Data_p);
+      atomic_store_explicit(&newNode->Next_p, current_p, memory_order_relaxed);
+      atomic_store_explicit(&previous_p->Next_p, newNode, memory_order_release);
+      atomic_fetch_add_explicit(&List_p->Length, 1, memory_order_relaxed);
+      inserted = true;
+    }
+
+    pthread_mutex_unlock(&current_p->Lock);
+    pthread_mutex_unlock(&previous_p->Lock);
+
+    if (valid)
+    {
+      break;
+    }
+  }
+  Exit(Handle_p);
+
+  return inserted;
+}
+
+bool
+LAZYLIST_RemoveSpecific(LAZYLIST_List_t *const List_p,
+                        LAZYLIST_Handle_t *const Handle_p,
+                        const void* const SearchData_p)
+{
+  LAZYLIST_Node_t* removed_p = NULL;
+
+  Enter(List_p, Handle_p);
+  for (;;)
+  {
+    LAZYLIST_Node_t* previous_p;
+    LAZYLIST_Node_t* current_p;
+    Find(List_p, SearchData_p, &previous_p, &current_p);
+
+    pthread_mutex_lock(&previous_p->Lock);
+    pthread_mutex_lock(&current_p->Lock);
+
+    bool valid = Validate(previous_p, current_p);
+    if (valid && IsEqual(List_p, current_p, SearchData_p))
+    {
+      // Logical removal first, so that lock-free searches stop finding it
+      atomic_store_explicit(&current_p->Marked, true, memory_order_release);
+      atomic_store_explicit(&previous_p->Next_p,
+                            atomic_load_explicit(&current_p->Next_p, memory_order_relaxed),
+                            memory_order_release);
+      atomic_fetch_sub_explicit(&List_p->Length, 1, memory_order_relaxed);
+      removed_p = current_p;
+    }
+
+    pthread_mutex_unlock(&current_p->Lock);
+    pthread_mutex_unlock(&previous_p->Lock);
+
+    if (valid)
+    {
+      break;
+    }
+  }
+  Exit(Handle_p);
+
+  if (removed_p == NULL)
+  {
+    return false;
+  }
+  Retire(List_p, Handle_p, removed_p);
+  return true;
+}
+
+bool
+LAZYLIST_Contains(LAZYLIST_List_t *const List_p,
+                  LAZYLIST_Handle_t *const Handle_p,
+                  const void* const SearchData_p)
+{
+  LAZYLIST_Node_t* previous_p;
+  LAZYLIST_Node_t* current_p;
+
+  Enter(List_p, Handle_p);
+  Find(List_p, SearchData_p, &previous_p, &current_p);
+  bool found = IsEqual(List_p, current_p, SearchData_p) &&
+               !atomic_load_explicit(&current_p->Marked, memory_order_acquire);
+  Exit(Handle_p);
+
+  return found;
+}
+
+void
+LAZYLIST_Print(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p)
+{
+  Enter(List_p, Handle_p);
+  LAZYLIST_Node_t* print_p = atomic_load_explicit(&List_p->Head_p->Next_p,
+                                                  memory_order_acquire);
+  while (print_p != List_p->Tail_p)
+  {
+    if (!atomic_load_explicit(&print_p->Marked, memory_order_acquire))
+    {
+      List_p->Callbacks.DataPrint_fp(print_p->Data_p);
+    }
+    print_p = atomic_load_explicit(&print_p->Next_p, memory_order_acquire);
+  }
+  Exit(Handle_p);
+}
+
+void
+LAZYLIST_SetDestroyFunction(LAZYLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+LAZYLIST_SetPrintFunction(LAZYLIST_List_t *const List_p, DataPrint_t DataPrint_fp)
+{
+  List_p->Callbacks.DataPrint_fp = DataPrint_fp;
+}
+
+void
+LAZYLIST_SetCompareFunction(LAZYLIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static LAZYLIST_Node_t*
+NewNode(const void *const Data_p)
+{
+  LAZYLIST_Node_t* newNode = malloc(sizeof(LAZYLIST_Node_t));
+  newNode->Data_p = (void*)Data_p;
+  atomic_init(&newNode->Next_p, NULL);
+  atomic_init(&newNode->Marked, false);
+  pthread_mutex_init(&newNode->Lock, NULL);
+  newNode->RetiredNext_p = NULL;
+  newNode->RetiredEpoch = 0;
+  return newNode;
+}
+
+static void
+FreeNode(LAZYLIST_Node_t *const Node_p)
+{
+  pthread_mutex_destroy(&Node_p->Lock);
+  free(Node_p);
+}
+
+static void
+ReclaimNode(const LAZYLIST_List_t *const List_p, LAZYLIST_Node_t *const Node_p)
+{
+  if (List_p->Callbacks.DataDestroy_fp != NULL)
+  {
+    List_p->Callbacks.DataDestroy_fp(Node_p->Data_p);
+  }
+  FreeNode(Node_p);
+}
+
+// Starts a critical section: nodes reachable during it are not freed before
+// the matching Exit()
+static void
+Enter(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p)
+{
+  atomic_store(&Handle_p->Active, true);
+  atomic_store(&Handle_p->LocalEpoch, atomic_load(&List_p->Epoch));
+}
+
+static void
+Exit(LAZYLIST_Handle_t *const Handle_p)
+{
+  atomic_store_explicit(&Handle_p->Active, false, memory_order_release);
+}
+
+static void
+Retire(LAZYLIST_List_t *const List_p,
+       LAZYLIST_Handle_t *const Handle_p,
+       LAZYLIST_Node_t *const Node_p)
+{
+  Node_p->RetiredEpoch = atomic_load(&List_p->Epoch);
+  Node_p->RetiredNext_p = Handle_p->Retired_p;
+  Handle_p->Retired_p = Node_p;
+  Handle_p->RetiredCount++;
+
+  if (Handle_p->RetiredCount % RECLAIM_INTERVAL == 0)
+  {
+    TryAdvanceEpoch(List_p);
+    Reclaim(List_p, Handle_p);
+  }
+}
+
+// Moves the global epoch forward if every thread inside a critical section
+// has already observed the current one
+static void
+TryAdvanceEpoch(LAZYLIST_List_t *const List_p)
+{
+  uint_fast64_t epoch = atomic_load(&List_p->Epoch);
+
+  for (LAZYLIST_Handle_t* handle_p = atomic_load(&List_p->Handles_p);
+       handle_p != NULL;
+       handle_p = handle_p->Next_p)
+  {
+    if (atomic_load(&handle_p->Active) && atomic_load(&handle_p->LocalEpoch) != epoch)
+    {
+      return;
+    }
+  }
+  atomic_compare_exchange_strong(&List_p->Epoch, &epoch, epoch + 1);
+}
+
+// Frees the retired nodes of the handle that were retired at least two epochs
+// ago; no critical section can still refer to them
+static void
+Reclaim(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p)
+{
+  uint_fast64_t epoch = atomic_load(&List_p->Epoch);
+  LAZYLIST_Node_t** link_pp = &Handle_p->Retired_p;
+
+  while (*link_pp != NULL)
+  {
+    LAZYLIST_Node_t* node_p = *link_pp;
+    if (node_p->RetiredEpoch + 2 <= epoch)
+    {
+      *link_pp = node_p->RetiredNext_p;
+      ReclaimNode(List_p, node_p);
+      Handle_p->RetiredCount--;
+    }
+    else
+    {
+      link_pp = &node_p->RetiredNext_p;
+    }
+  }
+}
+
+// Finds the first node not less than SearchData_p and its predecessor,
+// without taking any lock
+static void
+Find(LAZYLIST_List_t *const List_p,
+     const void *const SearchData_p,
+     LAZYLIST_Node_t** Previous_pp,
+     LAZYLIST_Node_t** Current_pp)
+{
+  LAZYLIST_Node_t* previous_p = List_p->Head_p;
+  LAZYLIST_Node_t* current_p = atomic_load_explicit(&previous_p->Next_p,
+                                                    memory_order_acquire);
+
+  while (current_p != List_p->Tail_p &&
+         List_p->Callbacks.DataCompare_fp(current_p->Data_p, SearchData_p) < 0)
+  {
+    previous_p = current_p;
+    current_p = atomic_load_explicit(&current_p->Next_p, memory_order_acquire);
+  }
+
+  *Previous_pp = previous_p;
+  *Current_pp = current_p;
+}
+
+// Checks, with both nodes locked, that they are still adjacent and in the list
+static bool
+Validate(LAZYLIST_Node_t *const Previous_p, LAZYLIST_Node_t *const Current_p)
+{
+  return !atomic_load_explicit(&Previous_p->Marked, memory_order_relaxed) &&
+         !atomic_load_explicit(&Current_p->Marked, memory_order_relaxed) &&
+         atomic_load_explicit(&Previous_p->Next_p, memory_order_relaxed) == Current_p;
+}
+
+static bool
+IsEqual(const LAZYLIST_List_t *const List_p,
+        const LAZYLIST_Node_t *const Node_p,
+        const void *const SearchData_p)
+{
+  return Node_p != List_p->Tail_p &&
+         List_p->Callbacks.DataCompare_fp(Node_p->Data_p, SearchData_p) == 0;
+}
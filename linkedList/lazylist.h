@@ -0,0 +1,279 @@
+#ifndef LAZYLIST_H
+#define LAZYLIST_H
+
+/*
+ * Concurrent Sorted List with Lazy Synchronization
+ *
+ * Set of elements kept in the order given by DataCompare_fp, after Heller et
+ * al. Any number of threads may search, insert and remove at the same time.
+ * Searches take no locks; inserts and removes traverse optimistically, lock
+ * the two affected nodes and validate them before linking or unlinking.
+ * A removed node is first marked (logically deleted), then unlinked, and
+ * finally freed through epoch based reclamation once no thread can still be
+ * traversing it. Every thread registers a handle with the list and passes it
+ * to every operation.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition
+//
+
+typedef struct LAZYLIST_Node
+{
+  void*                          Data_p;
+  _Atomic(struct LAZYLIST_Node*) Next_p;
+  atomic_bool                    Marked;
+  pthread_mutex_t                Lock;
+  struct LAZYLIST_Node*          RetiredNext_p;
+  uint64_t                       RetiredEpoch;
+} LAZYLIST_Node_t;
+
+
+//
+// Per-thread Handle, holding the epoch state and retired nodes of the thread
+// that registered it
+//
+
+typedef struct LAZYLIST_Handle
+{
+  atomic_bool             InUse;
+  atomic_bool             Active;
+  atomic_uint_fast64_t    LocalEpoch;
+  struct LAZYLIST_Handle* Next_p;
+  LAZYLIST_Node_t*        Retired_p;
+  size_t                  RetiredCount;
+} LAZYLIST_Handle_t;
+
+
+//
+// List Definition
+//
+
+typedef struct LAZYLIST_List
+{
+  SLIST_Callbacks_t           Callbacks;
+  LAZYLIST_Node_t*            Head_p;
+  LAZYLIST_Node_t*            Tail_p;
+  atomic_size_t               Length;
+  atomic_uint_fast64_t        Epoch;
+  _Atomic(LAZYLIST_Handle_t*) Handles_p;
+} LAZYLIST_List_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates an empty list. The compare function must be set with
+ * LAZYLIST_SetCompareFunction() before the list is shared with other
+ * threads.
+ *
+ * @param[in]     List_p  The list to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_Create(LAZYLIST_List_t *const List_p);
+
+
+/**
+ * @brief Destroys a list
+ *
+ * Frees all nodes, including removed nodes awaiting reclamation, and all
+ * handles. The data in the list and the data of removed nodes not reclaimed
+ * yet is freed by the function set by LAZYLIST_SetDestroyFunction(). No other
+ * thread may use the list while it is destroyed.
+ *
+ * @param[in]     List_p  The list to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_Destroy(LAZYLIST_List_t *const List_p);
+
+
+/**
+ * @brief Registers the calling thread with the list
+ *
+ * Returns a handle that the thread passes to every operation on the list.
+ * Handles released by LAZYLIST_Unregister() are reused. A handle must not be
+ * used by two threads at the same time.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the handle
+ *
+ ******************************************************************************/
+LAZYLIST_Handle_t*
+LAZYLIST_Register(LAZYLIST_List_t *const List_p);
+
+
+/**
+ * @brief Releases a handle
+ *
+ * Makes the handle available to other threads. Its pending retired nodes
+ * are freed by whichever thread uses the handle next, or by
+ * LAZYLIST_Destroy().
+ *
+ * @param[in]     List_p    Pointer to the list
+ * @param[in]     Handle_p  Handle returned by LAZYLIST_Register()
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_Unregister(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p);
+
+
+/**
+ * @brief Returns the number of elements in the list
+ *
+ * The result may be outdated as soon as it is returned if other threads use
+ * the list.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+LAZYLIST_Length(const LAZYLIST_List_t *const List_p);
+
+
+/**
+ * @brief Inserts an item in order
+ *
+ * Inserts the data before the first element that compares greater. If an
+ * equal element is already in the list, nothing is inserted.
+ *
+ * @param[in]     List_p    Pointer to the list
+ * @param[in]     Handle_p  Handle of the calling thread
+ * @param[in]     Data_p    The data to insert
+ * @return        true if inserted, false if an equal element exists
+ *
+ ******************************************************************************/
+bool
+LAZYLIST_Insert(LAZYLIST_List_t *const List_p,
+                LAZYLIST_Handle_t *const Handle_p,
+                const void *const Data_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Removes the element that is equal to SearchData_p, according to the
+ * comparison function. Other threads may still be comparing against the
+ * removed data, so it is not returned; it is passed to the function set by
+ * LAZYLIST_SetDestroyFunction() once no thread can reach it any more.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     Handle_p      Handle of the calling thread
+ * @param[in]     SearchData_p  The data to remove
+ * @return        true if removed, false if not found
+ *
+ ******************************************************************************/
+bool
+LAZYLIST_RemoveSpecific(LAZYLIST_List_t *const List_p,
+                        LAZYLIST_Handle_t *const Handle_p,
+                        const void* const SearchData_p);
+
+
+/**
+ * @brief Checks if an item is in the list
+ *
+ * Searches the list without taking any lock.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     Handle_p      Handle of the calling thread
+ * @param[in]     SearchData_p  The data to search for
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+LAZYLIST_Contains(LAZYLIST_List_t *const List_p,
+                  LAZYLIST_Handle_t *const Handle_p,
+                  const void* const SearchData_p);
+
+
+/**
+ * @brief Print the list
+ *
+ * Calls the print function for every element that is not removed while the
+ * list is traversed.
+ *
+ * @param[in]     List_p    Pointer to the list
+ * @param[in]     Handle_p  Handle of the calling thread
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_Print(LAZYLIST_List_t *const List_p, LAZYLIST_Handle_t *const Handle_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * The function is applied to the data of removed nodes when they are
+ * reclaimed, and to the data left in the list by LAZYLIST_Destroy().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_SetDestroyFunction(LAZYLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets print function for the list
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     DataPrint_fp  Pointer to the print function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_SetPrintFunction(LAZYLIST_List_t *const List_p, DataPrint_t DataPrint_fp);
+
+
+/**
+ * @brief Sets comparison function for the list
+ *
+ * The function orders the list and follows the same rules as for
+ * SLIST_SetCompareFunction().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+LAZYLIST_SetCompareFunction(LAZYLIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+#endif // LAZYLIST_H
@@ -0,0 +1,184 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "bench.h"
+#include "lazylist.h"
+#include "lazylist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TOTAL_OPERATIONS  1000000
+#define KEY_RANGE         1024
+#define MAX_THREADS       16
+
+
+/* > Type Declarations  *******************************************************/
+
+// The list under test, shared by all threads of one run. With Coarse set,
+// every operation holds Lock, which serializes the list like a plain SLIST
+// behind a mutex.
+typedef struct SharedList
+{
+  LAZYLIST_List_t List;
+  pthread_mutex_t Lock;
+  bool            Coarse;
+  int             ReadPercent;
+  size_t          OperationsPerThread;
+} SharedList_t;
+
+typedef struct Worker
+{
+  SharedList_t* Shared_p;
+  unsigned int  Seed;
+} Worker_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const int ThreadCounts[] = { 1, 2, 4, 8, 16 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int Keys[KEY_RANGE];
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+RunMix(bool Coarse, int ReadPercent, int Threads);
+
+static void*
+WorkerThread(void* Arg_p);
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_LAZYLIST_Benchmarks(void)
+{
+  for (int i = 0; i < KEY_RANGE; i++)
+  {
+    Keys[i] = i;
+  }
+
+  printf("Sorted set, %d keys, contains/insert+remove mix\n", KEY_RANGE);
+  for (size_t i = 0; i < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); i++)
+  {
+    RunMix(true, 90, ThreadCounts[i]);
+    RunMix(false, 90, ThreadCounts[i]);
+    RunMix(true, 50, ThreadCounts[i]);
+    RunMix(false, 50, ThreadCounts[i]);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+RunMix(bool Coarse, int ReadPercent, int Threads)
+{
+  SharedList_t Shared;
+  pthread_t ThreadIds[MAX_THREADS];
+  Worker_t Workers[MAX_THREADS];
+  char Name[64];
+
+  LAZYLIST_Create(&Shared.List);
+  LAZYLIST_SetCompareFunction(&Shared.List, DataCompareInt);
+  pthread_mutex_init(&Shared.Lock, NULL);
+  Shared.Coarse = Coarse;
+  Shared.ReadPercent = ReadPercent;
+  Shared.OperationsPerThread = TOTAL_OPERATIONS / Threads;
+
+  // Start half full, the steady state of an even insert/remove mix
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&Shared.List);
+  for (int i = 0; i < KEY_RANGE; i += 2)
+  {
+    LAZYLIST_Insert(&Shared.List, Handle_p, &Keys[i]);
+  }
+  LAZYLIST_Unregister(&Shared.List, Handle_p);
+
+  uint64_t Start = BENCH_Now();
+  for (int t = 0; t < Threads; t++)
+  {
+    Workers[t].Shared_p = &Shared;
+    Workers[t].Seed = (unsigned int)t + 1;
+    pthread_create(&ThreadIds[t], NULL, WorkerThread, &Workers[t]);
+  }
+  for (int t = 0; t < Threads; t++)
+  {
+    pthread_join(ThreadIds[t], NULL);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Set/%s/%d%%read/T=%d",
+           Coarse ? "mutex" : "lazylist", ReadPercent, Threads);
+  BENCH_Report(Name, Shared.OperationsPerThread * Threads, Elapsed);
+
+  LAZYLIST_Destroy(&Shared.List);
+  pthread_mutex_destroy(&Shared.Lock);
+}
+
+static void*
+WorkerThread(void* Arg_p)
+{
+  Worker_t* Worker_p = Arg_p;
+  SharedList_t* Shared_p = Worker_p->Shared_p;
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&Shared_p->List);
+
+  for (size_t i = 0; i < Shared_p->OperationsPerThread; i++)
+  {
+    int* Key_p = &Keys[rand_r(&Worker_p->Seed) % KEY_RANGE];
+    int Choice = rand_r(&Worker_p->Seed) % 100;
+
+    if (Shared_p->Coarse)
+    {
+      pthread_mutex_lock(&Shared_p->Lock);
+    }
+
+    if (Choice < Shared_p->ReadPercent)
+    {
+      LAZYLIST_Contains(&Shared_p->List, Handle_p, Key_p);
+    }
+    else if (Choice % 2 == 0)
+    {
+      LAZYLIST_Insert(&Shared_p->List, Handle_p, Key_p);
+    }
+    else
+    {
+      LAZYLIST_RemoveSpecific(&Shared_p->List, Handle_p, Key_p);
+    }
+
+    if (Shared_p->Coarse)
+    {
+      pthread_mutex_unlock(&Shared_p->Lock);
+    }
+  }
+
+  LAZYLIST_Unregister(&Shared_p->List, Handle_p);
+  return NULL;
+}
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
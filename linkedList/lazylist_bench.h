@@ -0,0 +1,26 @@
+#ifndef LAZYLIST_BENCH_H
+#define LAZYLIST_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_LAZYLIST_Benchmarks(void);
+
+
+#endif // LAZYLIST_BENCH_H
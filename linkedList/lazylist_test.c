@@ -0,0 +1,406 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "CuTest.h"
+#include "lazylist.h"
+#include "lazylist_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define STRESS_THREADS         4
+#define STRESS_KEYS_PER_THREAD 2000
+#define STRESS_SHARED_KEYS     64
+#define STRESS_ROUNDS          20000
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct Worker
+{
+  LAZYLIST_List_t* List_p;
+  int*             Keys_p;
+  int*             SharedKeys_p;
+  unsigned int     Seed;
+  bool             Correct;
+} Worker_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static atomic_int DestroyCount;
+
+static char PrintBuffer[64];
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p);
+
+static void
+TestInsertKeepsOrder(CuTest* Test_p);
+
+static void
+TestInsertRejectsDuplicates(CuTest* Test_p);
+
+static void
+TestRemoveSpecific(CuTest* Test_p);
+
+static void
+TestDestroyFunction(CuTest* Test_p);
+
+static void
+TestHandlesAreReused(CuTest* Test_p);
+
+static void
+TestStressInsertRemoveContains(CuTest* Test_p);
+
+static CuSuite*
+Get_LAZYLIST_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_LAZYLIST_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_LAZYLIST_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+static void
+DataPrintInt(const void* const Data_p)
+{
+  size_t Used = strlen(PrintBuffer);
+  snprintf(PrintBuffer + Used, sizeof(PrintBuffer) - Used, "%d ", *(const int*)Data_p);
+}
+
+static void
+DataDestroy(void* const Data_p)
+{
+  atomic_fetch_add(&DestroyCount, 1);
+  free(Data_p);
+}
+
+static int*
+NewInt(int Value)
+{
+  int* Number_p = malloc(sizeof(int));
+  *Number_p = Value;
+  return Number_p;
+}
+
+static void*
+StressThread(void* Arg_p)
+{
+  Worker_t* Worker_p = Arg_p;
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(Worker_p->List_p);
+
+  // Private keys: every result is predictable
+  for (int i = 0; i < STRESS_KEYS_PER_THREAD; i++)
+  {
+    Worker_p->Correct &= LAZYLIST_Insert(Worker_p->List_p, Handle_p, &Worker_p->Keys_p[i]);
+  }
+  for (int i = 0; i < STRESS_KEYS_PER_THREAD; i += 2)
+  {
+    Worker_p->Correct &= LAZYLIST_RemoveSpecific(Worker_p->List_p, Handle_p,
+                                                 &Worker_p->Keys_p[i]);
+  }
+  for (int i = 0; i < STRESS_KEYS_PER_THREAD; i++)
+  {
+    bool expected = (i % 2 == 1);
+    Worker_p->Correct &= (LAZYLIST_Contains(Worker_p->List_p, Handle_p,
+                                            &Worker_p->Keys_p[i]) == expected);
+  }
+
+  // Shared keys: all threads fight over the same nodes
+  for (int r = 0; r < STRESS_ROUNDS; r++)
+  {
+    int* Key_p = &Worker_p->SharedKeys_p[rand_r(&Worker_p->Seed) % STRESS_SHARED_KEYS];
+    switch (rand_r(&Worker_p->Seed) % 3)
+    {
+      case 0:
+        LAZYLIST_Insert(Worker_p->List_p, Handle_p, Key_p);
+        break;
+      case 1:
+        LAZYLIST_RemoveSpecific(Worker_p->List_p, Handle_p, Key_p);
+        break;
+      default:
+        LAZYLIST_Contains(Worker_p->List_p, Handle_p, Key_p);
+        break;
+    }
+  }
+
+  LAZYLIST_Unregister(Worker_p->List_p, Handle_p);
+  return NULL;
+}
+
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+  int Key = 1;
+
+  LAZYLIST_Create(&List);
+  LAZYLIST_SetCompareFunction(&List, DataCompareInt);
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&List);
+
+  CuAssertTrue(Test_p, LAZYLIST_Length(&List) == 0);
+  CuAssertTrue(Test_p, LAZYLIST_Contains(&List, Handle_p, &Key) == false);
+  CuAssertTrue(Test_p, LAZYLIST_RemoveSpecific(&List, Handle_p, &Key) == false);
+
+  LAZYLIST_Unregister(&List, Handle_p);
+  LAZYLIST_Destroy(&List);
+}
+
+
+static void
+TestInsertKeepsOrder(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+  int Data[] = { 3, 1, 4, 5, 2 };
+
+  LAZYLIST_Create(&List);
+  LAZYLIST_SetCompareFunction(&List, DataCompareInt);
+  LAZYLIST_SetPrintFunction(&List, DataPrintInt);
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&List);
+
+  for (int i = 0; i < 5; i++)
+  {
+    CuAssertTrue(Test_p, LAZYLIST_Insert(&List, Handle_p, &Data[i]));
+  }
+  CuAssertTrue(Test_p, LAZYLIST_Length(&List) == 5);
+
+  PrintBuffer[0] = '\0';
+  LAZYLIST_Print(&List, Handle_p);
+  CuAssertStrEquals(Test_p, "1 2 3 4 5 ", PrintBuffer);
+
+  LAZYLIST_Unregister(&List, Handle_p);
+  LAZYLIST_Destroy(&List);
+}
+
+
+static void
+TestInsertRejectsDuplicates(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+  int Data[] = { 7, 7 };
+
+  LAZYLIST_Create(&List);
+  LAZYLIST_SetCompareFunction(&List, DataCompareInt);
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&List);
+
+  CuAssertTrue(Test_p, LAZYLIST_Insert(&List, Handle_p, &Data[0]) == true);
+  CuAssertTrue(Test_p, LAZYLIST_Insert(&List, Handle_p, &Data[1]) == false);
+  CuAssertTrue(Test_p, LAZYLIST_Length(&List) == 1);
+
+  LAZYLIST_Unregister(&List, Handle_p);
+  LAZYLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveSpecific(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+  int Data[] = { 1, 2, 3 };
+  int Missing = 4;
+
+  LAZYLIST_Create(&List);
+  LAZYLIST_SetCompareFunction(&List, DataCompareInt);
+  LAZYLIST_SetPrintFunction(&List, DataPrintInt);
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&List);
+
+  for (int i = 0; i < 3; i++)
+  {
+    LAZYLIST_Insert(&List, Handle_p, &Data[i]);
+  }
+
+  CuAssertTrue(Test_p, LAZYLIST_RemoveSpecific(&List, Handle_p, &Data[1]) == true);
+  CuAssertTrue(Test_p, LAZYLIST_RemoveSpecific(&List, Handle_p, &Data[1]) == false);
+  CuAssertTrue(Test_p, LAZYLIST_RemoveSpecific(&List, Handle_p, &Missing) == false);
+  CuAssertTrue(Test_p, LAZYLIST_Contains(&List, Handle_p, &Data[0]) == true);
+  CuAssertTrue(Test_p, LAZYLIST_Contains(&List, Handle_p, &Data[1]) == false);
+  CuAssertTrue(Test_p, LAZYLIST_Length(&List) == 2);
+
+  PrintBuffer[0] = '\0';
+  LAZYLIST_Print(&List, Handle_p);
+  CuAssertStrEquals(Test_p, "1 3 ", PrintBuffer);
+
+  // A removed element can be inserted again
+  CuAssertTrue(Test_p, LAZYLIST_Insert(&List, Handle_p, &Data[1]) == true);
+  CuAssertTrue(Test_p, LAZYLIST_Contains(&List, Handle_p, &Data[1]) == true);
+
+  LAZYLIST_Unregister(&List, Handle_p);
+  LAZYLIST_Destroy(&List);
+}
+
+
+static void
+TestDestroyFunction(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+  int Key = 2;
+
+  LAZYLIST_Create(&List);
+  LAZYLIST_SetCompareFunction(&List, DataCompareInt);
+  LAZYLIST_SetDestroyFunction(&List, DataDestroy);
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&List);
+
+  for (int i = 0; i < 5; i++)
+  {
+    LAZYLIST_Insert(&List, Handle_p, NewInt(i));
+  }
+  LAZYLIST_RemoveSpecific(&List, Handle_p, &Key);
+  LAZYLIST_Unregister(&List, Handle_p);
+
+  // Both the remaining and the removed data are destroyed exactly once
+  atomic_store(&DestroyCount, 0);
+  LAZYLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, 5, atomic_load(&DestroyCount));
+}
+
+
+static void
+TestHandlesAreReused(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+
+  LAZYLIST_Create(&List);
+
+  LAZYLIST_Handle_t* First_p = LAZYLIST_Register(&List);
+  LAZYLIST_Handle_t* Second_p = LAZYLIST_Register(&List);
+  CuAssertTrue(Test_p, First_p != Second_p);
+
+  LAZYLIST_Unregister(&List, First_p);
+  CuAssertPtrEquals(Test_p, First_p, LAZYLIST_Register(&List));
+
+  LAZYLIST_Unregister(&List, First_p);
+  LAZYLIST_Unregister(&List, Second_p);
+  LAZYLIST_Destroy(&List);
+}
+
+
+static void
+TestStressInsertRemoveContains(CuTest* Test_p)
+{
+  LAZYLIST_List_t List;
+  pthread_t Threads[STRESS_THREADS];
+  Worker_t Workers[STRESS_THREADS];
+  int* Keys_p = malloc(sizeof(int) * STRESS_THREADS * STRESS_KEYS_PER_THREAD);
+  int SharedKeys[STRESS_SHARED_KEYS];
+
+  LAZYLIST_Create(&List);
+  LAZYLIST_SetCompareFunction(&List, DataCompareInt);
+
+  // Interleave the private keys of the threads so that they share neighbours
+  for (int i = 0; i < STRESS_THREADS * STRESS_KEYS_PER_THREAD; i++)
+  {
+    int Thread = i % STRESS_THREADS;
+    Keys_p[Thread * STRESS_KEYS_PER_THREAD + i / STRESS_THREADS] = i;
+  }
+  for (int i = 0; i < STRESS_SHARED_KEYS; i++)
+  {
+    SharedKeys[i] = -1 - i;
+  }
+
+  for (int t = 0; t < STRESS_THREADS; t++)
+  {
+    Workers[t].List_p = &List;
+    Workers[t].Keys_p = &Keys_p[t * STRESS_KEYS_PER_THREAD];
+    Workers[t].SharedKeys_p = SharedKeys;
+    Workers[t].Seed = (unsigned int)t + 1;
+    Workers[t].Correct = true;
+    pthread_create(&Threads[t], NULL, StressThread, &Workers[t]);
+  }
+  for (int t = 0; t < STRESS_THREADS; t++)
+  {
+    pthread_join(Threads[t], NULL);
+    CuAssertTrue(Test_p, Workers[t].Correct);
+  }
+
+  // The list is sorted, holds no duplicates and agrees with Length
+  LAZYLIST_Handle_t* Handle_p = LAZYLIST_Register(&List);
+  size_t Count = 0;
+  bool Sorted = true;
+  LAZYLIST_Node_t* Node_p = atomic_load(&List.Head_p->Next_p);
+  while (Node_p != List.Tail_p)
+  {
+    LAZYLIST_Node_t* Next_p = atomic_load(&Node_p->Next_p);
+    if (Next_p != List.Tail_p && DataCompareInt(Node_p->Data_p, Next_p->Data_p) >= 0)
+    {
+      Sorted = false;
+    }
+    Count++;
+    Node_p = Next_p;
+  }
+  CuAssertTrue(Test_p, Sorted);
+  CuAssertTrue(Test_p, Count == LAZYLIST_Length(&List));
+
+  size_t SharedLeft = 0;
+  for (int i = 0; i < STRESS_SHARED_KEYS; i++)
+  {
+    SharedLeft += LAZYLIST_Contains(&List, Handle_p, &SharedKeys[i]);
+  }
+  CuAssertTrue(Test_p, Count == SharedLeft + STRESS_THREADS * STRESS_KEYS_PER_THREAD / 2);
+
+  LAZYLIST_Unregister(&List, Handle_p);
+  LAZYLIST_Destroy(&List);
+  free(Keys_p);
+}
+
+
+static CuSuite*
+Get_LAZYLIST_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestInsertKeepsOrder);
+  SUITE_ADD_TEST(Suite_p, TestInsertRejectsDuplicates);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecific);
+  SUITE_ADD_TEST(Suite_p, TestDestroyFunction);
+  SUITE_ADD_TEST(Suite_p, TestHandlesAreReused);
+  SUITE_ADD_TEST(Suite_p, TestStressInsertRemoveContains);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef LAZYLIST_TEST_H
+#define LAZYLIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_LAZYLIST_Tests(void);
+
+
+#endif // LAZYLIST_TEST_H
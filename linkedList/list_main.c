@@ -1,9 +1,43 @@
 #include <stdlib.h>
 #include "slist_test.h"
+#include "nodepool_test.h"
+#include "ulist_test.h"
+#include "dlist_test.h"
+#include "ilist_test.h"
+#include "mpscq_test.h"
+#include "mpmcq_test.h"
+#include "lazylist_test.h"
+#include "slist_typed_test.h"
+#include "slist_hpp_test.h"
+#include "threadpool_test.h"
+#include "slist_parallel_test.h"
+#include "skiplist_test.h"
+#include "idxlist_test.h"
+#include "slist_trace_test.h"
+#include "slist_replay_test.h"
+#include "slist_snapshot_test.h"
+#include "plist_test.h"
 
 int
 main(int argc, char* argv[])
 {
   Run_SLIST_Tests();
+  Run_NODEPOOL_Tests();
+  Run_ULIST_Tests();
+  Run_DLIST_Tests();
+  Run_ILIST_Tests();
+  Run_MPSCQ_Tests();
+  Run_MPMCQ_Tests();
+  Run_LAZYLIST_Tests();
+  Run_SLIST_TYPED_Tests();
+  Run_SLIST_HPP_Tests();
+  Run_THREADPOOL_Tests();
+  Run_SLIST_PARALLEL_Tests();
+  Run_SKIPLIST_Tests();
+  Run_IDXLIST_Tests();
+  Run_SLIST_TRACE_Tests();
+  Run_SLIST_REPLAY_Tests();
+  Run_SLIST_SNAPSHOT_Tests();
+  Run_PLIST_Tests();
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,349 @@
+/* > Includes *****************************************************************/
+#include "mpmcq.h"
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+// Minimum number of retired nodes collected before a handle scans the
+// hazard pointers, on top of the number of hazard pointers in use
+#define RETIRE_SCAN_SLACK  32
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static MPMCQ_Node_t*
+NewNode(const void *const Data_p);
+
+static MPMCQ_Node_t*
+Protect(_Atomic(MPMCQ_Node_t*) *const Source_p,
+        MPMCQ_Handle_t *const Handle_p,
+        int Slot);
+
+static void
+ClearHazards(MPMCQ_Handle_t *const Handle_p);
+
+static void
+Retire(MPMCQ_Queue_t *const Queue_p,
+       MPMCQ_Handle_t *const Handle_p,
+       MPMCQ_Node_t *const Node_p);
+
+static void
+Scan(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p);
+
+static bool
+IsHazardous(MPMCQ_Queue_t *const Queue_p, const MPMCQ_Node_t *const Node_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+//
+// Head_p always points at a dummy node whose data has already been handed
+// out. Tail_p may lag one node behind the real tail; every thread that
+// notices this helps to advance it.
+//
+
+void
+MPMCQ_Create(MPMCQ_Queue_t *const Queue_p)
+{
+  MPMCQ_Node_t* dummy_p = NewNode(NULL);
+
+  atomic_init(&Queue_p->Head_p, dummy_p);
+  atomic_init(&Queue_p->Tail_p, dummy_p);
+  atomic_init(&Queue_p->Handles_p, NULL);
+  atomic_init(&Queue_p->HandleCount, 0);
+  memset(&Queue_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+MPMCQ_Destroy(MPMCQ_Queue_t *const Queue_p)
+{
+  MPMCQ_Node_t* node_p = atomic_load(&Queue_p->Head_p);
+  bool isDummy = true;
+  while (node_p != NULL)
+  {
+    MPMCQ_Node_t* next_p = atomic_load_explicit(&node_p->Next_p, memory_order_relaxed);
+    if (!isDummy && Queue_p->Callbacks.DataDestroy_fp != NULL)
+    {
+      Queue_p->Callbacks.DataDestroy_fp(node_p->Data_p);
+    }
+    free(node_p);
+    isDummy = false;
+    node_p = next_p;
+  }
+
+  MPMCQ_Handle_t* handle_p = atomic_load(&Queue_p->Handles_p);
+  while (handle_p != NULL)
+  {
+    MPMCQ_Handle_t* next_p = handle_p->Next_p;
+    for (size_t i = 0; i < handle_p->RetiredCount; i++)
+    {
+      free(handle_p->Retired_pp[i]);
+    }
+    free(handle_p->Retired_pp);
+    free(handle_p);
+    handle_p = next_p;
+  }
+
+  atomic_store(&Queue_p->Head_p, NULL);
+  atomic_store(&Queue_p->Tail_p, NULL);
+  atomic_store(&Queue_p->Handles_p, NULL);
+  atomic_store(&Queue_p->HandleCount, 0);
+}
+
+MPMCQ_Handle_t*
+MPMCQ_Register(MPMCQ_Queue_t *const Queue_p)
+{
+  // Reuse a released handle if there is one
+  for (MPMCQ_Handle_t* handle_p = atomic_load(&Queue_p->Handles_p);
+       handle_p != NULL;
+       handle_p = handle_p->Next_p)
+  {
+    bool inactive = false;
+    if (!atomic_load_explicit(&handle_p->Active, memory_order_relaxed) &&
+        atomic_compare_exchange_strong(&handle_p->Active, &inactive, true))
+    {
+      return handle_p;
+    }
+  }
+
+  MPMCQ_Handle_t* newHandle = malloc(sizeof(MPMCQ_Handle_t));
+  for (int i = 0; i < MPMCQ_HAZARDS_PER_HANDLE; i++)
+  {
+    atomic_init(&newHandle->Hazard_p[i], NULL);
+  }
+  atomic_init(&newHandle->Active, true);
+  newHandle->Retired_pp = NULL;
+  newHandle->RetiredCount = 0;
+  newHandle->RetiredCapacity = 0;
+
+  // Handles are never unlinked before MPMCQ_Destroy(), so a plain push is
+  // safe against concurrent scans
+  MPMCQ_Handle_t* head_p = atomic_load(&Queue_p->Handles_p);
+  do
+  {
+    newHandle->Next_p = head_p;
+  } while (!atomic_compare_exchange_weak(&Queue_p->Handles_p, &head_p, newHandle));
+  atomic_fetch_add(&Queue_p->HandleCount, 1);
+
+  return newHandle;
+}
+
+void
+MPMCQ_Unregister(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p)
+{
+  ClearHazards(Handle_p);
+  Scan(Queue_p, Handle_p);
+  atomic_store(&Handle_p->Active, false);
+}
+
+bool
+MPMCQ_IsEmpty(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p)
+{
+  MPMCQ_Node_t* head_p = Protect(&Queue_p->Head_p, Handle_p, 0);
+  bool isEmpty = (atomic_load(&head_p->Next_p) == NULL);
+  ClearHazards(Handle_p);
+  return isEmpty;
+}
+
+void
+MPMCQ_InsertLast(MPMCQ_Queue_t *const Queue_p,
+                 MPMCQ_Handle_t *const Handle_p,
+                 const void *const Data_p)
+{
+  MPMCQ_Node_t* newNode = NewNode(Data_p);
+
+  for (;;)
+  {
+    MPMCQ_Node_t* tail_p = Protect(&Queue_p->Tail_p, Handle_p, 0);
+    MPMCQ_Node_t* next_p = atomic_load(&tail_p->Next_p);
+
+    if (tail_p != atomic_load(&Queue_p->Tail_p))
+    {
+      continue;
+    }
+
+    if (next_p != NULL)
+    {
+      // Tail_p is lagging behind, help the other thread
+      atomic_compare_exchange_strong(&Queue_p->Tail_p, &tail_p, next_p);
+      continue;
+    }
+
+    MPMCQ_Node_t* expected_p = NULL;
+    if (atomic_compare_exchange_strong(&tail_p->Next_p, &expected_p, newNode))
+    {
+      atomic_compare_exchange_strong(&Queue_p->Tail_p, &tail_p, newNode);
+      break;
+    }
+  }
+  ClearHazards(Handle_p);
+}
+
+void*
+MPMCQ_RemoveFirst(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p)
+{
+  MPMCQ_Node_t* head_p;
+  void* Data_p;
+
+  for (;;)
+  {
+    head_p = Protect(&Queue_p->Head_p, Handle_p, 0);
+    MPMCQ_Node_t* tail_p = atomic_load(&Queue_p->Tail_p);
+    MPMCQ_Node_t* next_p = atomic_load(&head_p->Next_p);
+    atomic_store(&Handle_p->Hazard_p[1], next_p);
+
+    // next_p is only known to be alive while head_p is still the head
+    if (head_p != atomic_load(&Queue_p->Head_p))
+    {
+      continue;
+    }
+
+    if (next_p == NULL)
+    {
+      ClearHazards(Handle_p);
+      return NULL;
+    }
+
+    if (head_p == tail_p)
+    {
+      atomic_compare_exchange_strong(&Queue_p->Tail_p, &tail_p, next_p);
+      continue;
+    }
+
+    Data_p = next_p->Data_p;
+    if (atomic_compare_exchange_strong(&Queue_p->Head_p, &head_p, next_p))
+    {
+      break;
+    }
+  }
+
+  ClearHazards(Handle_p);
+  Retire(Queue_p, Handle_p, head_p);
+  return Data_p;
+}
+
+void
+MPMCQ_SetDestroyFunction(MPMCQ_Queue_t *const Queue_p, DataDestroy_t DataDestroy_fp)
+{
+  Queue_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static MPMCQ_Node_t*
+NewNode(const void *const Data_p)
+{
+  MPMCQ_Node_t* newNode = malloc(sizeof(MPMCQ_Node_t));
+  atomic_init(&newNode->Next_p, NULL);
+  newNode->Data_p = (void*)Data_p;
+  return newNode;
+}
+
+// Publishes the node in *Source_p as hazardous and returns it once it is
+// known that the node was still reachable after publication
+static MPMCQ_Node_t*
+Protect(_Atomic(MPMCQ_Node_t*) *const Source_p,
+        MPMCQ_Handle_t *const Handle_p,
+        int Slot)
+{
+  MPMCQ_Node_t* node_p = atomic_load(Source_p);
+  for (;;)
+  {
+    atomic_store(&Handle_p->Hazard_p[Slot], node_p);
+    MPMCQ_Node_t* again_p = atomic_load(Source_p);
+    if (again_p == node_p)
+    {
+      return node_p;
+    }
+    node_p = again_p;
+  }
+}
+
+static void
+ClearHazards(MPMCQ_Handle_t *const Handle_p)
+{
+  for (int i = 0; i < MPMCQ_HAZARDS_PER_HANDLE; i++)
+  {
+    atomic_store_explicit(&Handle_p->Hazard_p[i], NULL, memory_order_release);
+  }
+}
+
+static void
+Retire(MPMCQ_Queue_t *const Queue_p,
+       MPMCQ_Handle_t *const Handle_p,
+       MPMCQ_Node_t *const Node_p)
+{
+  if (Handle_p->RetiredCount == Handle_p->RetiredCapacity)
+  {
+    Handle_p->RetiredCapacity = (Handle_p->RetiredCapacity != 0)
+                                  ? Handle_p->RetiredCapacity * 2
+                                  : RETIRE_SCAN_SLACK;
+    Handle_p->Retired_pp = realloc(Handle_p->Retired_pp,
+                                   Handle_p->RetiredCapacity * sizeof(MPMCQ_Node_t*));
+  }
+  Handle_p->Retired_pp[Handle_p->RetiredCount++] = Node_p;
+
+  size_t threshold = MPMCQ_HAZARDS_PER_HANDLE * atomic_load(&Queue_p->HandleCount)
+                     + RETIRE_SCAN_SLACK;
+  if (Handle_p->RetiredCount >= threshold)
+  {
+    Scan(Queue_p, Handle_p);
+  }
+}
+
+// Frees the retired nodes of the handle that no hazard pointer refers to
+static void
+Scan(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p)
+{
+  size_t kept = 0;
+  for (size_t i = 0; i < Handle_p->RetiredCount; i++)
+  {
+    MPMCQ_Node_t* node_p = Handle_p->Retired_pp[i];
+    if (IsHazardous(Queue_p, node_p))
+    {
+      Handle_p->Retired_pp[kept++] = node_p;
+    }
+    else
+    {
+      free(node_p);
+    }
+  }
+  Handle_p->RetiredCount = kept;
+}
+
+static bool
+IsHazardous(MPMCQ_Queue_t *const Queue_p, const MPMCQ_Node_t *const Node_p)
+{
+  for (MPMCQ_Handle_t* handle_p = atomic_load(&Queue_p->Handles_p);
+       handle_p != NULL;
+       handle_p = handle_p->Next_p)
+  {
+    for (int i = 0; i < MPMCQ_HAZARDS_PER_HANDLE; i++)
+    {
+      if (atomic_load(&handle_p->Hazard_p[i]) == Node_p)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
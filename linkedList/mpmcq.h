@@ -0,0 +1,205 @@
+#ifndef MPMCQ_H
+#define MPMCQ_H
+
+/*
+ * Lock-free Multi-Producer Multi-Consumer Queue
+ *
+ * Michael-Scott queue. Any number of threads may insert at the tail and
+ * remove from the head concurrently. Removed nodes are reclaimed with hazard
+ * pointers: every thread registers a handle with the queue and passes it to
+ * every operation, and a node is only freed once no handle protects it.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+#define MPMCQ_HAZARDS_PER_HANDLE  2
+
+// Keeps Head_p and Tail_p on separate cache lines
+#define MPMCQ_CACHE_LINE_SIZE     64
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition
+//
+
+typedef struct MPMCQ_Node
+{
+  _Atomic(struct MPMCQ_Node*) Next_p;
+  void*                       Data_p;
+} MPMCQ_Node_t;
+
+
+//
+// Per-thread Handle, holding the hazard pointers and retired nodes of the
+// thread that registered it
+//
+
+typedef struct MPMCQ_Handle
+{
+  _Atomic(MPMCQ_Node_t*) Hazard_p[MPMCQ_HAZARDS_PER_HANDLE];
+  atomic_bool            Active;
+  struct MPMCQ_Handle*   Next_p;
+  MPMCQ_Node_t**         Retired_pp;
+  size_t                 RetiredCount;
+  size_t                 RetiredCapacity;
+} MPMCQ_Handle_t;
+
+
+//
+// Queue Definition
+//
+
+typedef struct MPMCQ_Queue
+{
+  SLIST_Callbacks_t        Callbacks;
+  _Atomic(MPMCQ_Handle_t*) Handles_p;
+  atomic_size_t            HandleCount;
+  char                     HeadPadding[MPMCQ_CACHE_LINE_SIZE];
+  _Atomic(MPMCQ_Node_t*)   Head_p;
+  char                     TailPadding[MPMCQ_CACHE_LINE_SIZE];
+  _Atomic(MPMCQ_Node_t*)   Tail_p;
+  char                     EndPadding[MPMCQ_CACHE_LINE_SIZE];
+} MPMCQ_Queue_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new queue
+ *
+ * Creates an empty queue. The queue must not be used by other threads until
+ * this function returns.
+ *
+ * @param[in]     Queue_p  The queue to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPMCQ_Create(MPMCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Destroys a queue
+ *
+ * Frees all nodes left in the queue, all retired nodes and all handles. The
+ * data in the queue is freed by the function set by
+ * MPMCQ_SetDestroyFunction(). No other thread may use the queue while it is
+ * destroyed.
+ *
+ * @param[in]     Queue_p  The queue to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPMCQ_Destroy(MPMCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Registers the calling thread with the queue
+ *
+ * Returns a handle that the thread passes to every operation on the queue.
+ * Handles released by MPMCQ_Unregister() are reused. A handle must not be
+ * used by two threads at the same time.
+ *
+ * @param[in]     Queue_p  Pointer to the queue
+ * @return        Pointer to the handle
+ *
+ ******************************************************************************/
+MPMCQ_Handle_t*
+MPMCQ_Register(MPMCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Releases a handle
+ *
+ * Frees the retired nodes of the handle that are no longer protected and
+ * makes the handle available to other threads. The handle itself is freed by
+ * MPMCQ_Destroy().
+ *
+ * @param[in]     Queue_p   Pointer to the queue
+ * @param[in]     Handle_p  Handle returned by MPMCQ_Register()
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPMCQ_Unregister(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p);
+
+
+/**
+ * @brief Checks if the queue is empty
+ *
+ * The result may be outdated as soon as it is returned if other threads use
+ * the queue.
+ *
+ * @param[in]     Queue_p   Pointer to the queue
+ * @param[in]     Handle_p  Handle of the calling thread
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+MPMCQ_IsEmpty(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p);
+
+
+/**
+ * @brief Inserts an item last in the queue
+ *
+ * @param[in]     Queue_p   Pointer to the queue
+ * @param[in]     Handle_p  Handle of the calling thread
+ * @param[in]     Data_p    The data to insert, must not be NULL
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPMCQ_InsertLast(MPMCQ_Queue_t *const Queue_p,
+                 MPMCQ_Handle_t *const Handle_p,
+                 const void *const Data_p);
+
+
+/**
+ * @brief Removes the first item in the queue
+ *
+ * @param[in]     Queue_p   Pointer to the queue
+ * @param[in]     Handle_p  Handle of the calling thread
+ * @return        Pointer to the removed data, or NULL if the queue is empty
+ *
+ ******************************************************************************/
+void*
+MPMCQ_RemoveFirst(MPMCQ_Queue_t *const Queue_p, MPMCQ_Handle_t *const Handle_p);
+
+
+/**
+ * @brief Sets destroy function for the queue
+ *
+ * The function is applied to the data left in the queue by MPMCQ_Destroy().
+ *
+ * @param[in]     Queue_p         Pointer to the queue
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPMCQ_SetDestroyFunction(MPMCQ_Queue_t *const Queue_p, DataDestroy_t DataDestroy_fp);
+
+
+#endif // MPMCQ_H
@@ -0,0 +1,311 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "CuTest.h"
+#include "mpmcq.h"
+#include "mpmcq_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define STRESS_PRODUCERS           4
+#define STRESS_CONSUMERS           4
+#define STRESS_ITEMS_PER_PRODUCER  100000
+#define STRESS_ITEMS               (STRESS_PRODUCERS * STRESS_ITEMS_PER_PRODUCER)
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct Item
+{
+  int        Producer;
+  int        Sequence;
+  atomic_int Seen;
+} Item_t;
+
+typedef struct Worker
+{
+  MPMCQ_Queue_t* Queue_p;
+  Item_t*        Items_p;
+  atomic_int*    Received_p;
+  bool           InOrder;
+} Worker_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int DestroyCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyQueue(CuTest* Test_p);
+
+static void
+TestFifoOrder(CuTest* Test_p);
+
+static void
+TestDestroyFunction(CuTest* Test_p);
+
+static void
+TestHandlesAreReused(CuTest* Test_p);
+
+static void
+TestStressProducersConsumers(CuTest* Test_p);
+
+static CuSuite*
+Get_MPMCQ_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_MPMCQ_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_MPMCQ_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+DataDestroy(void* const Data_p)
+{
+  DestroyCount++;
+  free(Data_p);
+}
+
+static void*
+ProducerThread(void* Arg_p)
+{
+  Worker_t* Worker_p = Arg_p;
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(Worker_p->Queue_p);
+
+  for (int i = 0; i < STRESS_ITEMS_PER_PRODUCER; i++)
+  {
+    MPMCQ_InsertLast(Worker_p->Queue_p, Handle_p, &Worker_p->Items_p[i]);
+  }
+
+  MPMCQ_Unregister(Worker_p->Queue_p, Handle_p);
+  return NULL;
+}
+
+static void*
+ConsumerThread(void* Arg_p)
+{
+  Worker_t* Worker_p = Arg_p;
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(Worker_p->Queue_p);
+  int LastSequence[STRESS_PRODUCERS];
+
+  for (int p = 0; p < STRESS_PRODUCERS; p++)
+  {
+    LastSequence[p] = -1;
+  }
+
+  while (atomic_load(Worker_p->Received_p) < STRESS_ITEMS)
+  {
+    Item_t* Item_p = MPMCQ_RemoveFirst(Worker_p->Queue_p, Handle_p);
+    if (Item_p == NULL)
+    {
+      continue;
+    }
+
+    // A consumer sees the items of one producer in increasing order
+    if (Item_p->Sequence <= LastSequence[Item_p->Producer])
+    {
+      Worker_p->InOrder = false;
+    }
+    LastSequence[Item_p->Producer] = Item_p->Sequence;
+    atomic_fetch_add(&Item_p->Seen, 1);
+    atomic_fetch_add(Worker_p->Received_p, 1);
+  }
+
+  MPMCQ_Unregister(Worker_p->Queue_p, Handle_p);
+  return NULL;
+}
+
+
+static void
+TestCreateDestroyEmptyQueue(CuTest* Test_p)
+{
+  MPMCQ_Queue_t Queue;
+
+  MPMCQ_Create(&Queue);
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(&Queue);
+
+  CuAssertTrue(Test_p, MPMCQ_IsEmpty(&Queue, Handle_p) == true);
+  CuAssertPtrEquals(Test_p, NULL, MPMCQ_RemoveFirst(&Queue, Handle_p));
+
+  MPMCQ_Unregister(&Queue, Handle_p);
+  MPMCQ_Destroy(&Queue);
+}
+
+
+static void
+TestFifoOrder(CuTest* Test_p)
+{
+  MPMCQ_Queue_t Queue;
+  int Data[] = { 1, 2, 3 };
+
+  MPMCQ_Create(&Queue);
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(&Queue);
+
+  MPMCQ_InsertLast(&Queue, Handle_p, &Data[0]);
+  MPMCQ_InsertLast(&Queue, Handle_p, &Data[1]);
+  CuAssertTrue(Test_p, MPMCQ_IsEmpty(&Queue, Handle_p) == false);
+  CuAssertIntEquals(Test_p, 1, *(int*)MPMCQ_RemoveFirst(&Queue, Handle_p));
+
+  MPMCQ_InsertLast(&Queue, Handle_p, &Data[2]);
+  CuAssertIntEquals(Test_p, 2, *(int*)MPMCQ_RemoveFirst(&Queue, Handle_p));
+  CuAssertIntEquals(Test_p, 3, *(int*)MPMCQ_RemoveFirst(&Queue, Handle_p));
+  CuAssertPtrEquals(Test_p, NULL, MPMCQ_RemoveFirst(&Queue, Handle_p));
+
+  MPMCQ_Unregister(&Queue, Handle_p);
+  MPMCQ_Destroy(&Queue);
+}
+
+
+static void
+TestDestroyFunction(CuTest* Test_p)
+{
+  MPMCQ_Queue_t Queue;
+
+  MPMCQ_Create(&Queue);
+  MPMCQ_SetDestroyFunction(&Queue, DataDestroy);
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(&Queue);
+
+  for (int i = 0; i < 5; i++)
+  {
+    MPMCQ_InsertLast(&Queue, Handle_p, malloc(sizeof(int)));
+  }
+  free(MPMCQ_RemoveFirst(&Queue, Handle_p));
+  MPMCQ_Unregister(&Queue, Handle_p);
+
+  DestroyCount = 0;
+  MPMCQ_Destroy(&Queue);
+  CuAssertIntEquals(Test_p, 4, DestroyCount);
+}
+
+
+static void
+TestHandlesAreReused(CuTest* Test_p)
+{
+  MPMCQ_Queue_t Queue;
+
+  MPMCQ_Create(&Queue);
+
+  MPMCQ_Handle_t* First_p = MPMCQ_Register(&Queue);
+  MPMCQ_Handle_t* Second_p = MPMCQ_Register(&Queue);
+  CuAssertTrue(Test_p, First_p != Second_p);
+
+  MPMCQ_Unregister(&Queue, First_p);
+  CuAssertPtrEquals(Test_p, First_p, MPMCQ_Register(&Queue));
+  CuAssertTrue(Test_p, atomic_load(&Queue.HandleCount) == 2);
+
+  MPMCQ_Unregister(&Queue, First_p);
+  MPMCQ_Unregister(&Queue, Second_p);
+  MPMCQ_Destroy(&Queue);
+}
+
+
+static void
+TestStressProducersConsumers(CuTest* Test_p)
+{
+  MPMCQ_Queue_t Queue;
+  pthread_t Producers[STRESS_PRODUCERS];
+  pthread_t Consumers[STRESS_CONSUMERS];
+  Worker_t ProducerWorkers[STRESS_PRODUCERS];
+  Worker_t ConsumerWorkers[STRESS_CONSUMERS];
+  atomic_int Received;
+  Item_t* Items_p = malloc(sizeof(Item_t) * STRESS_ITEMS);
+
+  MPMCQ_Create(&Queue);
+  atomic_init(&Received, 0);
+
+  for (int i = 0; i < STRESS_ITEMS; i++)
+  {
+    Items_p[i].Producer = i / STRESS_ITEMS_PER_PRODUCER;
+    Items_p[i].Sequence = i % STRESS_ITEMS_PER_PRODUCER;
+    atomic_init(&Items_p[i].Seen, 0);
+  }
+
+  for (int c = 0; c < STRESS_CONSUMERS; c++)
+  {
+    ConsumerWorkers[c].Queue_p = &Queue;
+    ConsumerWorkers[c].Items_p = NULL;
+    ConsumerWorkers[c].Received_p = &Received;
+    ConsumerWorkers[c].InOrder = true;
+    pthread_create(&Consumers[c], NULL, ConsumerThread, &ConsumerWorkers[c]);
+  }
+  for (int p = 0; p < STRESS_PRODUCERS; p++)
+  {
+    ProducerWorkers[p].Queue_p = &Queue;
+    ProducerWorkers[p].Items_p = &Items_p[p * STRESS_ITEMS_PER_PRODUCER];
+    ProducerWorkers[p].Received_p = &Received;
+    pthread_create(&Producers[p], NULL, ProducerThread, &ProducerWorkers[p]);
+  }
+
+  for (int p = 0; p < STRESS_PRODUCERS; p++)
+  {
+    pthread_join(Producers[p], NULL);
+  }
+  for (int c = 0; c < STRESS_CONSUMERS; c++)
+  {
+    pthread_join(Consumers[c], NULL);
+    CuAssertTrue(Test_p, ConsumerWorkers[c].InOrder);
+  }
+
+  // Every item was handed out exactly once
+  int SeenOnce = 0;
+  for (int i = 0; i < STRESS_ITEMS; i++)
+  {
+    SeenOnce += (atomic_load(&Items_p[i].Seen) == 1);
+  }
+  CuAssertIntEquals(Test_p, STRESS_ITEMS, SeenOnce);
+
+  MPMCQ_Destroy(&Queue);
+  free(Items_p);
+}
+
+
+static CuSuite*
+Get_MPMCQ_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyQueue);
+  SUITE_ADD_TEST(Suite_p, TestFifoOrder);
+  SUITE_ADD_TEST(Suite_p, TestDestroyFunction);
+  SUITE_ADD_TEST(Suite_p, TestHandlesAreReused);
+  SUITE_ADD_TEST(Suite_p, TestStressProducersConsumers);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef MPMCQ_TEST_H
+#define MPMCQ_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_MPMCQ_Tests(void);
+
+
+#endif // MPMCQ_TEST_H
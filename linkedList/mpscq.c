@@ -0,0 +1,117 @@
+/* > Includes *****************************************************************/
+#include "mpscq.h"
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static MPSCQ_Node_t*
+NewNode(const void *const Data_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+//
+// Head_p always points at a dummy node whose data has already been handed
+// out. Producers swing Tail_p to their node first and link the previous tail
+// to it afterwards, so between the two steps the consumer sees the queue end
+// early and reports it as empty.
+//
+
+void
+MPSCQ_Create(MPSCQ_Queue_t *const Queue_p)
+{
+  MPSCQ_Node_t* dummy_p = NewNode(NULL);
+
+  Queue_p->Head_p = dummy_p;
+  atomic_init(&Queue_p->Tail_p, dummy_p);
+  memset(&Queue_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+MPSCQ_Destroy(MPSCQ_Queue_t *const Queue_p)
+{
+  void* Data_p;
+  while ((Data_p = MPSCQ_RemoveFirst(Queue_p)) != NULL)
+  {
+    if (Queue_p->Callbacks.DataDestroy_fp != NULL)
+    {
+      Queue_p->Callbacks.DataDestroy_fp(Data_p);
+    }
+  }
+  free(Queue_p->Head_p);
+  Queue_p->Head_p = NULL;
+  atomic_store_explicit(&Queue_p->Tail_p, NULL, memory_order_relaxed);
+}
+
+bool
+MPSCQ_IsEmpty(const MPSCQ_Queue_t *const Queue_p)
+{
+  return (atomic_load_explicit(&Queue_p->Head_p->Next_p, memory_order_acquire) == NULL);
+}
+
+void
+MPSCQ_InsertLast(MPSCQ_Queue_t *const Queue_p, const void *const Data_p)
+{
+  MPSCQ_Node_t* newNode = NewNode(Data_p);
+
+  MPSCQ_Node_t* previous_p = atomic_exchange_explicit(&Queue_p->Tail_p, newNode,
+                                                      memory_order_acq_rel);
+  atomic_store_explicit(&previous_p->Next_p, newNode, memory_order_release);
+}
+
+void*
+MPSCQ_RemoveFirst(MPSCQ_Queue_t *const Queue_p)
+{
+  MPSCQ_Node_t* dummy_p = Queue_p->Head_p;
+  MPSCQ_Node_t* next_p = atomic_load_explicit(&dummy_p->Next_p, memory_order_acquire);
+
+  if (next_p == NULL)
+  {
+    return NULL;
+  }
+
+  // The first node becomes the new dummy once its data is taken
+  void* Data_p = next_p->Data_p;
+  Queue_p->Head_p = next_p;
+  free(dummy_p);
+  return Data_p;
+}
+
+void
+MPSCQ_SetDestroyFunction(MPSCQ_Queue_t *const Queue_p, DataDestroy_t DataDestroy_fp)
+{
+  Queue_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static MPSCQ_Node_t*
+NewNode(const void *const Data_p)
+{
+  MPSCQ_Node_t* newNode = malloc(sizeof(MPSCQ_Node_t));
+  atomic_init(&newNode->Next_p, NULL);
+  newNode->Data_p = (void*)Data_p;
+  return newNode;
+}
@@ -0,0 +1,145 @@
+#ifndef MPSCQ_H
+#define MPSCQ_H
+
+/*
+ * Lock-free Multi-Producer Single-Consumer Queue
+ *
+ * Node based queue after Dmitry Vyukov. Any number of threads may insert at
+ * the tail concurrently; a single thread at a time removes from the head.
+ * Inserting takes one atomic exchange and never waits for other threads.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition
+//
+
+typedef struct MPSCQ_Node
+{
+  _Atomic(struct MPSCQ_Node*) Next_p;
+  void*                       Data_p;
+} MPSCQ_Node_t;
+
+
+//
+// Queue Definition
+//
+
+typedef struct MPSCQ_Queue
+{
+  SLIST_Callbacks_t      Callbacks;
+  MPSCQ_Node_t*          Head_p;
+  _Atomic(MPSCQ_Node_t*) Tail_p;
+} MPSCQ_Queue_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new queue
+ *
+ * Creates an empty queue. The queue must not be used by other threads until
+ * this function returns.
+ *
+ * @param[in]     Queue_p  The queue to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPSCQ_Create(MPSCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Destroys a queue
+ *
+ * Frees all nodes left in the queue. The data in the queue is freed by the
+ * function set by MPSCQ_SetDestroyFunction(). No other thread may use the
+ * queue while it is destroyed.
+ *
+ * @param[in]     Queue_p  The queue to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPSCQ_Destroy(MPSCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Checks if the queue is empty
+ *
+ * May only be called by the consumer. An insert that has not completed yet
+ * is not visible.
+ *
+ * @param[in]     Queue_p  Pointer to the queue
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+MPSCQ_IsEmpty(const MPSCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Inserts an item last in the queue
+ *
+ * May be called by any number of threads concurrently.
+ *
+ * @param[in]     Queue_p  Pointer to the queue
+ * @param[in]     Data_p   The data to insert, must not be NULL
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPSCQ_InsertLast(MPSCQ_Queue_t *const Queue_p, const void *const Data_p);
+
+
+/**
+ * @brief Removes the first item in the queue
+ *
+ * May only be called by one thread at a time. Returns NULL when the queue is
+ * empty, or when the oldest insert is still in progress on another thread.
+ *
+ * @param[in]     Queue_p  Pointer to the queue
+ * @return        Pointer to the removed data, or NULL
+ *
+ ******************************************************************************/
+void*
+MPSCQ_RemoveFirst(MPSCQ_Queue_t *const Queue_p);
+
+
+/**
+ * @brief Sets destroy function for the queue
+ *
+ * The function is applied to the data left in the queue by MPSCQ_Destroy().
+ *
+ * @param[in]     Queue_p         Pointer to the queue
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+MPSCQ_SetDestroyFunction(MPSCQ_Queue_t *const Queue_p, DataDestroy_t DataDestroy_fp);
+
+
+#endif // MPSCQ_H
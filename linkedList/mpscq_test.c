@@ -0,0 +1,227 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "CuTest.h"
+#include "mpscq.h"
+#include "mpscq_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define STRESS_PRODUCERS           4
+#define STRESS_ITEMS_PER_PRODUCER  100000
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct Item
+{
+  int Producer;
+  int Sequence;
+} Item_t;
+
+typedef struct Producer
+{
+  MPSCQ_Queue_t* Queue_p;
+  Item_t*        Items_p;
+} Producer_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int DestroyCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyQueue(CuTest* Test_p);
+
+static void
+TestFifoOrder(CuTest* Test_p);
+
+static void
+TestDestroyFunction(CuTest* Test_p);
+
+static void
+TestStressProducers(CuTest* Test_p);
+
+static CuSuite*
+Get_MPSCQ_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_MPSCQ_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_MPSCQ_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+DataDestroy(void* const Data_p)
+{
+  DestroyCount++;
+  free(Data_p);
+}
+
+static void*
+ProducerThread(void* Arg_p)
+{
+  Producer_t* Producer_p = Arg_p;
+  for (int i = 0; i < STRESS_ITEMS_PER_PRODUCER; i++)
+  {
+    MPSCQ_InsertLast(Producer_p->Queue_p, &Producer_p->Items_p[i]);
+  }
+  return NULL;
+}
+
+
+static void
+TestCreateDestroyEmptyQueue(CuTest* Test_p)
+{
+  MPSCQ_Queue_t Queue;
+
+  MPSCQ_Create(&Queue);
+
+  CuAssertTrue(Test_p, MPSCQ_IsEmpty(&Queue) == true);
+  CuAssertPtrEquals(Test_p, NULL, MPSCQ_RemoveFirst(&Queue));
+
+  MPSCQ_Destroy(&Queue);
+}
+
+
+static void
+TestFifoOrder(CuTest* Test_p)
+{
+  MPSCQ_Queue_t Queue;
+  int Data[] = { 1, 2, 3 };
+
+  MPSCQ_Create(&Queue);
+
+  MPSCQ_InsertLast(&Queue, &Data[0]);
+  MPSCQ_InsertLast(&Queue, &Data[1]);
+  CuAssertTrue(Test_p, MPSCQ_IsEmpty(&Queue) == false);
+  CuAssertIntEquals(Test_p, 1, *(int*)MPSCQ_RemoveFirst(&Queue));
+
+  MPSCQ_InsertLast(&Queue, &Data[2]);
+  CuAssertIntEquals(Test_p, 2, *(int*)MPSCQ_RemoveFirst(&Queue));
+  CuAssertIntEquals(Test_p, 3, *(int*)MPSCQ_RemoveFirst(&Queue));
+  CuAssertPtrEquals(Test_p, NULL, MPSCQ_RemoveFirst(&Queue));
+  CuAssertTrue(Test_p, MPSCQ_IsEmpty(&Queue) == true);
+
+  MPSCQ_Destroy(&Queue);
+}
+
+
+static void
+TestDestroyFunction(CuTest* Test_p)
+{
+  MPSCQ_Queue_t Queue;
+
+  MPSCQ_Create(&Queue);
+  MPSCQ_SetDestroyFunction(&Queue, DataDestroy);
+
+  for (int i = 0; i < 5; i++)
+  {
+    MPSCQ_InsertLast(&Queue, malloc(sizeof(int)));
+  }
+
+  DestroyCount = 0;
+  MPSCQ_Destroy(&Queue);
+  CuAssertIntEquals(Test_p, 5, DestroyCount);
+}
+
+
+static void
+TestStressProducers(CuTest* Test_p)
+{
+  MPSCQ_Queue_t Queue;
+  pthread_t Threads[STRESS_PRODUCERS];
+  Producer_t Producers[STRESS_PRODUCERS];
+  int NextSequence[STRESS_PRODUCERS] = { 0 };
+  Item_t* Items_p = malloc(sizeof(Item_t) * STRESS_PRODUCERS * STRESS_ITEMS_PER_PRODUCER);
+
+  MPSCQ_Create(&Queue);
+
+  for (int p = 0; p < STRESS_PRODUCERS; p++)
+  {
+    Producers[p].Queue_p = &Queue;
+    Producers[p].Items_p = &Items_p[p * STRESS_ITEMS_PER_PRODUCER];
+    for (int i = 0; i < STRESS_ITEMS_PER_PRODUCER; i++)
+    {
+      Producers[p].Items_p[i].Producer = p;
+      Producers[p].Items_p[i].Sequence = i;
+    }
+    pthread_create(&Threads[p], NULL, ProducerThread, &Producers[p]);
+  }
+
+  // Every item arrives exactly once, in the order of its producer
+  int Received = 0;
+  bool InOrder = true;
+  while (Received < STRESS_PRODUCERS * STRESS_ITEMS_PER_PRODUCER)
+  {
+    Item_t* Item_p = MPSCQ_RemoveFirst(&Queue);
+    if (Item_p == NULL)
+    {
+      continue;
+    }
+    InOrder = InOrder && (Item_p->Sequence == NextSequence[Item_p->Producer]);
+    NextSequence[Item_p->Producer]++;
+    Received++;
+  }
+
+  for (int p = 0; p < STRESS_PRODUCERS; p++)
+  {
+    pthread_join(Threads[p], NULL);
+  }
+
+  CuAssertTrue(Test_p, InOrder);
+  CuAssertTrue(Test_p, MPSCQ_IsEmpty(&Queue) == true);
+
+  MPSCQ_Destroy(&Queue);
+  free(Items_p);
+}
+
+
+static CuSuite*
+Get_MPSCQ_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyQueue);
+  SUITE_ADD_TEST(Suite_p, TestFifoOrder);
+  SUITE_ADD_TEST(Suite_p, TestDestroyFunction);
+  SUITE_ADD_TEST(Suite_p, TestStressProducers);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef MPSCQ_TEST_H
+#define MPSCQ_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_MPSCQ_Tests(void);
+
+
+#endif // MPSCQ_TEST_H
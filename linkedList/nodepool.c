@@ -0,0 +1,198 @@
+/* > Includes *****************************************************************/
+#include "nodepool.h"
+#include <stdlib.h>
+#include <stddef.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+// Used to find the first suitably aligned address after the slab header
+typedef struct SlabLayout
+{
+  NODEPOOL_Slab_t Header;
+  max_align_t     Blocks;
+} SlabLayout_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t SlabHeaderSize = offsetof(SlabLayout_t, Blocks);
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static bool
+AllocSlab(NODEPOOL_Pool_t *const Pool_p, size_t BlockCount);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+NODEPOOL_Create(NODEPOOL_Pool_t *const Pool_p,
+                size_t BlockSize,
+                size_t BlocksPerSlab)
+{
+  // Every block must be able to hold the free list link and keep the
+  // following block pointer aligned
+  if (BlockSize < sizeof(NODEPOOL_Block_t))
+  {
+    BlockSize = sizeof(NODEPOOL_Block_t);
+  }
+  BlockSize = (BlockSize + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+  Pool_p->BlockSize = BlockSize;
+  Pool_p->BlocksPerSlab = (BlocksPerSlab != 0) ? BlocksPerSlab
+                                               : NODEPOOL_DEFAULT_BLOCKS_PER_SLAB;
+  Pool_p->Slabs_p = NULL;
+  Pool_p->Free_p = NULL;
+  Pool_p->Carve_p = NULL;
+  Pool_p->CarveEnd_p = NULL;
+  Pool_p->References = 1;
+}
+
+void
+NODEPOOL_Destroy(NODEPOOL_Pool_t *const Pool_p)
+{
+  NODEPOOL_Slab_t* slab_p = Pool_p->Slabs_p;
+  while (slab_p != NULL)
+  {
+    NODEPOOL_Slab_t* next_p = slab_p->Next_p;
+    free(slab_p);
+    slab_p = next_p;
+  }
+  Pool_p->Slabs_p = NULL;
+  Pool_p->Free_p = NULL;
+  Pool_p->Carve_p = NULL;
+  Pool_p->CarveEnd_p = NULL;
+}
+
+void*
+NODEPOOL_Alloc(NODEPOOL_Pool_t *const Pool_p)
+{
+  NODEPOOL_Block_t* block_p = Pool_p->Free_p;
+  if (block_p != NULL)
+  {
+    Pool_p->Free_p = block_p->Next_p;
+    return block_p;
+  }
+
+  if (Pool_p->Carve_p == Pool_p->CarveEnd_p &&
+      !AllocSlab(Pool_p, Pool_p->BlocksPerSlab))
+  {
+    return NULL;
+  }
+
+  block_p = (NODEPOOL_Block_t*)Pool_p->Carve_p;
+  Pool_p->Carve_p += Pool_p->BlockSize;
+  return block_p;
+}
+
+NODEPOOL_Block_t*
+NODEPOOL_AllocChain(NODEPOOL_Pool_t *const Pool_p, size_t Count)
+{
+  NODEPOOL_Block_t* chain_p = NULL;
+  NODEPOOL_Block_t** link_pp = &chain_p;
+  size_t taken = 0;
+
+  while (taken < Count && Pool_p->Free_p != NULL)
+  {
+    *link_pp = Pool_p->Free_p;
+    link_pp = &Pool_p->Free_p->Next_p;
+    Pool_p->Free_p = Pool_p->Free_p->Next_p;
+    taken++;
+  }
+
+  // The rest of the current slab is used up first, then one new slab holds
+  // all blocks still missing
+  size_t carvable = (size_t)(Pool_p->CarveEnd_p - Pool_p->Carve_p) / Pool_p->BlockSize;
+  if (Count - taken > carvable)
+  {
+    size_t missing = Count - taken - carvable;
+    while (Pool_p->Carve_p != Pool_p->CarveEnd_p)
+    {
+      *link_pp = (NODEPOOL_Block_t*)Pool_p->Carve_p;
+      link_pp = &(*link_pp)->Next_p;
+      Pool_p->Carve_p += Pool_p->BlockSize;
+      taken++;
+    }
+    if (!AllocSlab(Pool_p, (missing > Pool_p->BlocksPerSlab) ? missing
+                                                               : Pool_p->BlocksPerSlab))
+    {
+      // Give back what was taken, the pool is unchanged apart from the order
+      // of its free list
+      *link_pp = Pool_p->Free_p;
+      Pool_p->Free_p = chain_p;
+      return NULL;
+    }
+  }
+
+  while (taken < Count)
+  {
+    *link_pp = (NODEPOOL_Block_t*)Pool_p->Carve_p;
+    link_pp = &(*link_pp)->Next_p;
+    Pool_p->Carve_p += Pool_p->BlockSize;
+    taken++;
+  }
+  *link_pp = NULL;
+  return chain_p;
+}
+
+void
+NODEPOOL_Free(NODEPOOL_Pool_t *const Pool_p, void *const Block_p)
+{
+  NODEPOOL_Block_t* block_p = Block_p;
+  block_p->Next_p = Pool_p->Free_p;
+  Pool_p->Free_p = block_p;
+}
+
+void
+NODEPOOL_Retain(NODEPOOL_Pool_t *const Pool_p)
+{
+  Pool_p->References++;
+}
+
+bool
+NODEPOOL_Release(NODEPOOL_Pool_t *const Pool_p)
+{
+  if (--Pool_p->References > 0)
+  {
+    return false;
+  }
+  NODEPOOL_Destroy(Pool_p);
+  return true;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Allocates a new slab of BlockCount blocks and makes it the one that
+// NODEPOOL_Alloc() carves from
+static bool
+AllocSlab(NODEPOOL_Pool_t *const Pool_p, size_t BlockCount)
+{
+  size_t slabSize = SlabHeaderSize + Pool_p->BlockSize * BlockCount;
+  NODEPOOL_Slab_t* slab_p = malloc(slabSize);
+  if (slab_p == NULL)
+  {
+    return false;
+  }
+
+  slab_p->Next_p = Pool_p->Slabs_p;
+  Pool_p->Slabs_p = slab_p;
+
+  Pool_p->Carve_p = (char*)slab_p + SlabHeaderSize;
+  Pool_p->CarveEnd_p = (char*)slab_p + slabSize;
+  return true;
+}
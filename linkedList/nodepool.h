@@ -0,0 +1,186 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+/*
+ * Fixed-size Node Pool
+ *
+ * Hands out equally sized blocks carved from large slabs. Released blocks
+ * are recycled through a free list, and all slabs are released at once when
+ * the pool is destroyed. A pool may be shared by several owners, which count
+ * their references with NODEPOOL_Retain() and NODEPOOL_Release().
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/* > Defines ******************************************************************/
+
+#define NODEPOOL_DEFAULT_BLOCKS_PER_SLAB  4096
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Free Block Definition
+//
+
+typedef struct NODEPOOL_Block
+{
+  struct NODEPOOL_Block* Next_p;
+} NODEPOOL_Block_t;
+
+
+//
+// Slab Definition
+//
+
+typedef struct NODEPOOL_Slab
+{
+  struct NODEPOOL_Slab* Next_p;
+} NODEPOOL_Slab_t;
+
+
+//
+// Pool Definition
+//
+
+typedef struct NODEPOOL_Pool
+{
+  size_t            BlockSize;
+  size_t            BlocksPerSlab;
+  NODEPOOL_Slab_t*  Slabs_p;
+  NODEPOOL_Block_t* Free_p;
+  char*             Carve_p;
+  char*             CarveEnd_p;
+  size_t            References;
+} NODEPOOL_Pool_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new pool
+ *
+ * Initializes an empty pool handing out blocks of BlockSize bytes. No memory
+ * is allocated until the first block is requested. The pool starts with one
+ * reference, held by the caller.
+ *
+ * @param[in]     Pool_p         The pool to be initialized.
+ * @param[in]     BlockSize      Size of every block in bytes.
+ * @param[in]     BlocksPerSlab  Number of blocks carved from each slab, or 0
+ *                               for NODEPOOL_DEFAULT_BLOCKS_PER_SLAB.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+NODEPOOL_Create(NODEPOOL_Pool_t *const Pool_p,
+                size_t BlockSize,
+                size_t BlocksPerSlab);
+
+
+/**
+ * @brief Destroys a pool
+ *
+ * Releases every slab owned by the pool in one pass over the slabs. All
+ * blocks handed out by the pool become invalid, whether or not they were
+ * returned with NODEPOOL_Free().
+ *
+ * @param[in]     Pool_p  The pool to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+NODEPOOL_Destroy(NODEPOOL_Pool_t *const Pool_p);
+
+
+/**
+ * @brief Allocates a block from the pool
+ *
+ * Returns a recycled block if one is available, otherwise carves a new block
+ * from the current slab, allocating a new slab when the current one is used
+ * up.
+ *
+ * @param[in]     Pool_p  Pointer to the pool
+ * @return        Pointer to the block, or NULL if out of memory
+ *
+ ******************************************************************************/
+void*
+NODEPOOL_Alloc(NODEPOOL_Pool_t *const Pool_p);
+
+
+/**
+ * @brief Allocates several blocks from the pool
+ *
+ * Returns Count blocks linked through the Next_p field of NODEPOOL_Block_t,
+ * which overlays the first bytes of every block, with NULL in the last one.
+ * Recycled blocks are used first, then the rest of the current slab. All
+ * blocks still missing are carved from one new slab, which is made larger
+ * than usual if needed, so a chain costs at most one allocation.
+ *
+ * @param[in]     Pool_p  Pointer to the pool
+ * @param[in]     Count   Number of blocks, at least 1
+ * @return        Pointer to the first block, or NULL if out of memory
+ *
+ ******************************************************************************/
+NODEPOOL_Block_t*
+NODEPOOL_AllocChain(NODEPOOL_Pool_t *const Pool_p, size_t Count);
+
+
+/**
+ * @brief Returns a block to the pool
+ *
+ * Puts the block on the free list of the pool so it can be handed out again
+ * by NODEPOOL_Alloc(). The memory is not returned to the system until the
+ * pool is destroyed.
+ *
+ * @param[in]     Pool_p   Pointer to the pool
+ * @param[in]     Block_p  Block previously returned by NODEPOOL_Alloc()
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+NODEPOOL_Free(NODEPOOL_Pool_t *const Pool_p, void *const Block_p);
+
+
+/**
+ * @brief Adds a reference to the pool
+ *
+ * Registers one more owner of the pool, e.g. a second list that allocates
+ * its nodes from it.
+ *
+ * @param[in]     Pool_p  Pointer to the pool
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+NODEPOOL_Retain(NODEPOOL_Pool_t *const Pool_p);
+
+
+/**
+ * @brief Drops a reference to the pool
+ *
+ * Destroys the pool with NODEPOOL_Destroy() when the last reference is
+ * dropped. The memory of the pool structure itself belongs to the caller.
+ *
+ * @param[in]     Pool_p  Pointer to the pool
+ * @return        true if the pool was destroyed, false if it is still in use
+ *
+ ******************************************************************************/
+bool
+NODEPOOL_Release(NODEPOOL_Pool_t *const Pool_p);
+
+
+#endif // NODEPOOL_H
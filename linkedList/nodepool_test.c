@@ -0,0 +1,207 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "nodepool.h"
+#include "nodepool_test.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestAllocAcrossSlabs(CuTest* Test_p);
+
+static void
+TestFreeReusesBlocks(CuTest* Test_p);
+
+static void
+TestSmallBlocksAreRounded(CuTest* Test_p);
+
+static void
+TestReleaseDestroysLastReference(CuTest* Test_p);
+
+static void
+TestAllocChain(CuTest* Test_p);
+
+static void
+TestReleaseDestroysLastReference(CuTest* Test_p)
+{
+  NODEPOOL_Pool_t Pool;
+
+  NODEPOOL_Create(&Pool, 16, 0);
+  CuAssertTrue(Test_p, Pool.References == 1);
+  NODEPOOL_Retain(&Pool);
+  CuAssertPtrNotNull(Test_p, NODEPOOL_Alloc(&Pool));
+
+  CuAssertTrue(Test_p, NODEPOOL_Release(&Pool) == false);
+  CuAssertPtrNotNull(Test_p, Pool.Slabs_p);
+  CuAssertTrue(Test_p, NODEPOOL_Release(&Pool) == true);
+  CuAssertPtrEquals(Test_p, NULL, Pool.Slabs_p);
+}
+
+
+static void
+TestAllocChain(CuTest* Test_p)
+{
+  NODEPOOL_Pool_t Pool;
+
+  NODEPOOL_Create(&Pool, 16, 4);
+  void* First_p = NODEPOOL_Alloc(&Pool);
+  void* Second_p = NODEPOOL_Alloc(&Pool);
+  NODEPOOL_Free(&Pool, First_p);
+
+  // One recycled block, the two left in the slab, then a new slab of ten
+  NODEPOOL_Block_t* Chain_p = NODEPOOL_AllocChain(&Pool, 13);
+  CuAssertPtrEquals(Test_p, First_p, Chain_p);
+  CuAssertPtrEquals(Test_p, (char*)Second_p + 16, Chain_p->Next_p);
+
+  size_t Count = 0;
+  for (NODEPOOL_Block_t* Block_p = Chain_p; Block_p != NULL; Block_p = Block_p->Next_p)
+  {
+    Count++;
+  }
+  CuAssertTrue(Test_p, Count == 13);
+  CuAssertPtrEquals(Test_p, NULL, Pool.Free_p);
+  CuAssertPtrEquals(Test_p, Pool.CarveEnd_p, Pool.Carve_p);
+  CuAssertPtrEquals(Test_p, NULL, Pool.Slabs_p->Next_p->Next_p);
+
+  // A chain that fits the current slab needs no new one
+  NODEPOOL_Free(&Pool, Second_p);
+  CuAssertPtrEquals(Test_p, Second_p, NODEPOOL_AllocChain(&Pool, 1));
+
+  NODEPOOL_Destroy(&Pool);
+}
+
+
+static CuSuite*
+Get_NODEPOOL_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_NODEPOOL_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_NODEPOOL_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+
+static void
+TestAllocAcrossSlabs(CuTest* Test_p)
+{
+  NODEPOOL_Pool_t Pool;
+  int* Blocks[10];
+
+  NODEPOOL_Create(&Pool, sizeof(int) * 4, 3);
+
+  for (int i = 0; i < 10; i++)
+  {
+    Blocks[i] = NODEPOOL_Alloc(&Pool);
+    CuAssertPtrNotNull(Test_p, Blocks[i]);
+    CuAssertTrue(Test_p, ((uintptr_t)Blocks[i] % sizeof(void*)) == 0);
+    for (int j = 0; j < 4; j++)
+    {
+      Blocks[i][j] = i;
+    }
+  }
+
+  // No block may overlap another one
+  for (int i = 0; i < 10; i++)
+  {
+    for (int j = 0; j < 4; j++)
+    {
+      CuAssertIntEquals(Test_p, i, Blocks[i][j]);
+    }
+  }
+
+  NODEPOOL_Destroy(&Pool);
+  CuAssertPtrEquals(Test_p, NULL, Pool.Slabs_p);
+}
+
+
+static void
+TestFreeReusesBlocks(CuTest* Test_p)
+{
+  NODEPOOL_Pool_t Pool;
+
+  NODEPOOL_Create(&Pool, 16, 0);
+
+  void* First_p = NODEPOOL_Alloc(&Pool);
+  void* Second_p = NODEPOOL_Alloc(&Pool);
+
+  NODEPOOL_Free(&Pool, First_p);
+  NODEPOOL_Free(&Pool, Second_p);
+
+  CuAssertPtrEquals(Test_p, Second_p, NODEPOOL_Alloc(&Pool));
+  CuAssertPtrEquals(Test_p, First_p, NODEPOOL_Alloc(&Pool));
+
+  NODEPOOL_Destroy(&Pool);
+}
+
+
+static void
+TestSmallBlocksAreRounded(CuTest* Test_p)
+{
+  NODEPOOL_Pool_t Pool;
+
+  NODEPOOL_Create(&Pool, 1, 8);
+  CuAssertTrue(Test_p, Pool.BlockSize == sizeof(NODEPOOL_Block_t));
+
+  char* First_p = NODEPOOL_Alloc(&Pool);
+  char* Second_p = NODEPOOL_Alloc(&Pool);
+  CuAssertTrue(Test_p, (size_t)(Second_p - First_p) == Pool.BlockSize);
+
+  NODEPOOL_Destroy(&Pool);
+}
+
+
+static CuSuite*
+Get_NODEPOOL_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestAllocAcrossSlabs);
+  SUITE_ADD_TEST(Suite_p, TestFreeReusesBlocks);
+  SUITE_ADD_TEST(Suite_p, TestSmallBlocksAreRounded);
+  SUITE_ADD_TEST(Suite_p, TestReleaseDestroysLastReference);
+  SUITE_ADD_TEST(Suite_p, TestAllocChain);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef NODEPOOL_TEST_H
+#define NODEPOOL_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_NODEPOOL_Tests(void);
+
+
+#endif // NODEPOOL_TEST_H
@@ -0,0 +1,304 @@
+/* > Includes *****************************************************************/
+#include "plist.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static PLIST_Node_t*
+NewNode(void *const Data_p, PLIST_Node_t *const Next_p);
+
+static void
+Retain(PLIST_Node_t *const Node_p);
+
+static bool
+Drop(atomic_size_t *const Count_p);
+
+static void
+Release(const SLIST_Callbacks_t *const Callbacks_p, PLIST_Node_t* Node_p);
+
+static void
+SetResult(const PLIST_List_t *const List_p,
+          PLIST_List_t *const Result_p,
+          PLIST_Node_t *const Head_p,
+          size_t Length);
+
+
+/* > Global Function Definitions **********************************************/
+
+//
+// A version owns one reference to Head_p. Operations that produce a new
+// version take a reference to whatever part of the old one they share before
+// the old one is dropped, so Result_p may alias List_p.
+//
+
+void
+PLIST_Create(PLIST_List_t *const List_p)
+{
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+  List_p->Head_p = NULL;
+  List_p->Length = 0;
+}
+
+void
+PLIST_Destroy(PLIST_List_t *const List_p)
+{
+  Release(&List_p->Callbacks, List_p->Head_p);
+  List_p->Head_p = NULL;
+  List_p->Length = 0;
+}
+
+void
+PLIST_Snapshot(const PLIST_List_t *const List_p, PLIST_List_t *const Snapshot_p)
+{
+  Retain(List_p->Head_p);
+  *Snapshot_p = *List_p;
+}
+
+bool
+PLIST_IsEmpty(const PLIST_List_t *const List_p)
+{
+  return (List_p->Head_p == NULL);
+}
+
+size_t
+PLIST_Length(const PLIST_List_t *const List_p)
+{
+  return List_p->Length;
+}
+
+bool
+PLIST_InsertFirst(const PLIST_List_t *const List_p,
+                  PLIST_List_t *const Result_p,
+                  void *const Data_p)
+{
+  PLIST_Node_t* newNode_p = NewNode(Data_p, List_p->Head_p);
+  if (newNode_p == NULL)
+  {
+    return false;
+  }
+
+  // The new node takes over the reference of a replaced version
+  if (Result_p != List_p)
+  {
+    Retain(List_p->Head_p);
+  }
+  Result_p->Callbacks = List_p->Callbacks;
+  Result_p->Head_p = newNode_p;
+  Result_p->Length = List_p->Length + 1;
+  return true;
+}
+
+void*
+PLIST_First(const PLIST_List_t *const List_p)
+{
+  return (List_p->Head_p != NULL) ? List_p->Head_p->Data_p : NULL;
+}
+
+bool
+PLIST_RemoveFirst(const PLIST_List_t *const List_p, PLIST_List_t *const Result_p)
+{
+  if (List_p->Head_p == NULL)
+  {
+    return false;
+  }
+
+  Retain(List_p->Head_p->Next_p);
+  SetResult(List_p, Result_p, List_p->Head_p->Next_p, List_p->Length - 1);
+  return true;
+}
+
+bool
+PLIST_RemoveSpecific(const PLIST_List_t *const List_p,
+                     PLIST_List_t *const Result_p,
+                     const void *const SearchData_p)
+{
+  DataCompare_t compare_fp = List_p->Callbacks.DataCompare_fp;
+  const PLIST_Node_t* match_p = List_p->Head_p;
+  size_t prefix = 0;
+
+  while (match_p != NULL && compare_fp(match_p->Data_p, SearchData_p) != 0)
+  {
+    match_p = match_p->Next_p;
+    prefix++;
+  }
+  if (match_p == NULL)
+  {
+    return false;
+  }
+
+  // Allocate all copies before touching any reference count, so that running
+  // out of memory leaves nothing to undo
+  PLIST_Node_t* spare_p = NULL;
+  for (size_t i = 0; i < prefix; i++)
+  {
+    PLIST_Node_t* node_p = malloc(sizeof(PLIST_Node_t));
+    if (node_p == NULL)
+    {
+      while (spare_p != NULL)
+      {
+        node_p = spare_p->Next_p;
+        free(spare_p);
+        spare_p = node_p;
+      }
+      return false;
+    }
+    node_p->Next_p = spare_p;
+    spare_p = node_p;
+  }
+
+  // Copy the nodes in front of the match and link the last copy to the
+  // shared tail behind it
+  PLIST_Node_t* head_p = NULL;
+  PLIST_Node_t** link_pp = &head_p;
+  for (PLIST_Node_t* node_p = List_p->Head_p; node_p != match_p; node_p = node_p->Next_p)
+  {
+    PLIST_Node_t* copy_p = spare_p;
+    spare_p = spare_p->Next_p;
+
+    PLIST_Node_t* owner_p = (node_p->Owner_p != NULL) ? node_p->Owner_p : node_p;
+    atomic_fetch_add_explicit(&owner_p->Sharers, 1, memory_order_relaxed);
+    copy_p->Data_p = owner_p->Data_p;
+    copy_p->Owner_p = owner_p;
+    atomic_init(&copy_p->References, 1);
+    atomic_init(&copy_p->Sharers, 0);
+
+    *link_pp = copy_p;
+    link_pp = &copy_p->Next_p;
+  }
+  *link_pp = match_p->Next_p;
+  Retain(match_p->Next_p);
+
+  SetResult(List_p, Result_p, head_p, List_p->Length - 1);
+  return true;
+}
+
+void*
+PLIST_Find(const PLIST_List_t *const List_p, const void *const SearchData_p)
+{
+  DataCompare_t compare_fp = List_p->Callbacks.DataCompare_fp;
+
+  for (const PLIST_Node_t* node_p = List_p->Head_p; node_p != NULL; node_p = node_p->Next_p)
+  {
+    if (compare_fp(node_p->Data_p, SearchData_p) == 0)
+    {
+      return node_p->Data_p;
+    }
+  }
+  return NULL;
+}
+
+void
+PLIST_SetDestroyFunction(PLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+PLIST_SetCompareFunction(PLIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Creates an owner node holding the reference its creator links to it
+static PLIST_Node_t*
+NewNode(void *const Data_p, PLIST_Node_t *const Next_p)
+{
+  PLIST_Node_t* node_p = malloc(sizeof(PLIST_Node_t));
+  if (node_p != NULL)
+  {
+    node_p->Data_p = Data_p;
+    node_p->Next_p = Next_p;
+    node_p->Owner_p = NULL;
+    atomic_init(&node_p->References, 1);
+    atomic_init(&node_p->Sharers, 1);
+  }
+  return node_p;
+}
+
+// Taking a reference needs no ordering; the caller already holds one
+static void
+Retain(PLIST_Node_t *const Node_p)
+{
+  if (Node_p != NULL)
+  {
+    atomic_fetch_add_explicit(&Node_p->References, 1, memory_order_relaxed);
+  }
+}
+
+// Drops one count and returns true if it was the last; acquire and release
+// make every use of the node by other threads happen before the caller frees
+// it
+static bool
+Drop(atomic_size_t *const Count_p)
+{
+  return (atomic_fetch_sub_explicit(Count_p, 1, memory_order_acq_rel) == 1);
+}
+
+// Drops a reference to Node_p and frees the nodes that become unreachable,
+// iteratively, so that releasing a long list does not recurse
+static void
+Release(const SLIST_Callbacks_t *const Callbacks_p, PLIST_Node_t* Node_p)
+{
+  while (Node_p != NULL && Drop(&Node_p->References))
+  {
+    PLIST_Node_t* next_p = Node_p->Next_p;
+    PLIST_Node_t* owner_p = (Node_p->Owner_p != NULL) ? Node_p->Owner_p : Node_p;
+
+    if (Node_p != owner_p)
+    {
+      free(Node_p);
+    }
+    if (Drop(&owner_p->Sharers))
+    {
+      if (Callbacks_p->DataDestroy_fp != NULL)
+      {
+        Callbacks_p->DataDestroy_fp(owner_p->Data_p);
+      }
+      free(owner_p);
+    }
+    Node_p = next_p;
+  }
+}
+
+// Stores a new version holding a reference to Head_p, releasing the old one
+// if it is being replaced
+static void
+SetResult(const PLIST_List_t *const List_p,
+          PLIST_List_t *const Result_p,
+          PLIST_Node_t *const Head_p,
+          size_t Length)
+{
+  if (Result_p == List_p)
+  {
+    Release(&Result_p->Callbacks, Result_p->Head_p);
+  }
+  else
+  {
+    Result_p->Callbacks = List_p->Callbacks;
+  }
+  Result_p->Head_p = Head_p;
+  Result_p->Length = Length;
+}
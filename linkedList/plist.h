@@ -0,0 +1,284 @@
+#ifndef PLIST_H
+#define PLIST_H
+
+/*
+ * Persistent Singly Linked List
+ *
+ * A PLIST_List_t is an immutable version of a list. Operations never modify
+ * the version they are given; they produce a new version that shares as many
+ * nodes as possible with the old one. PLIST_InsertFirst() and
+ * PLIST_RemoveFirst() share the whole remaining list and take O(1),
+ * PLIST_RemoveSpecific() copies only the nodes in front of the removed one.
+ * A snapshot, PLIST_Snapshot(), is another reference to the same version and
+ * also takes O(1).
+ *
+ * Nodes are reference counted: every version holds a reference to its first
+ * node and every node to the next one. A node is freed, and its data passed
+ * to the destroy function, when its last reference goes away, so data stays
+ * valid for as long as any version containing it exists.
+ *
+ * The reference counts are atomic, so versions sharing nodes may be used and
+ * destroyed by different threads. A PLIST_List_t itself is a plain value;
+ * a variable holding the current version that one thread replaces while
+ * others take snapshots of it must be guarded by a lock, which is then held
+ * only for the O(1) snapshot or replacement, never for a copy of the list.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+//
+// Visits every element of a version in order, with Variable set to the data
+// of the element, see SLIST_FOREACH(). Versions never change, so other
+// threads may derive new versions from it meanwhile.
+//
+#define PLIST_FOREACH(Variable, List_p)                                         \
+  for (const PLIST_Node_t* Variable##_Node_p = (List_p)->Head_p;                \
+       Variable##_Node_p != NULL && ((Variable) = Variable##_Node_p->Data_p, 1);\
+       Variable##_Node_p = Variable##_Node_p->Next_p)
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition, immutable once linked apart from its reference counts
+//
+// References counts the versions and nodes linking to the node. A node copied
+// by PLIST_RemoveSpecific() shares the data of the node it copies, its owner,
+// and Sharers of the owner counts the nodes using that data, so the data is
+// destroyed once however many copies were made. The owner is freed with its
+// last sharer; Owner_p is NULL for an owner.
+//
+
+typedef struct PLIST_Node
+{
+  void*              Data_p;
+  struct PLIST_Node* Next_p;
+  struct PLIST_Node* Owner_p;
+  atomic_size_t      References;
+  atomic_size_t      Sharers;
+} PLIST_Node_t;
+
+
+//
+// List Version Definition
+//
+
+typedef struct PLIST_List
+{
+  SLIST_Callbacks_t Callbacks;
+  PLIST_Node_t*     Head_p;
+  size_t            Length;
+} PLIST_List_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates an empty version without callbacks. Every version derived from it
+ * inherits the callbacks it has at that time.
+ *
+ * @param[in]     List_p  The version to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+PLIST_Create(PLIST_List_t *const List_p);
+
+
+/**
+ * @brief Destroys a version of a list
+ *
+ * Drops the reference of the version to its nodes. Nodes no other version
+ * reaches are freed and their data is passed to the function set by
+ * PLIST_SetDestroyFunction(); nodes still shared stay untouched. The version
+ * is empty afterwards.
+ *
+ * @param[in]     List_p  The version to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+PLIST_Destroy(PLIST_List_t *const List_p);
+
+
+/**
+ * @brief Takes a snapshot of a version
+ *
+ * Initializes Snapshot_p as a version equal to List_p, sharing all of its
+ * nodes, in O(1) whatever the length. Both must be destroyed.
+ *
+ * @param[in]     List_p      The version to take a snapshot of
+ * @param[out]    Snapshot_p  The version to be initialized
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+PLIST_Snapshot(const PLIST_List_t *const List_p, PLIST_List_t *const Snapshot_p);
+
+
+/**
+ * @brief Checks if a version is empty
+ *
+ * @param[in]     List_p  Pointer to the version
+ * @return        true if empty, false otherwise
+ *
+ ******************************************************************************/
+bool
+PLIST_IsEmpty(const PLIST_List_t *const List_p);
+
+
+/**
+ * @brief Returns the number of elements in a version
+ *
+ * @param[in]     List_p  Pointer to the version
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+PLIST_Length(const PLIST_List_t *const List_p);
+
+
+/**
+ * @brief Inserts an item first in the list
+ *
+ * Initializes Result_p as a version with Data_p in front of the elements of
+ * List_p, sharing all of them, in O(1). If Result_p is List_p, the old
+ * version is replaced and needs no PLIST_Destroy() of its own. The data is
+ * owned by the list from then on: the destroy function is applied to it when
+ * no version contains it any more, so the same data must not be inserted
+ * again.
+ *
+ * @param[in]     List_p    The version to insert into
+ * @param[out]    Result_p  The version to be initialized
+ * @param[in]     Data_p    The data to insert
+ * @return        false if out of memory, in which case Result_p is not
+ *                initialized and List_p is unchanged
+ *
+ ******************************************************************************/
+bool
+PLIST_InsertFirst(const PLIST_List_t *const List_p,
+                  PLIST_List_t *const Result_p,
+                  void *const Data_p);
+
+
+/**
+ * @brief Returns the first item in the list
+ *
+ * @param[in]     List_p  Pointer to the version
+ * @return        Pointer to the first data, or NULL if the version is empty
+ *
+ ******************************************************************************/
+void*
+PLIST_First(const PLIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes the first item in the list
+ *
+ * Initializes Result_p as a version without the first element of List_p,
+ * sharing all other elements, in O(1). If Result_p is List_p, the old
+ * version is replaced. The data of the removed element is not returned:
+ * other versions may still contain it, and it is destroyed with the last of
+ * them. Use PLIST_First() first to inspect it.
+ *
+ * @param[in]     List_p    The version to remove from
+ * @param[out]    Result_p  The version to be initialized
+ * @return        false if List_p is empty, in which case Result_p is not
+ *                initialized
+ *
+ ******************************************************************************/
+bool
+PLIST_RemoveFirst(const PLIST_List_t *const List_p, PLIST_List_t *const Result_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Initializes Result_p as a version without the first element of List_p that
+ * is equal to SearchData_p, according to the comparison function. The
+ * elements in front of it are copied to new nodes, which refer to the same
+ * data; the elements after it are shared. If Result_p is List_p, the old
+ * version is replaced. As with PLIST_RemoveFirst(), the removed data is not
+ * returned.
+ *
+ * @param[in]     List_p        The version to remove from
+ * @param[out]    Result_p      The version to be initialized
+ * @param[in]     SearchData_p  The data to remove
+ * @return        false if not found or out of memory, in which case Result_p
+ *                is not initialized
+ *
+ ******************************************************************************/
+bool
+PLIST_RemoveSpecific(const PLIST_List_t *const List_p,
+                     PLIST_List_t *const Result_p,
+                     const void *const SearchData_p);
+
+
+/**
+ * @brief Finds a specific item in the list
+ *
+ * Returns the first item in the version that is equal to SearchData_p,
+ * according to the comparison function.
+ *
+ * @param[in]     List_p        Pointer to the version
+ * @param[in]     SearchData_p  The data to search for
+ * @return        Pointer to the data in the list, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+PLIST_Find(const PLIST_List_t *const List_p, const void *const SearchData_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * Sets the function applied to the data of a node when the node is freed.
+ * Set it on the empty list before deriving versions from it; all versions
+ * sharing nodes must use the same function.
+ *
+ * @param[in]     List_p          Pointer to the version
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+PLIST_SetDestroyFunction(PLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets compare function for the list
+ *
+ * Sets the function used by PLIST_Find() and PLIST_RemoveSpecific(). It
+ * returns 0 for equal data.
+ *
+ * @param[in]     List_p          Pointer to the version
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+PLIST_SetCompareFunction(PLIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+#endif // PLIST_H
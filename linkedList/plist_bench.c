@@ -0,0 +1,127 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "plist.h"
+#include "slist.h"
+#include "plist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SNAPSHOT_ROUNDS  100
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 1000, 100000, 1000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchSlistCopy(size_t Size);
+
+static void
+BenchPlistSnapshot(size_t Size);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_PLIST_Benchmarks(void)
+{
+  printf("Consistent views: copying an SLIST vs a PLIST snapshot\n");
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchSlistCopy(ListSizes[i]);
+    BenchPlistSnapshot(ListSizes[i]);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Fills an SLIST, then takes copies of it as a reader holding the lock would
+static void
+BenchSlistCopy(size_t Size)
+{
+  SLIST_List_t List;
+  char Name[64];
+  static int Data;
+  int* Data_p;
+
+  SLIST_Create(&List);
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertFirst(&List, &Data);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "InsertFirst/slist/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SNAPSHOT_ROUNDS; r++)
+  {
+    SLIST_List_t Copy;
+    SLIST_Create(&Copy);
+    SLIST_FOREACH(Data_p, &List)
+    {
+      SLIST_InsertLast(&Copy, Data_p);
+    }
+    SLIST_Destroy(&Copy);
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Copy+Destroy/slist/N=%zu", Size);
+  BENCH_Report(Name, SNAPSHOT_ROUNDS, Elapsed);
+
+  SLIST_Destroy(&List);
+}
+
+// Same for a PLIST, whose snapshots share every node
+static void
+BenchPlistSnapshot(size_t Size)
+{
+  PLIST_List_t List;
+  char Name[64];
+  static int Data;
+
+  PLIST_Create(&List);
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    PLIST_InsertFirst(&List, &List, &Data);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "InsertFirst/plist/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SNAPSHOT_ROUNDS; r++)
+  {
+    PLIST_List_t Snapshot;
+    PLIST_Snapshot(&List, &Snapshot);
+    PLIST_Destroy(&Snapshot);
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Snapshot+Destroy/plist/N=%zu", Size);
+  BENCH_Report(Name, SNAPSHOT_ROUNDS, Elapsed);
+
+  PLIST_Destroy(&List);
+}
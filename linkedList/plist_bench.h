@@ -0,0 +1,26 @@
+#ifndef PLIST_BENCH_H
+#define PLIST_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_PLIST_Benchmarks(void);
+
+
+#endif // PLIST_BENCH_H
@@ -0,0 +1,413 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "CuTest.h"
+#include "plist.h"
+#include "plist_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TEST_ELEMENTS      4
+#define STRESS_READERS     3
+#define STRESS_OPERATIONS  20000
+
+
+/* > Type Declarations  *******************************************************/
+
+// Current version published by the writer of the stress test
+typedef struct Shared
+{
+  pthread_mutex_t Lock;
+  PLIST_List_t    Current;
+  atomic_bool     Done;
+} Shared_t;
+
+typedef struct Reader
+{
+  Shared_t* Shared_p;
+  size_t    Snapshots;
+  bool      Correct;
+} Reader_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int Numbers[TEST_ELEMENTS] = { 1, 2, 3, 4 };
+
+static atomic_size_t DestroyCount;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestInsertFirstSharesTail(CuTest* Test_p);
+
+static void
+TestReplaceInPlace(CuTest* Test_p);
+
+static void
+TestSnapshotKeepsData(CuTest* Test_p);
+
+static void
+TestRemoveSpecificCopiesPrefix(CuTest* Test_p);
+
+static void
+TestEmptyList(CuTest* Test_p);
+
+static void
+TestStressSnapshots(CuTest* Test_p);
+
+static CuSuite*
+Get_PLIST_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_PLIST_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_PLIST_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+// Counts destroyed elements without freeing the static test data
+static void
+DataDestroyCount(void* const Data_p)
+{
+  atomic_fetch_add(&DestroyCount, 1);
+}
+
+static void
+DataDestroyFree(void* const Data_p)
+{
+  atomic_fetch_add(&DestroyCount, 1);
+  free(Data_p);
+}
+
+// Builds the version 4, 3, 2, 1 from an empty list counting destroys
+static void
+CreateNumbers(CuTest* Test_p, PLIST_List_t *const List_p)
+{
+  PLIST_Create(List_p);
+  PLIST_SetDestroyFunction(List_p, DataDestroyCount);
+  PLIST_SetCompareFunction(List_p, DataCompareInt);
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    CuAssertTrue(Test_p, PLIST_InsertFirst(List_p, List_p, &Numbers[i]));
+  }
+  atomic_store(&DestroyCount, 0);
+}
+
+static void
+TestInsertFirstSharesTail(CuTest* Test_p)
+{
+  PLIST_List_t Empty;
+  PLIST_List_t One;
+  PLIST_List_t Two;
+  PLIST_List_t Other;
+
+  PLIST_Create(&Empty);
+  PLIST_SetDestroyFunction(&Empty, DataDestroyCount);
+  atomic_store(&DestroyCount, 0);
+
+  CuAssertTrue(Test_p, PLIST_InsertFirst(&Empty, &One, &Numbers[0]));
+  CuAssertTrue(Test_p, PLIST_InsertFirst(&One, &Two, &Numbers[1]));
+  CuAssertTrue(Test_p, PLIST_InsertFirst(&One, &Other, &Numbers[2]));
+
+  // Every version still holds what it held when it was made
+  CuAssertTrue(Test_p, PLIST_IsEmpty(&Empty));
+  CuAssertIntEquals(Test_p, 1, (int)PLIST_Length(&One));
+  CuAssertIntEquals(Test_p, 2, (int)PLIST_Length(&Two));
+  CuAssertPtrEquals(Test_p, &Numbers[0], PLIST_First(&One));
+  CuAssertPtrEquals(Test_p, &Numbers[1], PLIST_First(&Two));
+  CuAssertPtrEquals(Test_p, &Numbers[2], PLIST_First(&Other));
+
+  // Both branches share the node of One
+  CuAssertPtrEquals(Test_p, One.Head_p, Two.Head_p->Next_p);
+  CuAssertPtrEquals(Test_p, One.Head_p, Other.Head_p->Next_p);
+  CuAssertIntEquals(Test_p, 3, (int)atomic_load(&One.Head_p->References));
+
+  PLIST_Destroy(&One);
+  PLIST_Destroy(&Two);
+  CuAssertIntEquals(Test_p, 1, (int)atomic_load(&DestroyCount));
+  PLIST_Destroy(&Other);
+  CuAssertIntEquals(Test_p, 3, (int)atomic_load(&DestroyCount));
+  PLIST_Destroy(&Empty);
+}
+
+static void
+TestReplaceInPlace(CuTest* Test_p)
+{
+  PLIST_List_t List;
+  int* Number_p;
+  int Expected = TEST_ELEMENTS;
+
+  CreateNumbers(Test_p, &List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)PLIST_Length(&List));
+  PLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected--;
+  }
+  CuAssertIntEquals(Test_p, 1, (int)atomic_load(&List.Head_p->References));
+
+  // Nothing else refers to the removed node, so it goes at once
+  CuAssertTrue(Test_p, PLIST_RemoveFirst(&List, &List));
+  CuAssertIntEquals(Test_p, 1, (int)atomic_load(&DestroyCount));
+  CuAssertIntEquals(Test_p, 3, *(int*)PLIST_First(&List));
+  CuAssertIntEquals(Test_p, 1, (int)atomic_load(&List.Head_p->References));
+
+  PLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)atomic_load(&DestroyCount));
+  CuAssertTrue(Test_p, PLIST_IsEmpty(&List));
+}
+
+static void
+TestSnapshotKeepsData(CuTest* Test_p)
+{
+  PLIST_List_t List;
+  PLIST_List_t Snapshot;
+  int* Number_p;
+  int Expected = TEST_ELEMENTS;
+
+  CreateNumbers(Test_p, &List);
+  PLIST_Snapshot(&List, &Snapshot);
+  CuAssertPtrEquals(Test_p, List.Head_p, Snapshot.Head_p);
+
+  // The writer goes on without affecting the snapshot
+  while (PLIST_RemoveFirst(&List, &List))
+  {
+  }
+  CuAssertTrue(Test_p, PLIST_InsertFirst(&List, &List, &Numbers[0]));
+  CuAssertIntEquals(Test_p, 0, (int)atomic_load(&DestroyCount));
+
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)PLIST_Length(&Snapshot));
+  PLIST_FOREACH(Number_p, &Snapshot)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected--;
+  }
+
+  // The data is destroyed with the last version holding it
+  PLIST_Destroy(&Snapshot);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)atomic_load(&DestroyCount));
+  PLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS + 1, (int)atomic_load(&DestroyCount));
+}
+
+static void
+TestRemoveSpecificCopiesPrefix(CuTest* Test_p)
+{
+  PLIST_List_t List;
+  PLIST_List_t Removed;
+  PLIST_List_t Twice;
+  int Two = 2;
+  int Four = 4;
+  int Five = 5;
+
+  CreateNumbers(Test_p, &List);
+  CuAssertTrue(Test_p, !PLIST_RemoveSpecific(&List, &Removed, &Five));
+  CuAssertTrue(Test_p, PLIST_RemoveSpecific(&List, &Removed, &Two));
+
+  // 4 and 3 are copied, 1 is shared
+  CuAssertIntEquals(Test_p, 3, (int)PLIST_Length(&Removed));
+  CuAssertPtrEquals(Test_p, NULL, PLIST_Find(&Removed, &Two));
+  CuAssertPtrEquals(Test_p, &Numbers[3], PLIST_First(&Removed));
+  CuAssertTrue(Test_p, Removed.Head_p != List.Head_p);
+  CuAssertPtrEquals(Test_p, List.Head_p, Removed.Head_p->Owner_p);
+  CuAssertPtrEquals(Test_p, List.Head_p->Next_p->Next_p->Next_p,
+                    Removed.Head_p->Next_p->Next_p);
+  CuAssertPtrEquals(Test_p, &Numbers[1], PLIST_Find(&List, &Two));
+
+  // A copy of a copy shares the data of the original node
+  CuAssertTrue(Test_p, PLIST_RemoveSpecific(&Removed, &Twice, &Numbers[0]));
+  CuAssertPtrEquals(Test_p, List.Head_p, Twice.Head_p->Owner_p);
+  CuAssertIntEquals(Test_p, 3, (int)atomic_load(&List.Head_p->Sharers));
+
+  // Only the removed 2 goes with the original; 4 and 3 live on in the copies
+  PLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, 1, (int)atomic_load(&DestroyCount));
+  CuAssertPtrEquals(Test_p, &Numbers[3], PLIST_Find(&Twice, &Four));
+
+  // Removing the head in place releases the old head
+  CuAssertTrue(Test_p, PLIST_RemoveSpecific(&Removed, &Removed, &Four));
+  CuAssertIntEquals(Test_p, 1, (int)atomic_load(&DestroyCount));
+  PLIST_Destroy(&Removed);
+  CuAssertIntEquals(Test_p, 2, (int)atomic_load(&DestroyCount));
+  PLIST_Destroy(&Twice);
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)atomic_load(&DestroyCount));
+}
+
+static void
+TestEmptyList(CuTest* Test_p)
+{
+  PLIST_List_t List;
+  PLIST_List_t Result;
+  PLIST_List_t Snapshot;
+
+  PLIST_Create(&List);
+  PLIST_SetCompareFunction(&List, DataCompareInt);
+  CuAssertTrue(Test_p, PLIST_IsEmpty(&List));
+  CuAssertIntEquals(Test_p, 0, (int)PLIST_Length(&List));
+  CuAssertPtrEquals(Test_p, NULL, PLIST_First(&List));
+  CuAssertTrue(Test_p, !PLIST_RemoveFirst(&List, &Result));
+  CuAssertTrue(Test_p, !PLIST_RemoveSpecific(&List, &Result, &Numbers[0]));
+  CuAssertPtrEquals(Test_p, NULL, PLIST_Find(&List, &Numbers[0]));
+
+  PLIST_Snapshot(&List, &Snapshot);
+  CuAssertTrue(Test_p, PLIST_IsEmpty(&Snapshot));
+  PLIST_Destroy(&Snapshot);
+  PLIST_Destroy(&List);
+}
+
+// Takes snapshots of the current version and checks each is a whole stack
+// Length - 1, ..., 1, 0 as the writer left it
+static void*
+ReaderThread(void* Argument_p)
+{
+  Reader_t* Reader_p = Argument_p;
+  Shared_t* Shared_p = Reader_p->Shared_p;
+
+  do
+  {
+    PLIST_List_t Snapshot;
+    pthread_mutex_lock(&Shared_p->Lock);
+    PLIST_Snapshot(&Shared_p->Current, &Snapshot);
+    pthread_mutex_unlock(&Shared_p->Lock);
+
+    int Expected = (int)PLIST_Length(&Snapshot) - 1;
+    int* Number_p;
+    PLIST_FOREACH(Number_p, &Snapshot)
+    {
+      if (*Number_p != Expected)
+      {
+        Reader_p->Correct = false;
+      }
+      Expected--;
+    }
+    if (Expected != -1)
+    {
+      Reader_p->Correct = false;
+    }
+    PLIST_Destroy(&Snapshot);
+    Reader_p->Snapshots++;
+  } while (!atomic_load(&Shared_p->Done));
+  return NULL;
+}
+
+static void
+TestStressSnapshots(CuTest* Test_p)
+{
+  Shared_t Shared;
+  pthread_t Threads[STRESS_READERS];
+  Reader_t Readers[STRESS_READERS];
+  unsigned int Seed = 1;
+  size_t Inserted = 0;
+
+  pthread_mutex_init(&Shared.Lock, NULL);
+  PLIST_Create(&Shared.Current);
+  PLIST_SetDestroyFunction(&Shared.Current, DataDestroyFree);
+  atomic_init(&Shared.Done, false);
+  atomic_store(&DestroyCount, 0);
+
+  for (int t = 0; t < STRESS_READERS; t++)
+  {
+    Readers[t].Shared_p = &Shared;
+    Readers[t].Snapshots = 0;
+    Readers[t].Correct = true;
+    pthread_create(&Threads[t], NULL, ReaderThread, &Readers[t]);
+  }
+
+  // The writer builds each version outside the lock and only publishes it
+  // under the lock, so readers never wait for more than a pointer swap
+  PLIST_List_t Next;
+  for (int i = 0; i < STRESS_OPERATIONS; i++)
+  {
+    pthread_mutex_lock(&Shared.Lock);
+    PLIST_Snapshot(&Shared.Current, &Next);
+    pthread_mutex_unlock(&Shared.Lock);
+
+    if (rand_r(&Seed) % 3 == 0)
+    {
+      PLIST_RemoveFirst(&Next, &Next);
+    }
+    else
+    {
+      int* Number_p = malloc(sizeof(int));
+      *Number_p = (int)PLIST_Length(&Next);
+      PLIST_InsertFirst(&Next, &Next, Number_p);
+      Inserted++;
+    }
+
+    pthread_mutex_lock(&Shared.Lock);
+    PLIST_List_t Old = Shared.Current;
+    Shared.Current = Next;
+    pthread_mutex_unlock(&Shared.Lock);
+    PLIST_Destroy(&Old);
+  }
+  atomic_store(&Shared.Done, true);
+
+  for (int t = 0; t < STRESS_READERS; t++)
+  {
+    pthread_join(Threads[t], NULL);
+    CuAssertTrue(Test_p, Readers[t].Correct);
+    CuAssertTrue(Test_p, Readers[t].Snapshots > 0);
+  }
+
+  PLIST_Destroy(&Shared.Current);
+  CuAssertIntEquals(Test_p, (int)Inserted, (int)atomic_load(&DestroyCount));
+  pthread_mutex_destroy(&Shared.Lock);
+}
+
+
+static CuSuite*
+Get_PLIST_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestInsertFirstSharesTail);
+  SUITE_ADD_TEST(Suite_p, TestReplaceInPlace);
+  SUITE_ADD_TEST(Suite_p, TestSnapshotKeepsData);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecificCopiesPrefix);
+  SUITE_ADD_TEST(Suite_p, TestEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestStressSnapshots);
+
+  return Suite_p;
+}
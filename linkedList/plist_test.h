@@ -0,0 +1,26 @@
+#ifndef PLIST_TEST_H
+#define PLIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_PLIST_Tests(void);
+
+
+#endif // PLIST_TEST_H
@@ -0,0 +1,208 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "mpscq.h"
+#include "mpmcq.h"
+#include "queue_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TOTAL_ITEMS  1000000
+#define MAX_THREADS  16
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef enum QueueKind
+{
+  QUEUE_KIND_MUTEX_SLIST,
+  QUEUE_KIND_MPSCQ,
+  QUEUE_KIND_MPMCQ
+} QueueKind_t;
+
+// The queue under test, shared by all threads of one run
+typedef struct SharedQueue
+{
+  QueueKind_t     Kind;
+  pthread_mutex_t Lock;
+  SLIST_List_t    List;
+  MPSCQ_Queue_t   Mpsc;
+  MPMCQ_Queue_t   Mpmc;
+  atomic_size_t   Received;
+  size_t          ItemsPerProducer;
+} SharedQueue_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const int ThreadCounts[] = { 1, 2, 4, 8, 16 };
+
+static const char *const KindNames[] = { "mutex+slist", "mpscq", "mpmcq" };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int Item;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+RunQueue(QueueKind_t Kind, int Producers, int Consumers);
+
+static void*
+ProducerThread(void* Arg_p);
+
+static void*
+ConsumerThread(void* Arg_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_QUEUE_Benchmarks(void)
+{
+  printf("Work queue throughput: N producers, 1 consumer\n");
+  for (size_t i = 0; i < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); i++)
+  {
+    RunQueue(QUEUE_KIND_MUTEX_SLIST, ThreadCounts[i], 1);
+    RunQueue(QUEUE_KIND_MPSCQ, ThreadCounts[i], 1);
+    RunQueue(QUEUE_KIND_MPMCQ, ThreadCounts[i], 1);
+  }
+  printf("\n");
+
+  printf("Work queue throughput: N producers, N consumers\n");
+  for (size_t i = 0; i < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); i++)
+  {
+    RunQueue(QUEUE_KIND_MUTEX_SLIST, ThreadCounts[i], ThreadCounts[i]);
+    RunQueue(QUEUE_KIND_MPMCQ, ThreadCounts[i], ThreadCounts[i]);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+RunQueue(QueueKind_t Kind, int Producers, int Consumers)
+{
+  SharedQueue_t Queue;
+  pthread_t Threads[2 * MAX_THREADS];
+  char Name[64];
+
+  Queue.Kind = Kind;
+  Queue.ItemsPerProducer = TOTAL_ITEMS / Producers;
+  atomic_init(&Queue.Received, 0);
+  pthread_mutex_init(&Queue.Lock, NULL);
+  SLIST_CreateWithPool(&Queue.List, 0);
+  MPSCQ_Create(&Queue.Mpsc);
+  MPMCQ_Create(&Queue.Mpmc);
+
+  uint64_t Start = BENCH_Now();
+  for (int c = 0; c < Consumers; c++)
+  {
+    pthread_create(&Threads[c], NULL, ConsumerThread, &Queue);
+  }
+  for (int p = 0; p < Producers; p++)
+  {
+    pthread_create(&Threads[Consumers + p], NULL, ProducerThread, &Queue);
+  }
+  for (int t = 0; t < Consumers + Producers; t++)
+  {
+    pthread_join(Threads[t], NULL);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Queue/%s/P=%d/C=%d", KindNames[Kind], Producers, Consumers);
+  BENCH_Report(Name, Queue.ItemsPerProducer * Producers, Elapsed);
+
+  SLIST_Destroy(&Queue.List);
+  MPSCQ_Destroy(&Queue.Mpsc);
+  MPMCQ_Destroy(&Queue.Mpmc);
+  pthread_mutex_destroy(&Queue.Lock);
+}
+
+static void*
+ProducerThread(void* Arg_p)
+{
+  SharedQueue_t* Queue_p = Arg_p;
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(&Queue_p->Mpmc);
+
+  for (size_t i = 0; i < Queue_p->ItemsPerProducer; i++)
+  {
+    switch (Queue_p->Kind)
+    {
+      case QUEUE_KIND_MUTEX_SLIST:
+        pthread_mutex_lock(&Queue_p->Lock);
+        SLIST_InsertLast(&Queue_p->List, &Item);
+        pthread_mutex_unlock(&Queue_p->Lock);
+        break;
+      case QUEUE_KIND_MPSCQ:
+        MPSCQ_InsertLast(&Queue_p->Mpsc, &Item);
+        break;
+      case QUEUE_KIND_MPMCQ:
+        MPMCQ_InsertLast(&Queue_p->Mpmc, Handle_p, &Item);
+        break;
+    }
+  }
+
+  MPMCQ_Unregister(&Queue_p->Mpmc, Handle_p);
+  return NULL;
+}
+
+static void*
+ConsumerThread(void* Arg_p)
+{
+  SharedQueue_t* Queue_p = Arg_p;
+  MPMCQ_Handle_t* Handle_p = MPMCQ_Register(&Queue_p->Mpmc);
+  size_t Total = TOTAL_ITEMS - TOTAL_ITEMS % Queue_p->ItemsPerProducer;
+
+  while (atomic_load_explicit(&Queue_p->Received, memory_order_relaxed) < Total)
+  {
+    void* Data_p = NULL;
+    switch (Queue_p->Kind)
+    {
+      case QUEUE_KIND_MUTEX_SLIST:
+        pthread_mutex_lock(&Queue_p->Lock);
+        if (!SLIST_IsEmpty(&Queue_p->List))
+        {
+          Data_p = SLIST_RemoveFirst(&Queue_p->List);
+        }
+        pthread_mutex_unlock(&Queue_p->Lock);
+        break;
+      case QUEUE_KIND_MPSCQ:
+        Data_p = MPSCQ_RemoveFirst(&Queue_p->Mpsc);
+        break;
+      case QUEUE_KIND_MPMCQ:
+        Data_p = MPMCQ_RemoveFirst(&Queue_p->Mpmc, Handle_p);
+        break;
+    }
+
+    if (Data_p != NULL)
+    {
+      atomic_fetch_add_explicit(&Queue_p->Received, 1, memory_order_relaxed);
+    }
+    else
+    {
+      sched_yield();
+    }
+  }
+
+  MPMCQ_Unregister(&Queue_p->Mpmc, Handle_p);
+  return NULL;
+}
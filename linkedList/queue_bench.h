@@ -0,0 +1,26 @@
+#ifndef QUEUE_BENCH_H
+#define QUEUE_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_QUEUE_Benchmarks(void);
+
+
+#endif // QUEUE_BENCH_H
@@ -0,0 +1,126 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "slist_replay.h"
+
+static void
+Usage(const char *const Program_p)
+{
+  fprintf(stderr, "Usage: %s [--variant NAME] [--json FILE] TRACE\nVariants:", Program_p);
+  for (int v = 0; v < SLIST_REPLAY_VARIANT_COUNT; v++)
+  {
+    fprintf(stderr, " %s", SLIST_ReplayVariantName((SLIST_ReplayVariant_t)v));
+  }
+  fprintf(stderr, "\n");
+}
+
+// Usage: slist_replay [--variant NAME] [--json FILE] TRACE
+// Replays a trace recorded with SLIST_TraceStart() as fast as possible, see
+// slist_replay.h.
+int
+main(int argc, char* argv[])
+{
+  SLIST_ReplayVariant_t Variant = SLIST_REPLAY_SLIST;
+  const char* Path_p = NULL;
+  char Name[96];
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--variant") == 0 && i + 1 < argc)
+    {
+      i++;
+      Variant = SLIST_REPLAY_VARIANT_COUNT;
+      for (int v = 0; v < SLIST_REPLAY_VARIANT_COUNT; v++)
+      {
+        if (strcmp(argv[i], SLIST_ReplayVariantName((SLIST_ReplayVariant_t)v)) == 0)
+        {
+          Variant = (SLIST_ReplayVariant_t)v;
+        }
+      }
+      if (Variant == SLIST_REPLAY_VARIANT_COUNT)
+      {
+        Usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    }
+    else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+    {
+      if (!BENCH_OpenLog(argv[++i]))
+      {
+        fprintf(stderr, "Cannot open %s\n", argv[i]);
+        return EXIT_FAILURE;
+      }
+    }
+    else if (Path_p == NULL && argv[i][0] != '-')
+    {
+      Path_p = argv[i];
+    }
+    else
+    {
+      Usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (Path_p == NULL)
+  {
+    Usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  size_t Count = 0;
+  SLIST_TraceRecord_t* Records_p = SLIST_ReplayLoad(Path_p, &Count);
+  if (Records_p == NULL)
+  {
+    fprintf(stderr, "Cannot read trace %s\n", Path_p);
+    return EXIT_FAILURE;
+  }
+
+  // The first run times the whole trace, the second every operation, which
+  // adds the cost of reading the clock to each of them
+  SLIST_Replay_t Replay;
+  SLIST_ReplayCreate(&Replay, Variant);
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_ReplayApply(&Replay, &Records_p[i]);
+  }
+  SLIST_ReplayFinish(&Replay);
+  uint64_t Elapsed = BENCH_Now() - Start;
+  size_t Mismatches = Replay.Mismatches;
+  size_t Skipped = Replay.Skipped;
+
+  uint64_t OpTime[SLIST_TRACE_OP_COUNT] = { 0 };
+  size_t OpCount[SLIST_TRACE_OP_COUNT] = { 0 };
+  for (size_t i = 0; i < Count; i++)
+  {
+    uint32_t Operation = Records_p[i].Operation;
+    Start = BENCH_Now();
+    SLIST_ReplayApply(&Replay, &Records_p[i]);
+    if (Operation < SLIST_TRACE_OP_COUNT)
+    {
+      OpTime[Operation] += BENCH_Now() - Start;
+      OpCount[Operation]++;
+    }
+  }
+  SLIST_ReplayDestroy(&Replay);
+
+  printf("Replay of %s on %s: %zu records, %zu mismatches, %zu skipped\n",
+         Path_p, SLIST_ReplayVariantName(Variant), Count, Mismatches, Skipped);
+  snprintf(Name, sizeof(Name), "replay/%s/total", SLIST_ReplayVariantName(Variant));
+  BENCH_Report(Name, Count, Elapsed);
+  for (int op = 0; op < SLIST_TRACE_OP_COUNT; op++)
+  {
+    if (OpCount[op] != 0)
+    {
+      snprintf(Name, sizeof(Name), "replay/%s/%s",
+               SLIST_ReplayVariantName(Variant), SLIST_TraceOpName((SLIST_TraceOp_t)op));
+      BENCH_Report(Name, OpCount[op], OpTime[op]);
+    }
+  }
+
+  free(Records_p);
+  BENCH_CloseLog();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,268 @@
+/* > Includes *****************************************************************/
+#include "skiplist.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+#define DEFAULT_SEED  UINT64_C(0x9e3779b97f4a7c15)
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static size_t
+RandomHeight(SKIPLIST_List_t *const List_p);
+
+static SKIPLIST_Node_t**
+FindLinks(const SKIPLIST_List_t *const List_p,
+          const void *const Data_p,
+          bool PassEqual,
+          SKIPLIST_Node_t** Links_pp[SKIPLIST_MAX_LEVEL]);
+
+static void
+UnlinkNode(SKIPLIST_List_t *const List_p,
+           SKIPLIST_Node_t *const Node_p,
+           SKIPLIST_Node_t** Links_pp[SKIPLIST_MAX_LEVEL]);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+SKIPLIST_Create(SKIPLIST_List_t *const List_p)
+{
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+  for (size_t level = 0; level < SKIPLIST_MAX_LEVEL; level++)
+  {
+    List_p->Heads_p[level] = NULL;
+  }
+  List_p->Level = 1;
+  List_p->Length = 0;
+  List_p->RandomState = DEFAULT_SEED;
+}
+
+void
+SKIPLIST_Destroy(SKIPLIST_List_t *const List_p)
+{
+  SKIPLIST_Node_t* node_p = List_p->Heads_p[0];
+  while (node_p != NULL)
+  {
+    SKIPLIST_Node_t* next_p = node_p->Next_p[0];
+    if (List_p->Callbacks.DataDestroy_fp != NULL)
+    {
+      List_p->Callbacks.DataDestroy_fp(node_p->Data_p);
+    }
+    free(node_p);
+    node_p = next_p;
+  }
+
+  for (size_t level = 0; level < SKIPLIST_MAX_LEVEL; level++)
+  {
+    List_p->Heads_p[level] = NULL;
+  }
+  List_p->Level = 1;
+  List_p->Length = 0;
+}
+
+bool
+SKIPLIST_IsEmpty(const SKIPLIST_List_t *const List_p)
+{
+  return (List_p->Heads_p[0] == NULL);
+}
+
+size_t
+SKIPLIST_Length(const SKIPLIST_List_t *const List_p)
+{
+  return List_p->Length;
+}
+
+void
+SKIPLIST_Insert(SKIPLIST_List_t *const List_p, const void *const Data_p)
+{
+  SKIPLIST_Node_t** links_pp[SKIPLIST_MAX_LEVEL];
+  FindLinks(List_p, Data_p, true, links_pp);
+
+  size_t height = RandomHeight(List_p);
+  for (size_t level = List_p->Level; level < height; level++)
+  {
+    links_pp[level] = &List_p->Heads_p[level];
+  }
+  if (height > List_p->Level)
+  {
+    List_p->Level = height;
+  }
+
+  SKIPLIST_Node_t* newNode = malloc(sizeof(SKIPLIST_Node_t) + height * sizeof(SKIPLIST_Node_t*));
+  newNode->Data_p = (void*)Data_p;
+  newNode->Height = height;
+  for (size_t level = 0; level < height; level++)
+  {
+    newNode->Next_p[level] = *links_pp[level];
+    *links_pp[level] = newNode;
+  }
+  List_p->Length++;
+}
+
+void*
+SKIPLIST_Find(const SKIPLIST_List_t *const List_p, const void *const SearchData_p)
+{
+  SKIPLIST_Node_t** links_pp[SKIPLIST_MAX_LEVEL];
+  SKIPLIST_Node_t* node_p = *FindLinks(List_p, SearchData_p, false, links_pp);
+
+  if (node_p != NULL && List_p->Callbacks.DataCompare_fp(node_p->Data_p, SearchData_p) == 0)
+  {
+    return node_p->Data_p;
+  }
+  return NULL;
+}
+
+void*
+SKIPLIST_RemoveSpecific(SKIPLIST_List_t *const List_p, const void *const SearchData_p)
+{
+  SKIPLIST_Node_t** links_pp[SKIPLIST_MAX_LEVEL];
+  SKIPLIST_Node_t* node_p = *FindLinks(List_p, SearchData_p, false, links_pp);
+
+  if (node_p == NULL || List_p->Callbacks.DataCompare_fp(node_p->Data_p, SearchData_p) != 0)
+  {
+    return NULL;
+  }
+
+  void* data_p = node_p->Data_p;
+  UnlinkNode(List_p, node_p, links_pp);
+  return data_p;
+}
+
+void*
+SKIPLIST_RemoveFirst(SKIPLIST_List_t *const List_p)
+{
+  SKIPLIST_Node_t** links_pp[SKIPLIST_MAX_LEVEL];
+  SKIPLIST_Node_t* node_p = List_p->Heads_p[0];
+
+  // The first node is first on every lane it is part of
+  for (size_t level = 0; level < node_p->Height; level++)
+  {
+    links_pp[level] = &List_p->Heads_p[level];
+  }
+
+  void* data_p = node_p->Data_p;
+  UnlinkNode(List_p, node_p, links_pp);
+  return data_p;
+}
+
+void
+SKIPLIST_Print(const SKIPLIST_List_t *const List_p)
+{
+  for (SKIPLIST_Node_t* node_p = List_p->Heads_p[0]; node_p != NULL; node_p = node_p->Next_p[0])
+  {
+    List_p->Callbacks.DataPrint_fp(node_p->Data_p);
+  }
+}
+
+void
+SKIPLIST_SetDestroyFunction(SKIPLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+SKIPLIST_SetPrintFunction(SKIPLIST_List_t *const List_p, DataPrint_t DataPrint_fp)
+{
+  List_p->Callbacks.DataPrint_fp = DataPrint_fp;
+}
+
+void
+SKIPLIST_SetCompareFunction(SKIPLIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+void
+SKIPLIST_SetSeed(SKIPLIST_List_t *const List_p, uint64_t Seed)
+{
+  // xorshift must not start from zero
+  List_p->RandomState = (Seed != 0) ? Seed : DEFAULT_SEED;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Draws a height of 1 with probability 3/4, 2 with 3/16 and so on, using two
+// bits of a xorshift64* number per lane
+static size_t
+RandomHeight(SKIPLIST_List_t *const List_p)
+{
+  uint64_t state = List_p->RandomState;
+  state ^= state >> 12;
+  state ^= state << 25;
+  state ^= state >> 27;
+  List_p->RandomState = state;
+  uint64_t bits = state * UINT64_C(0x2545f4914f6cdd1d);
+
+  size_t height = 1;
+  while ((bits & 3) == 0 && height < SKIPLIST_MAX_LEVEL)
+  {
+    height++;
+    bits >>= 2;
+  }
+  return height;
+}
+
+// Walks down from the highest lane and stores in Links_pp[level] the link
+// that leads to the first node on that lane which compares greater than or
+// equal to Data_p, or only greater if PassEqual is set. Returns the link on
+// the base level.
+static SKIPLIST_Node_t**
+FindLinks(const SKIPLIST_List_t *const List_p,
+          const void *const Data_p,
+          bool PassEqual,
+          SKIPLIST_Node_t** Links_pp[SKIPLIST_MAX_LEVEL])
+{
+  DataCompare_t compare_fp = List_p->Callbacks.DataCompare_fp;
+  int limit = PassEqual ? 0 : -1;
+
+  // The lanes of the node the walk is at, starting with the list heads
+  SKIPLIST_Node_t** lanes_pp = (SKIPLIST_Node_t**)List_p->Heads_p;
+  for (size_t level = List_p->Level; level-- > 0; )
+  {
+    while (lanes_pp[level] != NULL && compare_fp(lanes_pp[level]->Data_p, Data_p) <= limit)
+    {
+      lanes_pp = lanes_pp[level]->Next_p;
+    }
+    Links_pp[level] = &lanes_pp[level];
+  }
+  return Links_pp[0];
+}
+
+// Unlinks a node from all its lanes, given the links that lead to it, and
+// frees it. Lanes left empty are dropped from the list.
+static void
+UnlinkNode(SKIPLIST_List_t *const List_p,
+           SKIPLIST_Node_t *const Node_p,
+           SKIPLIST_Node_t** Links_pp[SKIPLIST_MAX_LEVEL])
+{
+  for (size_t level = 0; level < Node_p->Height; level++)
+  {
+    *Links_pp[level] = Node_p->Next_p[level];
+  }
+  while (List_p->Level > 1 && List_p->Heads_p[List_p->Level - 1] == NULL)
+  {
+    List_p->Level--;
+  }
+  free(Node_p);
+  List_p->Length--;
+}
@@ -0,0 +1,263 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+/*
+ * Skip List
+ *
+ * Sorted list after Pugh. All elements are linked in order on the base
+ * level, exactly like a singly linked list, and every node is also linked on
+ * a random number of express lanes above it, each lane holding about a
+ * quarter of the nodes of the lane below. Searches start on the highest lane
+ * and drop down a lane whenever the next node would overshoot, so finding,
+ * inserting and removing take O(log n) on average. The order is given by
+ * DataCompare_fp of the usual SLIST_Callbacks_t; equal elements are kept in
+ * the order they were inserted.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+// Number of lanes including the base level, enough for 4^32 elements
+#define SKIPLIST_MAX_LEVEL  32
+
+//
+// Visits every element of the list in order, with Variable set to the data of
+// the element, like SLIST_FOREACH(). The list must not be modified while the
+// loop runs, except by leaving the loop.
+//
+#define SKIPLIST_FOREACH(Variable, List_p)                                      \
+  for (const SKIPLIST_Node_t* Variable##_Node_p = (List_p)->Heads_p[0];         \
+       Variable##_Node_p != NULL && ((Variable) = Variable##_Node_p->Data_p, 1);\
+       Variable##_Node_p = Variable##_Node_p->Next_p[0])
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition
+//
+// Next_p[0] links the base level, Next_p[1] to Next_p[Height - 1] the express
+// lanes the node is part of.
+//
+
+typedef struct SKIPLIST_Node
+{
+  void*                 Data_p;
+  size_t                Height;
+  struct SKIPLIST_Node* Next_p[];
+} SKIPLIST_Node_t;
+
+
+//
+// List Definition
+//
+
+typedef struct SKIPLIST_List
+{
+  SLIST_Callbacks_t Callbacks;
+  SKIPLIST_Node_t*  Heads_p[SKIPLIST_MAX_LEVEL];
+  size_t            Level;
+  size_t            Length;
+  uint64_t          RandomState;
+} SKIPLIST_List_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates an empty skip list. The compare function must be set with
+ * SKIPLIST_SetCompareFunction() before elements are inserted.
+ *
+ * @param[in]     List_p  The list to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_Create(SKIPLIST_List_t *const List_p);
+
+
+/**
+ * @brief Destroys a list
+ *
+ * Frees all nodes. The data in the list is freed by the function set by
+ * SKIPLIST_SetDestroyFunction(), if any.
+ *
+ * @param[in]     List_p  The list to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_Destroy(SKIPLIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+SKIPLIST_IsEmpty(const SKIPLIST_List_t *const List_p);
+
+
+/**
+ * @brief Returns the number of elements in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+SKIPLIST_Length(const SKIPLIST_List_t *const List_p);
+
+
+/**
+ * @brief Inserts an item in order
+ *
+ * Inserts the data after all elements that do not compare greater. Takes
+ * O(log n) on average.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_Insert(SKIPLIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Finds a specific item in the list
+ *
+ * Returns the first item in the list that is equal to SearchData_p, according
+ * to the comparison function, without removing it. Takes O(log n) on
+ * average.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to search for
+ * @return        Pointer to the data in the list, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+SKIPLIST_Find(const SKIPLIST_List_t *const List_p, const void *const SearchData_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Removes the first item in the list that is equal to SearchData_p,
+ * according to the comparison function. The data is not freed but returned.
+ * Takes O(log n) on average.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to remove
+ * @return        Pointer to the removed data, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+SKIPLIST_RemoveSpecific(SKIPLIST_List_t *const List_p, const void *const SearchData_p);
+
+
+/**
+ * @brief Removes the first item in the list
+ *
+ * Removes the smallest element, which is first in every lane it is part
+ * of, in O(1) on average. The list must not be empty.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+SKIPLIST_RemoveFirst(SKIPLIST_List_t *const List_p);
+
+
+/**
+ * @brief Print the list
+ *
+ * Calls the print function for every element, in order.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_Print(const SKIPLIST_List_t *const List_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_SetDestroyFunction(SKIPLIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets print function for the list
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     DataPrint_fp  Pointer to the print function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_SetPrintFunction(SKIPLIST_List_t *const List_p, DataPrint_t DataPrint_fp);
+
+
+/**
+ * @brief Sets comparison function for the list
+ *
+ * The function orders the list and follows the same rules as for
+ * SLIST_SetCompareFunction().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_SetCompareFunction(SKIPLIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+/**
+ * @brief Seeds the generator of node heights
+ *
+ * The heights are drawn from a generator private to the list, so the shape
+ * of the list is reproducible for the same seed and sequence of operations.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Seed    Any value
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SKIPLIST_SetSeed(SKIPLIST_List_t *const List_p, uint64_t Seed);
+
+
+#endif // SKIPLIST_H
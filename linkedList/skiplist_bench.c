@@ -0,0 +1,190 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "skiplist.h"
+#include "slist.h"
+#include "skiplist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define LOOKUPS_PER_RUN       1000000
+
+// The plain list scans half of the list per lookup on average, so it does
+// fewer lookups on long lists, at least MIN_LINEAR_LOOKUPS
+#define LINEAR_NODES_PER_RUN  200000000
+#define MIN_LINEAR_LOOKUPS    5
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 1000, 100000, 10000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchSkipList(const int *const Keys_p, size_t Size);
+
+static void
+BenchSortedList(const int *const Keys_p, size_t Size);
+
+static int*
+ShuffledKeys(size_t Size);
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SKIPLIST_Benchmarks(void)
+{
+  printf("Sorted lookup and removal: SKIPLIST vs SLIST\n");
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    int* Keys_p = ShuffledKeys(ListSizes[i]);
+    BenchSkipList(Keys_p, ListSizes[i]);
+    BenchSortedList(Keys_p, ListSizes[i]);
+    free(Keys_p);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Inserts Size keys in random order, then finds random keys, then removes
+// random keys and inserts them again
+static void
+BenchSkipList(const int *const Keys_p, size_t Size)
+{
+  SKIPLIST_List_t List;
+  char Name[64];
+  unsigned int Seed = 1;
+
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    SKIPLIST_Insert(&List, &Keys_p[i]);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Insert/SKIPLIST/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Start = BENCH_Now();
+  for (size_t i = 0; i < LOOKUPS_PER_RUN; i++)
+  {
+    SKIPLIST_Find(&List, &Keys_p[rand_r(&Seed) % Size]);
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Find/SKIPLIST/N=%zu", Size);
+  BENCH_Report(Name, LOOKUPS_PER_RUN, Elapsed);
+
+  Start = BENCH_Now();
+  for (size_t i = 0; i < LOOKUPS_PER_RUN; i++)
+  {
+    SKIPLIST_Insert(&List, SKIPLIST_RemoveSpecific(&List, &Keys_p[rand_r(&Seed) % Size]));
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Remove+Insert/SKIPLIST/N=%zu", Size);
+  BENCH_Report(Name, LOOKUPS_PER_RUN, Elapsed);
+
+  SKIPLIST_Destroy(&List);
+}
+
+// The same on a plain list kept sorted. It is built with SLIST_Sort(), which
+// is not measured, as building it with SLIST_InsertSorted() takes O(n^2).
+static void
+BenchSortedList(const int *const Keys_p, size_t Size)
+{
+  SLIST_List_t List;
+  char Name[64];
+  unsigned int Seed = 1;
+  size_t Lookups = LINEAR_NODES_PER_RUN / Size;
+  if (Lookups > LOOKUPS_PER_RUN)
+  {
+    Lookups = LOOKUPS_PER_RUN;
+  }
+  if (Lookups < MIN_LINEAR_LOOKUPS)
+  {
+    Lookups = MIN_LINEAR_LOOKUPS;
+  }
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Keys_p[i]);
+  }
+  SLIST_Sort(&List);
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Lookups; i++)
+  {
+    SLIST_Find(&List, &Keys_p[rand_r(&Seed) % Size]);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Find/SLIST/N=%zu", Size);
+  BENCH_Report(Name, Lookups, Elapsed);
+
+  Start = BENCH_Now();
+  for (size_t i = 0; i < Lookups; i++)
+  {
+    SLIST_InsertSorted(&List, SLIST_RemoveSpecific(&List, &Keys_p[rand_r(&Seed) % Size]));
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Remove+Insert/SLIST/N=%zu", Size);
+  BENCH_Report(Name, Lookups, Elapsed);
+
+  SLIST_Destroy(&List);
+}
+
+// Returns the keys 0 to Size - 1 in a random order
+static int*
+ShuffledKeys(size_t Size)
+{
+  int* Keys_p = malloc(sizeof(int) * Size);
+  unsigned int Seed = 7;
+
+  for (size_t i = 0; i < Size; i++)
+  {
+    Keys_p[i] = (int)i;
+  }
+  for (size_t i = Size - 1; i > 0; i--)
+  {
+    size_t j = ((size_t)rand_r(&Seed) * ((size_t)RAND_MAX + 1) + (size_t)rand_r(&Seed)) % (i + 1);
+    int Swap = Keys_p[i];
+    Keys_p[i] = Keys_p[j];
+    Keys_p[j] = Swap;
+  }
+  return Keys_p;
+}
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
@@ -0,0 +1,26 @@
+#ifndef SKIPLIST_BENCH_H
+#define SKIPLIST_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SKIPLIST_Benchmarks(void);
+
+
+#endif // SKIPLIST_BENCH_H
@@ -0,0 +1,372 @@
+/* > Includes *****************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "skiplist.h"
+#include "skiplist_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define LIST_SIZE  5000
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int DestroyCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p);
+
+static void
+TestInsertKeepsOrder(CuTest* Test_p);
+
+static void
+TestEqualElementsKeepInsertionOrder(CuTest* Test_p);
+
+static void
+TestFind(CuTest* Test_p);
+
+static void
+TestRemoveSpecific(CuTest* Test_p);
+
+static void
+TestRemoveFirst(CuTest* Test_p);
+
+static void
+TestDestroyFunction(CuTest* Test_p);
+
+static CuSuite*
+Get_SKIPLIST_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SKIPLIST_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SKIPLIST_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+// Orders numbers by their tens only, so that e.g. 11 and 13 compare equal
+static int
+DataCompareTens(const void* const Data1_p, const void* const Data2_p)
+{
+  int Tens1 = *(const int*)Data1_p / 10;
+  int Tens2 = *(const int*)Data2_p / 10;
+  return (Tens1 > Tens2) - (Tens1 < Tens2);
+}
+
+static void
+DataDestroy(void* const Data_p)
+{
+  DestroyCount++;
+  free(Data_p);
+}
+
+// Fills Data_p with 0 to Count - 1 in a random order
+static void
+Shuffle(int *const Data_p, size_t Count, unsigned int Seed)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    Data_p[i] = (int)i;
+  }
+  for (size_t i = Count - 1; i > 0; i--)
+  {
+    Seed = Seed * 1103515245 + 12345;
+    size_t j = (Seed >> 8) % (i + 1);
+    int Swap = Data_p[i];
+    Data_p[i] = Data_p[j];
+    Data_p[j] = Swap;
+  }
+}
+
+// Checks that every lane of the list is sorted and holds only nodes tall
+// enough for it, and that the base level holds Length nodes
+static void
+AssertLanes(CuTest* Test_p, const SKIPLIST_List_t *const List_p)
+{
+  size_t Count = 0;
+  for (size_t Level = 0; Level < SKIPLIST_MAX_LEVEL; Level++)
+  {
+    const SKIPLIST_Node_t* Previous_p = NULL;
+    for (const SKIPLIST_Node_t* Node_p = List_p->Heads_p[Level]; Node_p != NULL; Node_p = Node_p->Next_p[Level])
+    {
+      CuAssertTrue(Test_p, Level < List_p->Level);
+      CuAssertTrue(Test_p, Node_p->Height > Level);
+      if (Previous_p != NULL)
+      {
+        CuAssertTrue(Test_p, List_p->Callbacks.DataCompare_fp(Previous_p->Data_p, Node_p->Data_p) <= 0);
+      }
+      Previous_p = Node_p;
+      Count += (Level == 0);
+    }
+  }
+  CuAssertTrue(Test_p, Count == SKIPLIST_Length(List_p));
+}
+
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+  int Key = 1;
+
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+  CuAssertTrue(Test_p, SKIPLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, SKIPLIST_Length(&List) == 0);
+  CuAssertPtrEquals(Test_p, NULL, SKIPLIST_Find(&List, &Key));
+  CuAssertPtrEquals(Test_p, NULL, SKIPLIST_RemoveSpecific(&List, &Key));
+  SKIPLIST_Destroy(&List);
+}
+
+
+static void
+TestInsertKeepsOrder(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * LIST_SIZE);
+
+  Shuffle(Data_p, LIST_SIZE, 3);
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    SKIPLIST_Insert(&List, &Data_p[i]);
+  }
+  AssertLanes(Test_p, &List);
+  CuAssertTrue(Test_p, List.Level > 3);
+
+  int Expected = 0;
+  int* Number_p;
+  SKIPLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, LIST_SIZE, Expected);
+
+  SKIPLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestEqualElementsKeepInsertionOrder(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+  int Data[] = { 21, 10, 25, 11, 22, 5, 12, 23, 24 };
+  int Expected[] = { 5, 10, 11, 12, 21, 25, 22, 23, 24 };
+
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareTens);
+  for (int i = 0; i < 9; i++)
+  {
+    SKIPLIST_Insert(&List, &Data[i]);
+  }
+  AssertLanes(Test_p, &List);
+
+  int i = 0;
+  int* Number_p;
+  SKIPLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected[i], *Number_p);
+    i++;
+  }
+
+  // The first equal element is found and removed first
+  int Key = 29;
+  CuAssertPtrEquals(Test_p, &Data[0], SKIPLIST_Find(&List, &Key));
+  CuAssertPtrEquals(Test_p, &Data[0], SKIPLIST_RemoveSpecific(&List, &Key));
+  CuAssertPtrEquals(Test_p, &Data[2], SKIPLIST_RemoveSpecific(&List, &Key));
+  AssertLanes(Test_p, &List);
+
+  SKIPLIST_Destroy(&List);
+}
+
+
+static void
+TestFind(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * LIST_SIZE);
+
+  Shuffle(Data_p, LIST_SIZE, 5);
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+  for (int i = 0; i < LIST_SIZE; i += 2)
+  {
+    SKIPLIST_Insert(&List, &Data_p[i]);
+  }
+
+  // The stored data is returned, not the search key
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    int* Found_p = SKIPLIST_Find(&List, &Data_p[i]);
+    CuAssertPtrEquals(Test_p, (i % 2 == 0) ? &Data_p[i] : NULL, Found_p);
+  }
+  int Below = -1;
+  int Above = LIST_SIZE;
+  CuAssertPtrEquals(Test_p, NULL, SKIPLIST_Find(&List, &Below));
+  CuAssertPtrEquals(Test_p, NULL, SKIPLIST_Find(&List, &Above));
+
+  SKIPLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestRemoveSpecific(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * LIST_SIZE);
+
+  Shuffle(Data_p, LIST_SIZE, 7);
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+  SKIPLIST_SetSeed(&List, 42);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    SKIPLIST_Insert(&List, &Data_p[i]);
+  }
+
+  // Remove the odd numbers, in another random order
+  for (int i = LIST_SIZE - 1; i >= 0; i--)
+  {
+    if (Data_p[i] % 2 == 1)
+    {
+      CuAssertPtrEquals(Test_p, &Data_p[i], SKIPLIST_RemoveSpecific(&List, &Data_p[i]));
+      CuAssertPtrEquals(Test_p, NULL, SKIPLIST_RemoveSpecific(&List, &Data_p[i]));
+    }
+  }
+  AssertLanes(Test_p, &List);
+  CuAssertTrue(Test_p, SKIPLIST_Length(&List) == LIST_SIZE / 2);
+
+  int Expected = 0;
+  int* Number_p;
+  SKIPLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected += 2;
+  }
+
+  // Removing everything drops all express lanes
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    SKIPLIST_RemoveSpecific(&List, &Data_p[i]);
+  }
+  CuAssertTrue(Test_p, SKIPLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, List.Level == 1);
+
+  SKIPLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestRemoveFirst(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * LIST_SIZE);
+
+  Shuffle(Data_p, LIST_SIZE, 9);
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    SKIPLIST_Insert(&List, &Data_p[i]);
+  }
+
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    CuAssertIntEquals(Test_p, i, *(int*)SKIPLIST_RemoveFirst(&List));
+    if (i % 1000 == 0)
+    {
+      AssertLanes(Test_p, &List);
+    }
+  }
+  CuAssertTrue(Test_p, SKIPLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, List.Level == 1);
+
+  SKIPLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestDestroyFunction(CuTest* Test_p)
+{
+  SKIPLIST_List_t List;
+
+  DestroyCount = 0;
+  SKIPLIST_Create(&List);
+  SKIPLIST_SetCompareFunction(&List, DataCompareInt);
+  SKIPLIST_SetDestroyFunction(&List, DataDestroy);
+  for (int i = 0; i < 100; i++)
+  {
+    int* Number_p = malloc(sizeof(int));
+    *Number_p = i % 7;
+    SKIPLIST_Insert(&List, Number_p);
+  }
+  SKIPLIST_Destroy(&List);
+  CuAssertIntEquals(Test_p, 100, DestroyCount);
+  CuAssertTrue(Test_p, SKIPLIST_IsEmpty(&List) == true);
+}
+
+
+static CuSuite*
+Get_SKIPLIST_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestInsertKeepsOrder);
+  SUITE_ADD_TEST(Suite_p, TestEqualElementsKeepInsertionOrder);
+  SUITE_ADD_TEST(Suite_p, TestFind);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecific);
+  SUITE_ADD_TEST(Suite_p, TestRemoveFirst);
+  SUITE_ADD_TEST(Suite_p, TestDestroyFunction);
+
+  return Suite_p;
+}
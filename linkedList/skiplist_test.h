@@ -0,0 +1,26 @@
+#ifndef SKIPLIST_TEST_H
+#define SKIPLIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SKIPLIST_Tests(void);
+
+
+#endif // SKIPLIST_TEST_H
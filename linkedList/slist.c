@@ -1,16 +1,89 @@
 /* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
 #include "slist.h"
+#include "slist_trace.h"
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stddef.h>
 #include <string.h>
+#include <time.h>
 
 
 /* > Defines ******************************************************************/
 
+// Smallest number of buckets of a hash index, must be a power of two
+#define INDEX_MIN_BUCKETS       64
+
+#define INDEX_ENTRIES_PER_SLAB  1024
+
+// Number of pending runs of SLIST_Sort(), run i holds 2^i nodes, which is
+// enough for any list that fits in memory
+#define SORT_MAX_RUNS           64
+
+// Instrumentation hooks, see SLIST_GetProfile(). Without SLIST_INSTRUMENT they
+// expand to nothing, and the scan counters they are given become dead code.
+// Loops that compare every node they visit count locally and report the
+// compares with the scan, an atomic add per compare would dominate them.
+#ifdef SLIST_INSTRUMENT
+#define PROFILE_BEGIN()              uint64_t profileStart = ProfileNow()
+#define PROFILE_END(Operation)       ProfileLatency((Operation), profileStart)
+#define PROFILE_ADD(Counter, Count)  \
+  atomic_fetch_add_explicit(&Profile.Counter, (Count), memory_order_relaxed)
+#define PROFILE_SCAN(Visited, Compares) ProfileScan((Visited), (Compares))
+#else
+#define PROFILE_BEGIN()              ((void)0)
+#define PROFILE_END(Operation)       ((void)0)
+#define PROFILE_ADD(Counter, Count)  ((void)(Count))
+#define PROFILE_SCAN(Visited, Compares) ((void)(Visited), (void)(Compares))
+#endif
+
+// Records an operation in the running trace, see slist_trace.h. The key is
+// only evaluated when a trace is recorded.
+#ifdef SLIST_TRACE
+#define TRACE(Operation, List_p, Key, Found)                                   \
+  do                                                                           \
+  {                                                                            \
+    if (SLIST_TraceIsActive())                                                 \
+    {                                                                          \
+      SLIST_TraceRecord((Operation), (uint64_t)(uintptr_t)(List_p), (Key), (Found)); \
+    }                                                                          \
+  } while (0)
+#define TRACE_MOVE(Operation, List_p, Other_p, Key, Position, First, Count, Found) \
+  do                                                                           \
+  {                                                                            \
+    if (SLIST_TraceIsActive())                                                 \
+    {                                                                          \
+      TraceMove((Operation), (List_p), (Other_p), (Key), (Position), (First), (Count), (Found)); \
+    }                                                                          \
+  } while (0)
+#else
+#define TRACE(Operation, List_p, Key, Found)  ((void)0)
+#define TRACE_MOVE(Operation, List_p, Other_p, Key, Position, First, Count, Found) ((void)0)
+#endif
+
+// Calls the comparison function of the list and counts the call, for the
+// few compares outside of scans
+#define COMPARE(List_p, Data1_p, Data2_p) \
+  (PROFILE_ADD(Compares, 1), (List_p)->Callbacks.DataCompare_fp((Data1_p), (Data2_p)))
+
 
 /* > Type Declarations  *******************************************************/
 
+#ifdef SLIST_INSTRUMENT
+typedef struct Profile
+{
+  _Atomic uint64_t NodeAllocs;
+  _Atomic uint64_t NodeFrees;
+  _Atomic uint64_t Compares;
+  _Atomic uint64_t Scans;
+  _Atomic uint64_t NodesVisited;
+  _Atomic uint64_t ScanLength[SLIST_HISTOGRAM_BUCKETS];
+  _Atomic uint64_t Latency[SLIST_OP_COUNT][SLIST_HISTOGRAM_BUCKETS];
+} Profile_t;
+#endif
+
 
 /* > Global Constant Definitions **********************************************/
 
@@ -20,12 +93,155 @@
 
 /* > Local Constant Definitions ***********************************************/
 
+static const char *const OperationNames[SLIST_OP_COUNT] =
+{
+  "InsertFirst",
+  "InsertLast",
+  "RemoveFirst",
+  "RemoveLast",
+  "RemoveSpecific",
+  "Find",
+  "InsertSorted",
+  "Sort",
+  "AllocNode"
+};
+
 
 /* > Local Variable Definitions ***********************************************/
 
+#ifdef SLIST_INSTRUMENT
+static Profile_t Profile;
+#endif
+
 
 /* > Local Function Declarations **********************************************/
 
+static SLIST_Node_t*
+AllocNode(SLIST_List_t *const List_p);
+
+static void
+FreeNode(SLIST_List_t *const List_p, SLIST_Node_t *const Node_p);
+
+static SLIST_Node_t*
+AllocNodes(SLIST_List_t *const List_p,
+           void *const *const Data_pp,
+           size_t Count,
+           SLIST_Node_t** Last_pp);
+
+static void
+CountInsert(SLIST_List_t *const List_p);
+
+static void
+CountRemove(SLIST_List_t *const List_p);
+
+static size_t
+MixHash(size_t Hash);
+
+static size_t
+IndexHash(const SLIST_List_t *const List_p, const void *const Data_p);
+
+static SLIST_IndexEntry_t**
+IndexBucket(const SLIST_Index_t *const Index_p, size_t Hash);
+
+static void
+IndexAdd(SLIST_List_t *const List_p,
+         SLIST_Node_t *const Node_p,
+         SLIST_Node_t *const Prev_p,
+         int64_t Sequence);
+
+static SLIST_IndexEntry_t**
+IndexLinkOf(const SLIST_List_t *const List_p, const SLIST_Node_t *const Node_p);
+
+static SLIST_IndexEntry_t**
+IndexLookup(const SLIST_List_t *const List_p, const void *const SearchData_p);
+
+static void
+IndexUnlink(SLIST_List_t *const List_p, SLIST_IndexEntry_t** Link_pp);
+
+static void
+IndexSetPrev(const SLIST_List_t *const List_p,
+             SLIST_Node_t *const Node_p,
+             SLIST_Node_t *const Prev_p);
+
+static void
+IndexGrow(SLIST_Index_t *const Index_p);
+
+static void*
+RemoveIndexed(SLIST_List_t *const List_p, const void *const SearchData_p);
+
+static void
+IndexRenumber(const SLIST_List_t *const List_p);
+
+static SLIST_Node_t*
+MergeRuns(const SLIST_List_t *const List_p,
+          SLIST_Node_t* First_p,
+          SLIST_Node_t* Second_p,
+          SLIST_Node_t** Last_pp);
+
+static void
+CountInsertMany(SLIST_List_t *const List_p, size_t Count);
+
+static SLIST_Node_t*
+NodeBefore(const SLIST_List_t *const List_p, size_t Position);
+
+static SLIST_Node_t*
+UnlinkChain(SLIST_List_t *const Source_p,
+            SLIST_Node_t *const Before_p,
+            SLIST_Node_t *const Last_p,
+            size_t Count);
+
+static SLIST_Node_t*
+MoveNodes(SLIST_List_t *const List_p,
+          SLIST_List_t *const Source_p,
+          SLIST_Node_t* First_p,
+          SLIST_Node_t** Last_pp);
+
+static void
+LinkChain(SLIST_List_t *const List_p,
+          SLIST_Node_t *const After_p,
+          SLIST_List_t *const Source_p,
+          SLIST_Node_t* First_p,
+          SLIST_Node_t* Last_p,
+          size_t Count);
+
+static void
+PromoteNode(SLIST_List_t *const List_p,
+            SLIST_Node_t *const BeforePrevious_p,
+            SLIST_Node_t *const Previous_p,
+            SLIST_Node_t *const Node_p);
+
+static void
+ReleaseNodes(SLIST_List_t *const List_p);
+
+#ifdef SLIST_TRACE
+static uint64_t
+TraceKey(const SLIST_List_t *const List_p, const void *const Data_p);
+
+static void
+TraceMove(SLIST_TraceOp_t Operation,
+          const SLIST_List_t *const List_p,
+          const SLIST_List_t *const Other_p,
+          uint64_t Key,
+          size_t Position,
+          size_t First,
+          size_t Count,
+          bool Found);
+#endif
+
+#ifdef SLIST_INSTRUMENT
+static uint64_t
+ProfileNow(void);
+
+static void
+ProfileLatency(SLIST_Operation_t Operation, uint64_t Start);
+
+static void
+ProfileScan(size_t Visited, size_t Compares);
+
+static size_t
+HistogramBucket(uint64_t Value);
+#endif
+
 
 /* > Global Function Definitions **********************************************/
 
@@ -35,12 +251,39 @@ SLIST_Create(SLIST_List_t *const List_p)
 {
   List_p->Head_p = NULL;
   List_p->Tail_p = NULL;
+  List_p->Pool_p = NULL;
+  List_p->Index_p = NULL;
   memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+  memset(&List_p->Stats, 0, sizeof(SLIST_Stats_t));
+  List_p->FindPolicy = SLIST_FIND_STATIC;
+  TRACE(SLIST_TRACE_CREATE, List_p, 0, true);
+}
+
+void
+SLIST_CreateWithPool(SLIST_List_t *const List_p, size_t NodesPerSlab)
+{
+  SLIST_Create(List_p);
+  List_p->Pool_p = malloc(sizeof(NODEPOOL_Pool_t));
+  NODEPOOL_Create(List_p->Pool_p, sizeof(SLIST_Node_t), NodesPerSlab);
+}
+
+void
+SLIST_CreateWithSharedPool(SLIST_List_t *const List_p, const SLIST_List_t *const Owner_p)
+{
+  SLIST_Create(List_p);
+  List_p->Pool_p = Owner_p->Pool_p;
+  if (List_p->Pool_p != NULL)
+  {
+    NODEPOOL_Retain(List_p->Pool_p);
+  }
 }
 
 void
 SLIST_Destroy(SLIST_List_t *const List_p)
 {
+  TRACE(SLIST_TRACE_DESTROY, List_p, 0, true);
+  SLIST_DestroyIndex(List_p);
+
   if (List_p->Callbacks.DataDestroy_fp != NULL)
   {
 	SLIST_Node_t* destroy_p = List_p->Head_p;
@@ -50,8 +293,11 @@ SLIST_Destroy(SLIST_List_t *const List_p)
 	  destroy_p = destroy_p->Next_p;
 	}
   }
+
+  ReleaseNodes(List_p);
   List_p->Head_p = NULL;
   List_p->Tail_p = NULL;
+  List_p->Stats.Length = 0;
 }
 
 bool
@@ -60,24 +306,107 @@ SLIST_IsEmpty(const SLIST_List_t *const List_p)
   return (List_p->Head_p == NULL);
 }
 
-int
+size_t
 SLIST_Length(const SLIST_List_t *const List_p)
 {
-  int listLength = 0;
-  SLIST_Node_t* listIterator_p = List_p->Head_p;
+  return List_p->Stats.Length;
+}
+
+void
+SLIST_GetStats(const SLIST_List_t *const List_p, SLIST_Stats_t *const Stats_p)
+{
+  *Stats_p = List_p->Stats;
+}
+
+bool
+SLIST_GetProfile(SLIST_Profile_t *const Profile_p)
+{
+#ifdef SLIST_INSTRUMENT
+  Profile_p->NodeAllocs = atomic_load_explicit(&Profile.NodeAllocs, memory_order_relaxed);
+  Profile_p->NodeFrees = atomic_load_explicit(&Profile.NodeFrees, memory_order_relaxed);
+  Profile_p->Compares = atomic_load_explicit(&Profile.Compares, memory_order_relaxed);
+  Profile_p->Scans = atomic_load_explicit(&Profile.Scans, memory_order_relaxed);
+  Profile_p->NodesVisited = atomic_load_explicit(&Profile.NodesVisited, memory_order_relaxed);
+  for (size_t b = 0; b < SLIST_HISTOGRAM_BUCKETS; b++)
+  {
+    Profile_p->ScanLength[b] = atomic_load_explicit(&Profile.ScanLength[b], memory_order_relaxed);
+    for (size_t op = 0; op < SLIST_OP_COUNT; op++)
+    {
+      Profile_p->Latency[op][b] = atomic_load_explicit(&Profile.Latency[op][b],
+                                                       memory_order_relaxed);
+    }
+  }
+  return true;
+#else
+  memset(Profile_p, 0, sizeof(SLIST_Profile_t));
+  return false;
+#endif
+}
 
-  while (listIterator_p != NULL)
+void
+SLIST_ResetProfile(void)
+{
+#ifdef SLIST_INSTRUMENT
+  atomic_store_explicit(&Profile.NodeAllocs, 0, memory_order_relaxed);
+  atomic_store_explicit(&Profile.NodeFrees, 0, memory_order_relaxed);
+  atomic_store_explicit(&Profile.Compares, 0, memory_order_relaxed);
+  atomic_store_explicit(&Profile.Scans, 0, memory_order_relaxed);
+  atomic_store_explicit(&Profile.NodesVisited, 0, memory_order_relaxed);
+  for (size_t b = 0; b < SLIST_HISTOGRAM_BUCKETS; b++)
   {
-	listIterator_p = listIterator_p->Next_p;
-	listLength++;
+    atomic_store_explicit(&Profile.ScanLength[b], 0, memory_order_relaxed);
+    for (size_t op = 0; op < SLIST_OP_COUNT; op++)
+    {
+      atomic_store_explicit(&Profile.Latency[op][b], 0, memory_order_relaxed);
+    }
   }
-  return listLength;
+#endif
+}
+
+const char*
+SLIST_OperationName(SLIST_Operation_t Operation)
+{
+  return (Operation < SLIST_OP_COUNT) ? OperationNames[Operation] : "Unknown";
+}
+
+uint64_t
+SLIST_HistogramPercentile(const uint64_t *const Histogram_p, unsigned int Percent)
+{
+  uint64_t total = 0;
+  for (size_t b = 0; b < SLIST_HISTOGRAM_BUCKETS; b++)
+  {
+    total += Histogram_p[b];
+  }
+  if (total == 0)
+  {
+    return 0;
+  }
+
+  uint64_t rank = (total * Percent + 99) / 100;
+  uint64_t count = 0;
+  size_t bucket = 0;
+  if (rank == 0)
+  {
+    rank = 1;
+  }
+  while (count + Histogram_p[bucket] < rank)
+  {
+    count += Histogram_p[bucket];
+    bucket++;
+  }
+
+  if (bucket == SLIST_HISTOGRAM_BUCKETS - 1)
+  {
+    return UINT64_MAX;
+  }
+  return (bucket == 0) ? 0 : ((uint64_t)1 << bucket) - 1;
 }
 
 void
 SLIST_InsertFirst(SLIST_List_t *const List_p, const void *const Data_p)
 {
-  SLIST_Node_t* newNode = malloc(sizeof(SLIST_Node_t));
+  PROFILE_BEGIN();
+  SLIST_Node_t* newNode = AllocNode(List_p);
   newNode->Data_p = (void*)Data_p;
 
   if (List_p->Head_p == NULL)
@@ -91,12 +420,23 @@ SLIST_InsertFirst(SLIST_List_t *const List_p, const void *const Data_p)
    newNode -> Next_p = List_p -> Head_p;
    List_p -> Head_p = newNode;
   }
+
+  if (List_p->Index_p != NULL)
+  {
+    IndexAdd(List_p, newNode, NULL, --List_p->Index_p->FirstSequence);
+    IndexSetPrev(List_p, newNode->Next_p, newNode);
+  }
+  CountInsert(List_p);
+  PROFILE_END(SLIST_OP_INSERT_FIRST);
+  TRACE(SLIST_TRACE_INSERT_FIRST, List_p, TraceKey(List_p, Data_p), true);
 }
 
 void
 SLIST_InsertLast(SLIST_List_t *const List_p, const void *const Data_p)
 {
-  SLIST_Node_t* newNode = malloc(sizeof(SLIST_Node_t));
+  PROFILE_BEGIN();
+  SLIST_Node_t* newNode = AllocNode(List_p);
+  SLIST_Node_t* previous_p = NULL;
   newNode->Data_p = (void*)Data_p;
   newNode->Next_p = NULL;
 
@@ -107,14 +447,43 @@ SLIST_InsertLast(SLIST_List_t *const List_p, const void *const Data_p)
   }
   else
   {
+    previous_p = List_p->Tail_p;
     List_p -> Tail_p -> Next_p = newNode;
 	List_p -> Tail_p = newNode;
   }
+
+  if (List_p->Index_p != NULL)
+  {
+    IndexAdd(List_p, newNode, previous_p, ++List_p->Index_p->LastSequence);
+  }
+  CountInsert(List_p);
+  PROFILE_END(SLIST_OP_INSERT_LAST);
+  TRACE(SLIST_TRACE_INSERT_LAST, List_p, TraceKey(List_p, Data_p), true);
+}
+
+void
+SLIST_InsertLastBatch(SLIST_List_t *const List_p,
+                      void *const *const Data_pp,
+                      size_t Count)
+{
+  if (Count == 0)
+  {
+    return;
+  }
+
+  SLIST_Node_t* last_p = NULL;
+  SLIST_Node_t* first_p = AllocNodes(List_p, Data_pp, Count, &last_p);
+  LinkChain(List_p, List_p->Tail_p, List_p, first_p, last_p, Count);
+  for (size_t i = 0; i < Count; i++)
+  {
+    TRACE(SLIST_TRACE_INSERT_LAST, List_p, TraceKey(List_p, Data_pp[i]), true);
+  }
 }
 
 void*
 SLIST_RemoveFirst(SLIST_List_t *const List_p)
 {
+  PROFILE_BEGIN();
   SLIST_Node_t* Remove_p = NULL;
 
   if (List_p->Head_p->Next_p == NULL)
@@ -128,14 +497,54 @@ SLIST_RemoveFirst(SLIST_List_t *const List_p)
 	Remove_p = List_p->Head_p;
 	List_p -> Head_p = Remove_p->Next_p;
   }
+
+  if (List_p->Index_p != NULL)
+  {
+    IndexUnlink(List_p, IndexLinkOf(List_p, Remove_p));
+    IndexSetPrev(List_p, List_p->Head_p, NULL);
+  }
   void* Data_p = Remove_p->Data_p;
-  free(Remove_p);
+  FreeNode(List_p, Remove_p);
+  CountRemove(List_p);
+  PROFILE_END(SLIST_OP_REMOVE_FIRST);
+  TRACE(SLIST_TRACE_REMOVE_FIRST, List_p, TraceKey(List_p, Data_p), true);
   return Data_p;
 }
 
+size_t
+SLIST_RemoveFirstBatch(SLIST_List_t *const List_p, void** const Data_pp, size_t Max)
+{
+  size_t count = (Max < List_p->Stats.Length) ? Max : List_p->Stats.Length;
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  SLIST_Node_t* last_p = List_p->Head_p;
+  for (size_t i = 0; i < count; i++)
+  {
+    Data_pp[i] = last_p->Data_p;
+    TRACE(SLIST_TRACE_REMOVE_FIRST, List_p, TraceKey(List_p, Data_pp[i]), true);
+    if (i + 1 < count)
+    {
+      last_p = last_p->Next_p;
+    }
+  }
+
+  SLIST_Node_t* free_p = UnlinkChain(List_p, NULL, last_p, count);
+  while (free_p != NULL)
+  {
+    SLIST_Node_t* next_p = free_p->Next_p;
+    FreeNode(List_p, free_p);
+    free_p = next_p;
+  }
+  return count;
+}
+
 void*
 SLIST_RemoveLast(SLIST_List_t *const List_p)
 {
+  PROFILE_BEGIN();
   void* Data_p = NULL;
   SLIST_Node_t* nodePointer_p = NULL;
   if (List_p->Head_p->Next_p == NULL)
@@ -144,8 +553,16 @@ SLIST_RemoveLast(SLIST_List_t *const List_p)
 	List_p->Head_p = NULL;
 	List_p->Tail_p = NULL;
   }
+  else if (List_p->Index_p != NULL)
+  {
+    // The index knows the predecessor of the tail, no need to walk there
+    nodePointer_p = List_p->Tail_p;
+    List_p->Tail_p = (*IndexLinkOf(List_p, nodePointer_p))->Prev_p;
+    List_p->Tail_p->Next_p = NULL;
+  }
   else
   {
+    PROFILE_SCAN(List_p->Stats.Length - 1, 0);
     nodePointer_p = List_p->Head_p;
 	while (nodePointer_p -> Next_p != List_p -> Tail_p)
 	{
@@ -155,16 +572,34 @@ SLIST_RemoveLast(SLIST_List_t *const List_p)
 	nodePointer_p = nodePointer_p -> Next_p;
 	List_p->Tail_p->Next_p = NULL;
   }
+
+  if (List_p->Index_p != NULL)
+  {
+    IndexUnlink(List_p, IndexLinkOf(List_p, nodePointer_p));
+  }
   Data_p = nodePointer_p->Data_p;
-  free(nodePointer_p);
+  FreeNode(List_p, nodePointer_p);
+  CountRemove(List_p);
+  PROFILE_END(SLIST_OP_REMOVE_LAST);
+  TRACE(SLIST_TRACE_REMOVE_LAST, List_p, TraceKey(List_p, Data_p), true);
   return Data_p;
 }
 
 void*
 SLIST_RemoveSpecific(SLIST_List_t *const List_p, const void* const SearchData_p)
 {
+  PROFILE_BEGIN();
+  if (List_p->Index_p != NULL)
+  {
+    void* found_p = RemoveIndexed(List_p, SearchData_p);
+    PROFILE_END(SLIST_OP_REMOVE_SPECIFIC);
+    TRACE(SLIST_TRACE_REMOVE_SPECIFIC, List_p, TraceKey(List_p, SearchData_p), found_p != NULL);
+    return found_p;
+  }
+
   SLIST_Node_t* currentNode_p = List_p->Head_p;
   SLIST_Node_t* previousNode_p = NULL;
+  size_t visited = 0;
 
   // Traversing the list to find the node to be deleted
   while (currentNode_p != NULL &&
@@ -172,35 +607,415 @@ SLIST_RemoveSpecific(SLIST_List_t *const List_p, const void* const SearchData_p)
   {
 	previousNode_p = currentNode_p;
 	currentNode_p = currentNode_p->Next_p;
+	visited++;
   }
+  visited += (currentNode_p != NULL);
+  PROFILE_SCAN(visited, visited);
 
   // Check if the node is in the list otherwise return
   if (currentNode_p == NULL)
   {
+	PROFILE_END(SLIST_OP_REMOVE_SPECIFIC);
+	TRACE(SLIST_TRACE_REMOVE_SPECIFIC, List_p, TraceKey(List_p, SearchData_p), false);
 	return NULL;
   }
-  else if (currentNode_p == List_p->Head_p)
+
+  void* Data_p = currentNode_p->Data_p;
+  if (currentNode_p == List_p->Head_p)
   {
 	previousNode_p = currentNode_p;
 	currentNode_p = currentNode_p->Next_p;
 	List_p->Head_p = currentNode_p;
+	if (List_p->Tail_p == previousNode_p)
+	{
+	  List_p->Tail_p = NULL;
+	}
 	previousNode_p->Next_p = NULL;
-	free(previousNode_p);
+	FreeNode(List_p, previousNode_p);
   }
   else if (currentNode_p == List_p->Tail_p)
   {
 	List_p->Tail_p = previousNode_p;
 	previousNode_p->Next_p = NULL;
-	free(currentNode_p);
+	FreeNode(List_p, currentNode_p);
   }
   else
   {
     previousNode_p->Next_p = NULL;
     previousNode_p->Next_p = currentNode_p->Next_p;
     currentNode_p->Next_p = NULL;
-    free(currentNode_p);
+    FreeNode(List_p, currentNode_p);
+  }
+  CountRemove(List_p);
+  PROFILE_END(SLIST_OP_REMOVE_SPECIFIC);
+  TRACE(SLIST_TRACE_REMOVE_SPECIFIC, List_p, TraceKey(List_p, SearchData_p), true);
+  return Data_p;
+}
+
+void*
+SLIST_Find(SLIST_List_t *const List_p, const void* const SearchData_p)
+{
+  PROFILE_BEGIN();
+  if (List_p->Index_p != NULL)
+  {
+    SLIST_IndexEntry_t** link_pp = IndexLookup(List_p, SearchData_p);
+    PROFILE_END(SLIST_OP_FIND);
+    TRACE(SLIST_TRACE_FIND, List_p, TraceKey(List_p, SearchData_p), link_pp != NULL);
+    return (link_pp != NULL) ? (*link_pp)->Node_p->Data_p : NULL;
+  }
+
+  SLIST_Node_t* beforePrevious_p = NULL;
+  SLIST_Node_t* previous_p = NULL;
+  size_t visited = 0;
+  for (SLIST_Node_t* node_p = List_p->Head_p; node_p != NULL; node_p = node_p->Next_p)
+  {
+    visited++;
+    if (List_p->Callbacks.DataCompare_fp(node_p->Data_p, SearchData_p) == 0)
+    {
+      if (previous_p != NULL)
+      {
+        PromoteNode(List_p, beforePrevious_p, previous_p, node_p);
+      }
+      PROFILE_SCAN(visited, visited);
+      PROFILE_END(SLIST_OP_FIND);
+      TRACE(SLIST_TRACE_FIND, List_p, TraceKey(List_p, SearchData_p), true);
+      return node_p->Data_p;
+    }
+    beforePrevious_p = previous_p;
+    previous_p = node_p;
+  }
+  PROFILE_SCAN(visited, visited);
+  PROFILE_END(SLIST_OP_FIND);
+  TRACE(SLIST_TRACE_FIND, List_p, TraceKey(List_p, SearchData_p), false);
+  return NULL;
+}
+
+void
+SLIST_InsertSorted(SLIST_List_t *const List_p, const void *const Data_p)
+{
+  PROFILE_BEGIN();
+  SLIST_Node_t* previous_p = NULL;
+  SLIST_Node_t* next_p = List_p->Head_p;
+  size_t visited = 0;
+  while (next_p != NULL && List_p->Callbacks.DataCompare_fp(next_p->Data_p, Data_p) <= 0)
+  {
+    previous_p = next_p;
+    next_p = next_p->Next_p;
+    visited++;
+  }
+  visited += (next_p != NULL);
+  PROFILE_SCAN(visited, visited);
+
+  SLIST_Node_t* newNode = AllocNode(List_p);
+  newNode->Data_p = (void*)Data_p;
+  newNode->Next_p = next_p;
+  if (previous_p == NULL)
+  {
+    List_p->Head_p = newNode;
+  }
+  else
+  {
+    previous_p->Next_p = newNode;
+  }
+  if (next_p == NULL)
+  {
+    List_p->Tail_p = newNode;
+  }
+
+  if (List_p->Index_p != NULL)
+  {
+    // There is no free sequence number between two neighbours, number the
+    // list again; the walk to the position was O(n) anyway
+    IndexAdd(List_p, newNode, previous_p, 0);
+    IndexRenumber(List_p);
+  }
+  CountInsert(List_p);
+  PROFILE_END(SLIST_OP_INSERT_SORTED);
+  TRACE(SLIST_TRACE_INSERT_SORTED, List_p, TraceKey(List_p, Data_p), true);
+}
+
+void
+SLIST_Sort(SLIST_List_t *const List_p)
+{
+  TRACE(SLIST_TRACE_SORT, List_p, 0, true);
+
+  // runs_p[i] is either empty or a sorted run of exactly 2^i nodes, and holds
+  // nodes from before those of every run with a lower index
+  SLIST_Node_t* runs_p[SORT_MAX_RUNS] = { NULL };
+  size_t runCount = 0;
+
+  if (List_p->Head_p == NULL)
+  {
+    return;
+  }
+
+  PROFILE_BEGIN();
+  SLIST_Node_t* node_p = List_p->Head_p;
+  while (node_p != NULL)
+  {
+    SLIST_Node_t* carry_p = node_p;
+    node_p = node_p->Next_p;
+    carry_p->Next_p = NULL;
+
+    size_t i = 0;
+    while (runs_p[i] != NULL)
+    {
+      carry_p = MergeRuns(List_p, runs_p[i], carry_p, NULL);
+      runs_p[i] = NULL;
+      i++;
+    }
+    runs_p[i] = carry_p;
+    if (i == runCount)
+    {
+      runCount++;
+    }
+  }
+
+  SLIST_Node_t* sorted_p = NULL;
+  SLIST_Node_t* last_p = NULL;
+  for (size_t i = 0; i < runCount; i++)
+  {
+    if (runs_p[i] != NULL)
+    {
+      // The highest run is never empty and gives the final merge
+      sorted_p = MergeRuns(List_p, runs_p[i], sorted_p,
+                           (i == runCount - 1) ? &last_p : NULL);
+    }
+  }
+  List_p->Head_p = sorted_p;
+  List_p->Tail_p = last_p;
+
+  if (List_p->Index_p != NULL)
+  {
+    IndexRenumber(List_p);
+  }
+  PROFILE_END(SLIST_OP_SORT);
+}
+
+void
+SLIST_Merge(SLIST_List_t *const List_p, SLIST_List_t *const Source_p)
+{
+  TRACE_MOVE(SLIST_TRACE_MERGE, List_p, Source_p, 0, 0, 0, 0, true);
+  size_t count = Source_p->Stats.Length;
+  if (count == 0)
+  {
+    return;
+  }
+
+  SLIST_Node_t* last_p = Source_p->Tail_p;
+  SLIST_Node_t* source_p = UnlinkChain(Source_p, NULL, last_p, count);
+  if (List_p->Pool_p != Source_p->Pool_p)
+  {
+    source_p = MoveNodes(List_p, Source_p, source_p, &last_p);
+  }
+  if (List_p->Index_p != NULL)
+  {
+    for (SLIST_Node_t* node_p = source_p; node_p != NULL; node_p = node_p->Next_p)
+    {
+      IndexAdd(List_p, node_p, NULL, 0);
+    }
+  }
+
+  List_p->Head_p = MergeRuns(List_p, List_p->Head_p, source_p, &last_p);
+  List_p->Tail_p = last_p;
+
+  if (List_p->Index_p != NULL)
+  {
+    IndexRenumber(List_p);
+  }
+  CountInsertMany(List_p, count);
+}
+
+void
+SLIST_Concat(SLIST_List_t *const List_p, SLIST_List_t *const Source_p)
+{
+  TRACE_MOVE(SLIST_TRACE_CONCAT, List_p, Source_p, 0, 0, 0, 0, true);
+  size_t count = Source_p->Stats.Length;
+  if (count == 0)
+  {
+    return;
+  }
+
+  SLIST_Node_t* last_p = Source_p->Tail_p;
+  SLIST_Node_t* first_p = UnlinkChain(Source_p, NULL, last_p, count);
+  LinkChain(List_p, List_p->Tail_p, Source_p, first_p, last_p, count);
+}
+
+void
+SLIST_SplitAt(SLIST_List_t *const List_p, size_t Position, SLIST_List_t *const Rest_p)
+{
+  TRACE_MOVE(SLIST_TRACE_SPLIT_AT, List_p, Rest_p, 0, Position, 0, 0, true);
+  if (Position >= List_p->Stats.Length)
+  {
+    return;
+  }
+
+  size_t count = List_p->Stats.Length - Position;
+  SLIST_Node_t* last_p = List_p->Tail_p;
+  SLIST_Node_t* first_p = UnlinkChain(List_p, NodeBefore(List_p, Position), last_p, count);
+  LinkChain(Rest_p, Rest_p->Tail_p, List_p, first_p, last_p, count);
+}
+
+bool
+SLIST_SplitAfter(SLIST_List_t *const List_p,
+                 const void *const SearchData_p,
+                 SLIST_List_t *const Rest_p)
+{
+  SLIST_Node_t* found_p = List_p->Head_p;
+  size_t position = 1;
+  while (found_p != NULL &&
+         List_p->Callbacks.DataCompare_fp(found_p->Data_p, SearchData_p) != 0)
+  {
+    found_p = found_p->Next_p;
+    position++;
+  }
+  size_t visited = (found_p != NULL) ? position : position - 1;
+  PROFILE_SCAN(visited, visited);
+  TRACE_MOVE(SLIST_TRACE_SPLIT_AFTER, List_p, Rest_p, TraceKey(List_p, SearchData_p),
+             0, 0, 0, found_p != NULL);
+  if (found_p == NULL)
+  {
+    return false;
+  }
+
+  size_t count = List_p->Stats.Length - position;
+  if (count > 0)
+  {
+    SLIST_Node_t* last_p = List_p->Tail_p;
+    SLIST_Node_t* first_p = UnlinkChain(List_p, found_p, last_p, count);
+    LinkChain(Rest_p, Rest_p->Tail_p, List_p, first_p, last_p, count);
+  }
+  return true;
+}
+
+void
+SLIST_SpliceRange(SLIST_List_t *const List_p,
+                  size_t Position,
+                  SLIST_List_t *const Source_p,
+                  size_t First,
+                  size_t Count)
+{
+  TRACE_MOVE(SLIST_TRACE_SPLICE_RANGE, List_p, Source_p, 0, Position, First, Count, true);
+  size_t sourceLength = Source_p->Stats.Length;
+  if (First >= sourceLength || Count == 0)
+  {
+    return;
+  }
+  if (Count > sourceLength - First)
+  {
+    Count = sourceLength - First;
+  }
+
+  SLIST_Node_t* before_p = NodeBefore(Source_p, First);
+  SLIST_Node_t* last_p = Source_p->Tail_p;
+  if (First + Count < sourceLength)
+  {
+    last_p = (before_p != NULL) ? before_p->Next_p : Source_p->Head_p;
+    for (size_t i = 1; i < Count; i++)
+    {
+      last_p = last_p->Next_p;
+    }
+  }
+  SLIST_Node_t* first_p = UnlinkChain(Source_p, before_p, last_p, Count);
+
+  SLIST_Node_t* after_p = (Position >= List_p->Stats.Length) ? List_p->Tail_p
+                                                            : NodeBefore(List_p, Position);
+  LinkChain(List_p, after_p, Source_p, first_p, last_p, Count);
+}
+
+bool
+SLIST_Compact(SLIST_List_t *const List_p)
+{
+  TRACE(SLIST_TRACE_COMPACT, List_p, 0, true);
+  if (List_p->Head_p == NULL)
+  {
+    return true;
+  }
+
+  // The new pool keeps the slab size of the old one for later inserts, but
+  // its first slab is made large enough for the whole list
+  NODEPOOL_Pool_t* pool_p = malloc(sizeof(NODEPOOL_Pool_t));
+  if (pool_p == NULL)
+  {
+    return false;
+  }
+  NODEPOOL_Create(pool_p, sizeof(SLIST_Node_t),
+                  (List_p->Pool_p != NULL) ? List_p->Pool_p->BlocksPerSlab : 0);
+  NODEPOOL_Block_t* block_p = NODEPOOL_AllocChain(pool_p, List_p->Stats.Length);
+  if (block_p == NULL)
+  {
+    NODEPOOL_Destroy(pool_p);
+    free(pool_p);
+    return false;
+  }
+
+  PROFILE_ADD(NodeAllocs, List_p->Stats.Length);
+  bool indexed = (List_p->Index_p != NULL);
+  SLIST_DestroyIndex(List_p);
+
+  SLIST_Node_t* head_p = NULL;
+  SLIST_Node_t** link_pp = &head_p;
+  SLIST_Node_t* node_p = NULL;
+  for (SLIST_Node_t* old_p = List_p->Head_p; old_p != NULL; old_p = old_p->Next_p)
+  {
+    NODEPOOL_Block_t* next_p = block_p->Next_p;
+    node_p = (SLIST_Node_t*)block_p;
+    node_p->Data_p = old_p->Data_p;
+    *link_pp = node_p;
+    link_pp = &node_p->Next_p;
+    block_p = next_p;
+  }
+  *link_pp = NULL;
+
+  ReleaseNodes(List_p);
+  List_p->Head_p = head_p;
+  List_p->Tail_p = node_p;
+  List_p->Pool_p = pool_p;
+
+  if (indexed)
+  {
+    SLIST_CreateIndex(List_p);
+  }
+  return true;
+}
+
+void
+SLIST_CreateIndex(SLIST_List_t *const List_p)
+{
+  SLIST_DestroyIndex(List_p);
+
+  SLIST_Index_t* index_p = malloc(sizeof(SLIST_Index_t));
+  index_p->BucketCount = INDEX_MIN_BUCKETS;
+  while (index_p->BucketCount < List_p->Stats.Length)
+  {
+    index_p->BucketCount *= 2;
+  }
+  index_p->Buckets_pp = calloc(index_p->BucketCount, sizeof(SLIST_IndexEntry_t*));
+  index_p->EntryCount = 0;
+  index_p->FirstSequence = 1;
+  index_p->LastSequence = 0;
+  NODEPOOL_Create(&index_p->Entries, sizeof(SLIST_IndexEntry_t), INDEX_ENTRIES_PER_SLAB);
+  List_p->Index_p = index_p;
+
+  SLIST_Node_t* previous_p = NULL;
+  for (SLIST_Node_t* node_p = List_p->Head_p; node_p != NULL; node_p = node_p->Next_p)
+  {
+    IndexAdd(List_p, node_p, previous_p, ++index_p->LastSequence);
+    previous_p = node_p;
   }
-  return (void*)SearchData_p;
+}
+
+void
+SLIST_DestroyIndex(SLIST_List_t *const List_p)
+{
+  if (List_p->Index_p == NULL)
+  {
+    return;
+  }
+  NODEPOOL_Destroy(&List_p->Index_p->Entries);
+  free(List_p->Index_p->Buckets_pp);
+  free(List_p->Index_p);
+  List_p->Index_p = NULL;
 }
 
 void
@@ -232,6 +1047,46 @@ SLIST_SetCompareFunction(SLIST_List_t *const List_p, DataCompare_t DataCompare_f
   List_p->Callbacks.DataCompare_fp = DataCompare_fp;
 }
 
+void
+SLIST_SetHashFunction(SLIST_List_t *const List_p, DataHash_t DataHash_fp)
+{
+  List_p->Callbacks.DataHash_fp = DataHash_fp;
+}
+
+void
+SLIST_SetFindPolicy(SLIST_List_t *const List_p, SLIST_FindPolicy_t Policy)
+{
+  List_p->FindPolicy = Policy;
+}
+
+void
+SLIST_IteratorInit(SLIST_Iterator_t *const Iterator_p,
+                   const SLIST_List_t *const List_p)
+{
+  Iterator_p->List_p = List_p;
+  Iterator_p->Node_p = List_p->Head_p;
+}
+
+bool
+SLIST_IteratorHasNext(const SLIST_Iterator_t *const Iterator_p)
+{
+  return (Iterator_p->Node_p != NULL);
+}
+
+void*
+SLIST_IteratorGetNext(SLIST_Iterator_t *const Iterator_p)
+{
+  void* Data_p = Iterator_p->Node_p->Data_p;
+  Iterator_p->Node_p = Iterator_p->Node_p->Next_p;
+  return Data_p;
+}
+
+void
+SLIST_IteratorReset(SLIST_Iterator_t *const Iterator_p)
+{
+  Iterator_p->Node_p = Iterator_p->List_p->Head_p;
+}
+
 //
 // ITERATOR
 //
@@ -240,8 +1095,7 @@ Iterator_t*
 ITERATOR_Create(const SLIST_List_t *const List_p)
 {
   Iterator_t* It_p = malloc(sizeof(Iterator_t));
-  It_p->List_p = (SLIST_List_t*)List_p;
-  It_p->Current_pp = &It_p->List_p->Head_p;
+  SLIST_IteratorInit(&It_p->Cursor, List_p);
   return It_p;
 }
 
@@ -255,21 +1109,655 @@ ITERATOR_Destroy(Iterator_t** Iterator_pp)
 bool
 ITERATOR_HasNext(const Iterator_t* const Iterator_p)
 {
-  return ((*Iterator_p->Current_pp) != NULL);
+  return SLIST_IteratorHasNext(&Iterator_p->Cursor);
 }
 
 void*
 ITERATOR_GetNext(Iterator_t* const Iterator_p)
 {
-  void* Data_p = (*Iterator_p->Current_pp)->Data_p;
-  *Iterator_p->Current_pp = (*Iterator_p->Current_pp)->Next_p;
-  return Data_p;
+  return SLIST_IteratorGetNext(&Iterator_p->Cursor);
 }
 
 void
 ITERATOR_Reset(Iterator_t* const Iterator_p)
 {
-  *Iterator_p->Current_pp = Iterator_p->List_p->Head_p;
+  SLIST_IteratorReset(&Iterator_p->Cursor);
 }
 
 /* > Local Function Definitions ***********************************************/
+
+static SLIST_Node_t*
+AllocNode(SLIST_List_t *const List_p)
+{
+  PROFILE_BEGIN();
+  SLIST_Node_t* node_p = (List_p->Pool_p != NULL) ? NODEPOOL_Alloc(List_p->Pool_p)
+                                                  : malloc(sizeof(SLIST_Node_t));
+  PROFILE_ADD(NodeAllocs, 1);
+  PROFILE_END(SLIST_OP_ALLOC_NODE);
+  return node_p;
+}
+
+static void
+FreeNode(SLIST_List_t *const List_p, SLIST_Node_t *const Node_p)
+{
+  PROFILE_ADD(NodeFrees, 1);
+  if (List_p->Pool_p != NULL)
+  {
+    NODEPOOL_Free(List_p->Pool_p, Node_p);
+  }
+  else
+  {
+    free(Node_p);
+  }
+}
+
+// Returns a chain of Count new nodes holding Data_pp[0] to Data_pp[Count - 1],
+// linked through Next_p with NULL in the last one, which is returned in
+// Last_pp. Pooled nodes come from one chain of the pool.
+static SLIST_Node_t*
+AllocNodes(SLIST_List_t *const List_p,
+           void *const *const Data_pp,
+           size_t Count,
+           SLIST_Node_t** Last_pp)
+{
+  SLIST_Node_t* chain_p = NULL;
+  SLIST_Node_t** link_pp = &chain_p;
+  SLIST_Node_t* node_p = NULL;
+
+  PROFILE_ADD(NodeAllocs, Count);
+  if (List_p->Pool_p != NULL)
+  {
+    // The pool links its blocks through their first word, which is Data_p of
+    // a node, so read every link before the data overwrites it
+    NODEPOOL_Block_t* block_p = NODEPOOL_AllocChain(List_p->Pool_p, Count);
+    for (size_t i = 0; i < Count; i++)
+    {
+      NODEPOOL_Block_t* next_p = block_p->Next_p;
+      node_p = (SLIST_Node_t*)block_p;
+      node_p->Data_p = Data_pp[i];
+      *link_pp = node_p;
+      link_pp = &node_p->Next_p;
+      block_p = next_p;
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < Count; i++)
+    {
+      node_p = malloc(sizeof(SLIST_Node_t));
+      node_p->Data_p = Data_pp[i];
+      *link_pp = node_p;
+      link_pp = &node_p->Next_p;
+    }
+  }
+  *link_pp = NULL;
+  *Last_pp = node_p;
+  return chain_p;
+}
+
+static void
+CountInsert(SLIST_List_t *const List_p)
+{
+  List_p->Stats.Length++;
+  List_p->Stats.TotalInserts++;
+  if (List_p->Stats.Length > List_p->Stats.HighWaterMark)
+  {
+    List_p->Stats.HighWaterMark = List_p->Stats.Length;
+  }
+}
+
+static void
+CountRemove(SLIST_List_t *const List_p)
+{
+  List_p->Stats.Length--;
+  List_p->Stats.TotalRemoves++;
+}
+
+// Spreads the bits of a user supplied hash, which may be as weak as the
+// identity of an integer key, over the whole word
+static size_t
+MixHash(size_t Hash)
+{
+  uint64_t mixed = (uint64_t)Hash;
+  mixed ^= mixed >> 33;
+  mixed *= UINT64_C(0xff51afd7ed558ccd);
+  mixed ^= mixed >> 33;
+  mixed *= UINT64_C(0xc4ceb9fe1a85ec53);
+  mixed ^= mixed >> 33;
+  return (size_t)mixed;
+}
+
+static size_t
+IndexHash(const SLIST_List_t *const List_p, const void *const Data_p)
+{
+  return MixHash(List_p->Callbacks.DataHash_fp(Data_p));
+}
+
+static SLIST_IndexEntry_t**
+IndexBucket(const SLIST_Index_t *const Index_p, size_t Hash)
+{
+  return &Index_p->Buckets_pp[Hash & (Index_p->BucketCount - 1)];
+}
+
+static void
+IndexAdd(SLIST_List_t *const List_p,
+         SLIST_Node_t *const Node_p,
+         SLIST_Node_t *const Prev_p,
+         int64_t Sequence)
+{
+  SLIST_Index_t* index_p = List_p->Index_p;
+  if (index_p->EntryCount == index_p->BucketCount)
+  {
+    IndexGrow(index_p);
+  }
+
+  SLIST_IndexEntry_t* entry_p = NODEPOOL_Alloc(&index_p->Entries);
+  entry_p->Node_p = Node_p;
+  entry_p->Prev_p = Prev_p;
+  entry_p->Hash = IndexHash(List_p, Node_p->Data_p);
+  entry_p->Sequence = Sequence;
+
+  SLIST_IndexEntry_t** bucket_pp = IndexBucket(index_p, entry_p->Hash);
+  entry_p->Next_p = *bucket_pp;
+  *bucket_pp = entry_p;
+  index_p->EntryCount++;
+}
+
+// Returns the link that points at the entry of a node in the list
+static SLIST_IndexEntry_t**
+IndexLinkOf(const SLIST_List_t *const List_p, const SLIST_Node_t *const Node_p)
+{
+  SLIST_IndexEntry_t** link_pp = IndexBucket(List_p->Index_p,
+                                             IndexHash(List_p, Node_p->Data_p));
+  while ((*link_pp)->Node_p != Node_p)
+  {
+    link_pp = &(*link_pp)->Next_p;
+  }
+  return link_pp;
+}
+
+// Returns the link that points at the entry of the first element equal to
+// SearchData_p, or NULL if there is none
+static SLIST_IndexEntry_t**
+IndexLookup(const SLIST_List_t *const List_p, const void *const SearchData_p)
+{
+  size_t hash = IndexHash(List_p, SearchData_p);
+  SLIST_IndexEntry_t** found_pp = NULL;
+
+  for (SLIST_IndexEntry_t** link_pp = IndexBucket(List_p->Index_p, hash);
+       *link_pp != NULL;
+       link_pp = &(*link_pp)->Next_p)
+  {
+    SLIST_IndexEntry_t* entry_p = *link_pp;
+    if (entry_p->Hash == hash &&
+        (found_pp == NULL || entry_p->Sequence < (*found_pp)->Sequence) &&
+        COMPARE(List_p, entry_p->Node_p->Data_p, SearchData_p) == 0)
+    {
+      found_pp = link_pp;
+    }
+  }
+  return found_pp;
+}
+
+static void
+IndexUnlink(SLIST_List_t *const List_p, SLIST_IndexEntry_t** Link_pp)
+{
+  SLIST_IndexEntry_t* entry_p = *Link_pp;
+  *Link_pp = entry_p->Next_p;
+  NODEPOOL_Free(&List_p->Index_p->Entries, entry_p);
+  List_p->Index_p->EntryCount--;
+}
+
+static void
+IndexSetPrev(const SLIST_List_t *const List_p,
+             SLIST_Node_t *const Node_p,
+             SLIST_Node_t *const Prev_p)
+{
+  if (Node_p != NULL)
+  {
+    (*IndexLinkOf(List_p, Node_p))->Prev_p = Prev_p;
+  }
+}
+
+// Doubles the number of buckets, keeping at most one entry per bucket on
+// average
+static void
+IndexGrow(SLIST_Index_t *const Index_p)
+{
+  SLIST_IndexEntry_t** oldBuckets_pp = Index_p->Buckets_pp;
+  size_t oldCount = Index_p->BucketCount;
+
+  Index_p->BucketCount = oldCount * 2;
+  Index_p->Buckets_pp = calloc(Index_p->BucketCount, sizeof(SLIST_IndexEntry_t*));
+
+  for (size_t i = 0; i < oldCount; i++)
+  {
+    SLIST_IndexEntry_t* entry_p = oldBuckets_pp[i];
+    while (entry_p != NULL)
+    {
+      SLIST_IndexEntry_t* next_p = entry_p->Next_p;
+      SLIST_IndexEntry_t** bucket_pp = IndexBucket(Index_p, entry_p->Hash);
+      entry_p->Next_p = *bucket_pp;
+      *bucket_pp = entry_p;
+      entry_p = next_p;
+    }
+  }
+  free(oldBuckets_pp);
+}
+
+// SLIST_RemoveSpecific() for a list with a hash index
+static void*
+RemoveIndexed(SLIST_List_t *const List_p, const void *const SearchData_p)
+{
+  SLIST_IndexEntry_t** link_pp = IndexLookup(List_p, SearchData_p);
+  if (link_pp == NULL)
+  {
+    return NULL;
+  }
+
+  SLIST_Node_t* remove_p = (*link_pp)->Node_p;
+  SLIST_Node_t* previous_p = (*link_pp)->Prev_p;
+  IndexUnlink(List_p, link_pp);
+
+  if (previous_p == NULL)
+  {
+    List_p->Head_p = remove_p->Next_p;
+  }
+  else
+  {
+    previous_p->Next_p = remove_p->Next_p;
+  }
+  if (remove_p == List_p->Tail_p)
+  {
+    List_p->Tail_p = previous_p;
+  }
+  IndexSetPrev(List_p, remove_p->Next_p, previous_p);
+
+  void* Data_p = remove_p->Data_p;
+  FreeNode(List_p, remove_p);
+  CountRemove(List_p);
+  return Data_p;
+}
+
+// Gives every entry of the index the predecessor and sequence number of its
+// node after the list was relinked
+static void
+IndexRenumber(const SLIST_List_t *const List_p)
+{
+  SLIST_Index_t* index_p = List_p->Index_p;
+  SLIST_Node_t* previous_p = NULL;
+
+  index_p->FirstSequence = 1;
+  index_p->LastSequence = 0;
+  for (SLIST_Node_t* node_p = List_p->Head_p; node_p != NULL; node_p = node_p->Next_p)
+  {
+    SLIST_IndexEntry_t* entry_p = *IndexLinkOf(List_p, node_p);
+    entry_p->Prev_p = previous_p;
+    entry_p->Sequence = ++index_p->LastSequence;
+    previous_p = node_p;
+  }
+}
+
+// Merges two sorted, NULL terminated chains of nodes and returns the head of
+// the result. Nodes of First_p go first on equal data, which keeps the merge
+// stable. The last node is returned in Last_pp if it is not NULL.
+static SLIST_Node_t*
+MergeRuns(const SLIST_List_t *const List_p,
+          SLIST_Node_t* First_p,
+          SLIST_Node_t* Second_p,
+          SLIST_Node_t** Last_pp)
+{
+  DataCompare_t compare_fp = List_p->Callbacks.DataCompare_fp;
+  SLIST_Node_t* head_p = NULL;
+  SLIST_Node_t** link_pp = &head_p;
+  size_t compares = 0;
+
+  while (First_p != NULL && Second_p != NULL)
+  {
+    compares++;
+    if (compare_fp(Second_p->Data_p, First_p->Data_p) < 0)
+    {
+      *link_pp = Second_p;
+      Second_p = Second_p->Next_p;
+    }
+    else
+    {
+      *link_pp = First_p;
+      First_p = First_p->Next_p;
+    }
+    link_pp = &(*link_pp)->Next_p;
+  }
+  *link_pp = (First_p != NULL) ? First_p : Second_p;
+  PROFILE_ADD(Compares, compares);
+
+  if (Last_pp != NULL)
+  {
+    SLIST_Node_t* last_p = *link_pp;
+    if (head_p == NULL)
+    {
+      last_p = NULL;
+    }
+    else if (last_p == NULL)
+    {
+      // link_pp is the Next_p field of the last node placed
+      last_p = (SLIST_Node_t*)((char*)link_pp - offsetof(SLIST_Node_t, Next_p));
+    }
+    else
+    {
+      while (last_p->Next_p != NULL)
+      {
+        last_p = last_p->Next_p;
+      }
+    }
+    *Last_pp = last_p;
+  }
+  return head_p;
+}
+
+static void
+CountInsertMany(SLIST_List_t *const List_p, size_t Count)
+{
+  List_p->Stats.Length += Count;
+  List_p->Stats.TotalInserts += Count;
+  if (List_p->Stats.Length > List_p->Stats.HighWaterMark)
+  {
+    List_p->Stats.HighWaterMark = List_p->Stats.Length;
+  }
+}
+
+// Returns the node before position Position, or NULL for position 0
+static SLIST_Node_t*
+NodeBefore(const SLIST_List_t *const List_p, size_t Position)
+{
+  if (Position == 0)
+  {
+    return NULL;
+  }
+
+  PROFILE_SCAN(Position, 0);
+  SLIST_Node_t* node_p = List_p->Head_p;
+  for (size_t i = 1; i < Position; i++)
+  {
+    node_p = node_p->Next_p;
+  }
+  return node_p;
+}
+
+// Takes the Count nodes after Before_p (or from the head if NULL) up to and
+// including Last_p out of Source_p and returns the first of them. The chain
+// is NULL terminated and the nodes are dropped from the index of Source_p.
+static SLIST_Node_t*
+UnlinkChain(SLIST_List_t *const Source_p,
+            SLIST_Node_t *const Before_p,
+            SLIST_Node_t *const Last_p,
+            size_t Count)
+{
+  SLIST_Node_t* first_p = (Before_p != NULL) ? Before_p->Next_p : Source_p->Head_p;
+  SLIST_Node_t* after_p = Last_p->Next_p;
+
+  if (Before_p != NULL)
+  {
+    Before_p->Next_p = after_p;
+  }
+  else
+  {
+    Source_p->Head_p = after_p;
+  }
+  if (after_p == NULL)
+  {
+    Source_p->Tail_p = Before_p;
+  }
+  Last_p->Next_p = NULL;
+
+  if (Source_p->Index_p != NULL)
+  {
+    for (SLIST_Node_t* node_p = first_p; node_p != NULL; node_p = node_p->Next_p)
+    {
+      IndexUnlink(Source_p, IndexLinkOf(Source_p, node_p));
+    }
+    IndexSetPrev(Source_p, after_p, Before_p);
+  }
+
+  Source_p->Stats.Length -= Count;
+  Source_p->Stats.TotalRemoves += Count;
+  return first_p;
+}
+
+// Moves the data of a chain of nodes of Source_p into new nodes of List_p,
+// for lists that do not allocate nodes the same way. Returns the new chain
+// and its last node in Last_pp.
+static SLIST_Node_t*
+MoveNodes(SLIST_List_t *const List_p,
+          SLIST_List_t *const Source_p,
+          SLIST_Node_t* First_p,
+          SLIST_Node_t** Last_pp)
+{
+  SLIST_Node_t* chain_p = NULL;
+  SLIST_Node_t** link_pp = &chain_p;
+  SLIST_Node_t* newNode = NULL;
+
+  while (First_p != NULL)
+  {
+    SLIST_Node_t* next_p = First_p->Next_p;
+    newNode = AllocNode(List_p);
+    newNode->Data_p = First_p->Data_p;
+    *link_pp = newNode;
+    link_pp = &newNode->Next_p;
+    FreeNode(Source_p, First_p);
+    First_p = next_p;
+  }
+  *link_pp = NULL;
+  *Last_pp = newNode;
+  return chain_p;
+}
+
+// Links a NULL terminated chain of Count nodes taken from Source_p into
+// List_p after After_p, or at the head if NULL. The nodes are relinked as
+// they are if both lists allocate the same way.
+static void
+LinkChain(SLIST_List_t *const List_p,
+          SLIST_Node_t *const After_p,
+          SLIST_List_t *const Source_p,
+          SLIST_Node_t* First_p,
+          SLIST_Node_t* Last_p,
+          size_t Count)
+{
+  if (List_p->Pool_p != Source_p->Pool_p)
+  {
+    First_p = MoveNodes(List_p, Source_p, First_p, &Last_p);
+  }
+
+  bool atTail = (After_p == List_p->Tail_p);
+  SLIST_Node_t* next_p = (After_p != NULL) ? After_p->Next_p : List_p->Head_p;
+  Last_p->Next_p = next_p;
+  if (After_p != NULL)
+  {
+    After_p->Next_p = First_p;
+  }
+  else
+  {
+    List_p->Head_p = First_p;
+  }
+  if (next_p == NULL)
+  {
+    List_p->Tail_p = Last_p;
+  }
+
+  if (List_p->Index_p != NULL)
+  {
+    // Appended nodes simply continue the sequence, anything else needs the
+    // list numbered again
+    SLIST_Node_t* previous_p = After_p;
+    for (SLIST_Node_t* node_p = First_p; node_p != next_p; node_p = node_p->Next_p)
+    {
+      IndexAdd(List_p, node_p, previous_p, atTail ? ++List_p->Index_p->LastSequence : 0);
+      previous_p = node_p;
+    }
+    if (!atTail)
+    {
+      IndexRenumber(List_p);
+    }
+  }
+  CountInsertMany(List_p, Count);
+}
+
+// Moves a found node, which is not the head, towards the head according to
+// the find policy. Only used on lists without a hash index, so no entries
+// need to be updated.
+static void
+PromoteNode(SLIST_List_t *const List_p,
+            SLIST_Node_t *const BeforePrevious_p,
+            SLIST_Node_t *const Previous_p,
+            SLIST_Node_t *const Node_p)
+{
+  if (List_p->FindPolicy == SLIST_FIND_STATIC)
+  {
+    return;
+  }
+
+  Previous_p->Next_p = Node_p->Next_p;
+  if (List_p->Tail_p == Node_p)
+  {
+    List_p->Tail_p = Previous_p;
+  }
+
+  if (List_p->FindPolicy == SLIST_FIND_MOVE_TO_FRONT)
+  {
+    Node_p->Next_p = List_p->Head_p;
+    List_p->Head_p = Node_p;
+  }
+  else
+  {
+    Node_p->Next_p = Previous_p;
+    if (BeforePrevious_p == NULL)
+    {
+      List_p->Head_p = Node_p;
+    }
+    else
+    {
+      BeforePrevious_p->Next_p = Node_p;
+    }
+  }
+}
+
+// Frees every node of the list, without touching the data, and drops the
+// reference to its pool. Leaves Head_p and Tail_p dangling.
+static void
+ReleaseNodes(SLIST_List_t *const List_p)
+{
+  PROFILE_ADD(NodeFrees, List_p->Stats.Length);
+  if (List_p->Pool_p != NULL)
+  {
+    // All nodes live in the slabs of the pool and are released in one go,
+    // unless other lists still allocate from it
+    if (List_p->Pool_p->References > 1)
+    {
+      SLIST_Node_t* free_p = List_p->Head_p;
+      while (free_p != NULL)
+      {
+        SLIST_Node_t* next_p = free_p->Next_p;
+        NODEPOOL_Free(List_p->Pool_p, free_p);
+        free_p = next_p;
+      }
+    }
+    if (NODEPOOL_Release(List_p->Pool_p))
+    {
+      free(List_p->Pool_p);
+    }
+    List_p->Pool_p = NULL;
+  }
+  else
+  {
+    SLIST_Node_t* free_p = List_p->Head_p;
+    while (free_p != NULL)
+    {
+      SLIST_Node_t* next_p = free_p->Next_p;
+      free(free_p);
+      free_p = next_p;
+    }
+  }
+}
+
+#ifdef SLIST_INSTRUMENT
+
+static uint64_t
+ProfileNow(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+// Counts the time since Start in the latency histogram of Operation
+static void
+ProfileLatency(SLIST_Operation_t Operation, uint64_t Start)
+{
+  size_t bucket = HistogramBucket(ProfileNow() - Start);
+  atomic_fetch_add_explicit(&Profile.Latency[Operation][bucket], 1, memory_order_relaxed);
+}
+
+static void
+ProfileScan(size_t Visited, size_t Compares)
+{
+  atomic_fetch_add_explicit(&Profile.Compares, Compares, memory_order_relaxed);
+  atomic_fetch_add_explicit(&Profile.Scans, 1, memory_order_relaxed);
+  atomic_fetch_add_explicit(&Profile.NodesVisited, Visited, memory_order_relaxed);
+  atomic_fetch_add_explicit(&Profile.ScanLength[HistogramBucket(Visited)], 1,
+                            memory_order_relaxed);
+}
+
+// Returns the histogram bucket of Value, i.e. its number of significant bits
+static size_t
+HistogramBucket(uint64_t Value)
+{
+  size_t bucket = 0;
+  while (Value != 0 && bucket < SLIST_HISTOGRAM_BUCKETS - 1)
+  {
+    Value >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+#endif // SLIST_INSTRUMENT
+
+#ifdef SLIST_TRACE
+
+// Identifies data in a trace by its hash, or by its address without a hash
+// function
+static uint64_t
+TraceKey(const SLIST_List_t *const List_p, const void *const Data_p)
+{
+  if (List_p->Callbacks.DataHash_fp != NULL && Data_p != NULL)
+  {
+    return (uint64_t)List_p->Callbacks.DataHash_fp(Data_p);
+  }
+  return (uint64_t)(uintptr_t)Data_p;
+}
+
+// Records an operation between List_p and Other_p with its arguments
+static void
+TraceMove(SLIST_TraceOp_t Operation,
+          const SLIST_List_t *const List_p,
+          const SLIST_List_t *const Other_p,
+          uint64_t Key,
+          size_t Position,
+          size_t First,
+          size_t Count,
+          bool Found)
+{
+  SLIST_TraceRecord_t record;
+
+  memset(&record, 0, sizeof(record));
+  record.Key = Key;
+  record.ListId = (uint64_t)(uintptr_t)List_p;
+  record.OtherId = (uint64_t)(uintptr_t)Other_p;
+  record.Position = Position;
+  record.First = First;
+  record.Count = Count;
+  record.Operation = (uint32_t)Operation;
+  record.Found = Found ? 1 : 0;
+  SLIST_TraceWrite(&record);
+}
+
+#endif // SLIST_TRACE
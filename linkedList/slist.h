@@ -10,10 +10,38 @@
 /* > Includes *****************************************************************/
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nodepool.h"
 
 
 /* > Defines ******************************************************************/
 
+//
+// Visits every element of the list in order, with Variable set to the data of
+// the element. Variable must be a plain variable declared by the caller. The
+// loop is expanded in place, so it costs no call per element; the list must
+// not be modified while it runs, except by leaving the loop.
+//
+//   int* Number_p;
+//   SLIST_FOREACH(Number_p, &List)
+//   {
+//     printf("%d\n", *Number_p);
+//   }
+//
+#define SLIST_FOREACH(Variable, List_p)                                         \
+  for (const SLIST_Node_t* Variable##_Node_p = (List_p)->Head_p;                \
+       Variable##_Node_p != NULL && ((Variable) = Variable##_Node_p->Data_p, 1);\
+       Variable##_Node_p = Variable##_Node_p->Next_p)
+
+//
+// Number of buckets of the histograms of SLIST_Profile_t. Bucket 0 counts the
+// value 0, bucket i counts values from 2^(i-1) to 2^i - 1 and the last bucket
+// everything larger.
+//
+#define SLIST_HISTOGRAM_BUCKETS  40
+
 
 /* > Type Declarations ********************************************************/
 
@@ -28,11 +56,14 @@ typedef void (*DataPrint_t)(const void* const);
 
 typedef int (*DataCompare_t)(const void* const, const void* const);
 
+typedef size_t (*DataHash_t)(const void* const);
+
 typedef struct SLIST_Callbacks
 {
   DataDestroy_t DataDestroy_fp;
   DataPrint_t DataPrint_fp;
   DataCompare_t DataCompare_fp;
+  DataHash_t DataHash_fp;
 } SLIST_Callbacks_t;
 
 
@@ -47,18 +78,117 @@ typedef struct SLIST_Node
 } SLIST_Node_t;
 
 
+//
+// List Statistics
+//
+
+typedef struct SLIST_Stats
+{
+  size_t Length;
+  size_t HighWaterMark;
+  size_t TotalInserts;
+  size_t TotalRemoves;
+} SLIST_Stats_t;
+
+
+//
+// Instrumentation, see SLIST_GetProfile()
+//
+
+typedef enum SLIST_Operation
+{
+  SLIST_OP_INSERT_FIRST,
+  SLIST_OP_INSERT_LAST,
+  SLIST_OP_REMOVE_FIRST,
+  SLIST_OP_REMOVE_LAST,
+  SLIST_OP_REMOVE_SPECIFIC,
+  SLIST_OP_FIND,
+  SLIST_OP_INSERT_SORTED,
+  SLIST_OP_SORT,
+  SLIST_OP_ALLOC_NODE,
+  SLIST_OP_COUNT
+} SLIST_Operation_t;
+
+typedef struct SLIST_Profile
+{
+  uint64_t NodeAllocs;
+  uint64_t NodeFrees;
+  uint64_t Compares;
+  uint64_t Scans;
+  uint64_t NodesVisited;
+  uint64_t ScanLength[SLIST_HISTOGRAM_BUCKETS];
+  uint64_t Latency[SLIST_OP_COUNT][SLIST_HISTOGRAM_BUCKETS];
+} SLIST_Profile_t;
+
+
+//
+// Hash Index Definition
+//
+// Every node of an indexed list has one entry, chained in the bucket selected
+// by the hash of its data. The entry also holds the predecessor of the node
+// so that it can be unlinked without a scan, and a sequence number that grows
+// from head to tail to pick the first of several equal elements.
+//
+
+typedef struct SLIST_IndexEntry
+{
+  struct SLIST_IndexEntry* Next_p;
+  SLIST_Node_t*            Node_p;
+  SLIST_Node_t*            Prev_p;
+  size_t                   Hash;
+  int64_t                  Sequence;
+} SLIST_IndexEntry_t;
+
+typedef struct SLIST_Index
+{
+  SLIST_IndexEntry_t** Buckets_pp;
+  size_t               BucketCount;
+  size_t               EntryCount;
+  int64_t              FirstSequence;
+  int64_t              LastSequence;
+  NODEPOOL_Pool_t      Entries;
+} SLIST_Index_t;
+
+
+//
+// Self-organizing Search Policy, see SLIST_SetFindPolicy()
+//
+
+typedef enum SLIST_FindPolicy
+{
+  SLIST_FIND_STATIC,
+  SLIST_FIND_MOVE_TO_FRONT,
+  SLIST_FIND_TRANSPOSE
+} SLIST_FindPolicy_t;
+
+
 //
 // List Definition
 //
 
 typedef struct SLIST_List
 {
-  SLIST_Callbacks_t Callbacks;
-  SLIST_Node_t*     Head_p;
-  SLIST_Node_t*     Tail_p;// TODO: MAYBE ADD SOMETHING MORE HERE?!
+  SLIST_Callbacks_t  Callbacks;
+  SLIST_Node_t*      Head_p;
+  SLIST_Node_t*      Tail_p;
+  NODEPOOL_Pool_t*   Pool_p;
+  SLIST_Index_t*     Index_p;
+  SLIST_Stats_t      Stats;
+  SLIST_FindPolicy_t FindPolicy;
 } SLIST_List_t;
 
 
+//
+// Data Cursor, a value type placed by the caller
+//
+
+typedef struct SLIST_Iterator
+{
+  const SLIST_List_t* List_p;
+  const SLIST_Node_t* Node_p;
+} SLIST_Iterator_t;
+
+
 /* > Constant Declarations ****************************************************/
 
 
@@ -81,13 +211,54 @@ void
 SLIST_Create(SLIST_List_t *const List_p);
 
 
+/**
+ * @brief Creates a new list with a node pool
+ *
+ * Creates a singly-linked list whose nodes are carved from large slabs owned
+ * by the list instead of being allocated one by one with malloc(). Removed
+ * nodes are recycled through a free list, and the slabs are released when the
+ * list is destroyed.
+ *
+ * @param[in]     List_p        The list to be initialized.
+ * @param[in]     NodesPerSlab  Number of nodes in every slab, or 0 for
+ *                              NODEPOOL_DEFAULT_BLOCKS_PER_SLAB.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_CreateWithPool(SLIST_List_t *const List_p, size_t NodesPerSlab);
+
+
+/**
+ * @brief Creates a new list sharing the node pool of another list
+ *
+ * Creates an empty list that allocates its nodes from the same pool as
+ * Owner_p, or with malloc() if Owner_p has no pool. Lists that allocate the
+ * same way can pass nodes to each other by relinking them, see
+ * SLIST_Concat(). The pool is released when the last list using it is
+ * destroyed. Lists sharing a pool must not be used by different threads at
+ * the same time.
+ *
+ * @param[in]     List_p   The list to be initialized.
+ * @param[in]     Owner_p  A list whose pool is shared.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_CreateWithSharedPool(SLIST_List_t *const List_p, const SLIST_List_t *const Owner_p);
+
+
 /**
  * @brief Destroys a list
  *
- * Destroys a list created by SLIST_Create(), freeing the memory allocated
- * for the list structures. The data in the list is freed by the function
- * set by SLIST_SetDestroyFunction(). If no destroy function is set, the
- * data in the nodes is not freed.
+ * Destroys a list created by SLIST_Create() or SLIST_CreateWithPool(),
+ * freeing the memory allocated for the list structures. The data in the list
+ * is freed by the function set by SLIST_SetDestroyFunction(). If no destroy
+ * function is set, the data in the nodes is not freed.
+ * Nodes allocated with malloc() are freed one by one. Nodes of a pooled list
+ * are released together with the slabs of the pool, so the list is only
+ * traversed when a destroy function is set. If other lists still share the
+ * pool, the nodes are returned to it one by one instead.
  *
  * @param[in]     List_p  The list to be destroyed.
  * @return        N/A
@@ -112,18 +283,101 @@ SLIST_IsEmpty(const SLIST_List_t *const List_p);
 
 
 /**
- * @brief Calculates the number of elements in the list
+ * @brief Returns the number of elements in the list
  *
- * Determines the number of elements in the linked list and returns that value.
+ * Returns the element count kept up to date by every function that modifies
+ * the list. The list is not traversed.
  *
  * @param[in]     List_p Pointer to the list
  * @return        Number of elements
  *
  ******************************************************************************/
-int
+size_t
 SLIST_Length(const SLIST_List_t *const List_p);
 
 
+/**
+ * @brief Reads the statistics of the list
+ *
+ * Copies the current element count, the highest element count so far and the
+ * total number of inserted and removed elements since the list was created.
+ * The list is not traversed.
+ *
+ * @param[in]     List_p   Pointer to the list
+ * @param[out]    Stats_p  Receives the statistics
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_GetStats(const SLIST_List_t *const List_p, SLIST_Stats_t *const Stats_p);
+
+
+/**
+ * @brief Reads the instrumentation counters
+ *
+ * Copies the counters kept by slist.c when it is compiled with
+ * SLIST_INSTRUMENT defined; otherwise nothing is counted, the profile is
+ * zeroed and false is returned. The counters cover all lists of the process
+ * since the last SLIST_ResetProfile():
+ *   - NodeAllocs and NodeFrees, nodes taken from and returned to malloc() or
+ *     a node pool
+ *   - Compares, calls of the comparison function
+ *   - Scans, NodesVisited and ScanLength, walks along the list looking for
+ *     an element or a position, with a histogram of the nodes they visited
+ *   - Latency, a histogram of the time in nanoseconds of every operation,
+ *     where SLIST_OP_ALLOC_NODE times the allocation of single nodes
+ * The counters are updated with relaxed atomics, so the copy taken while
+ * other threads work on lists is not a consistent snapshot.
+ *
+ * @param[out]    Profile_p  Receives the counters
+ * @return        true if the library is instrumented
+ *
+ ******************************************************************************/
+bool
+SLIST_GetProfile(SLIST_Profile_t *const Profile_p);
+
+
+/**
+ * @brief Clears the instrumentation counters
+ *
+ * Sets all counters read by SLIST_GetProfile() to zero.
+ *
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ResetProfile(void);
+
+
+/**
+ * @brief Returns the name of an operation
+ *
+ * Returns a constant string such as "InsertFirst" for printing a profile.
+ *
+ * @param[in]     Operation  The operation
+ * @return        Name of the operation
+ *
+ ******************************************************************************/
+const char*
+SLIST_OperationName(SLIST_Operation_t Operation);
+
+
+/**
+ * @brief Estimates a percentile of a histogram
+ *
+ * Finds the bucket of a histogram of SLIST_Profile_t that holds the
+ * nearest-rank percentile and returns the largest value of that bucket, so
+ * the result is an upper bound within a factor of two.
+ *
+ * @param[in]     Histogram_p  SLIST_HISTOGRAM_BUCKETS counts
+ * @param[in]     Percent      Percentile from 0 to 100
+ * @return        Upper bound of the percentile, or 0 for an empty histogram
+ *
+ ******************************************************************************/
+uint64_t
+SLIST_HistogramPercentile(const uint64_t *const Histogram_p, unsigned int Percent);
+
+
 /**
  * @brief Inserts an item first in the list
  *
@@ -152,6 +406,27 @@ void
 SLIST_InsertLast(SLIST_List_t *const List_p, const void *const Data_p);
 
 
+/**
+ * @brief Inserts several items at the end of the list
+ *
+ * Inserts Data_pp[0] to Data_pp[Count - 1] at the end of the list, in this
+ * order, as Count calls to SLIST_InsertLast() would. The nodes are allocated
+ * together and linked to the tail in one step; a list with a node pool
+ * allocates at most one slab for the whole batch, a list without one still
+ * calls malloc() for every node.
+ *
+ * @param[in]     List_p   Pointer to the list
+ * @param[in]     Data_pp  Array of the data to insert
+ * @param[in]     Count    Number of elements in Data_pp
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_InsertLastBatch(SLIST_List_t *const List_p,
+                      void *const *const Data_pp,
+                      size_t Count);
+
+
 /**
  * @brief Removes the first item in the list.
  *
@@ -167,6 +442,23 @@ void*
 SLIST_RemoveFirst(SLIST_List_t *const List_p);
 
 
+/**
+ * @brief Removes several items from the beginning of the list
+ *
+ * Removes up to Max elements from the head of the list and stores their
+ * data in Data_pp, in list order. The removed nodes are unlinked in one
+ * step. The list may be empty.
+ *
+ * @param[in]     List_p   Pointer to the list
+ * @param[out]    Data_pp  Array of at least Max elements for the data
+ * @param[in]     Max      Largest number of elements to remove
+ * @return        Number of elements removed
+ *
+ ******************************************************************************/
+size_t
+SLIST_RemoveFirstBatch(SLIST_List_t *const List_p, void** const Data_pp, size_t Max);
+
+
 /**
  * @brief Removes the last item in the list.
  *
@@ -189,16 +481,222 @@ SLIST_RemoveLast(SLIST_List_t *const List_p);
  * to the comparison function.
  * Does not de-allocate the data in the removed node; this data is returned and
  * should be de-allocated manually.
+ * Takes O(1) on average if the list has a hash index, see
+ * SLIST_CreateIndex().
  *
  * @param[in]     List_p        Pointer to the list pointer
  * @param[in]     SearchData_p  The data to remove
- * @return        Pointer to the removed data
+ * @return        Pointer to the removed data, or NULL if not found
  *
  ******************************************************************************/
 void*
 SLIST_RemoveSpecific(SLIST_List_t *const List_p, const void* const SearchData_p);
 
 
+/**
+ * @brief Finds a specific item in the list
+ *
+ * Returns the first item in the list that is equal to SearchData_p, according
+ * to the comparison function, without removing it.
+ * Takes O(1) on average if the list has a hash index, see
+ * SLIST_CreateIndex(). Otherwise the found node is moved towards the head
+ * according to the find policy, see SLIST_SetFindPolicy().
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to search for
+ * @return        Pointer to the data in the list, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+SLIST_Find(SLIST_List_t *const List_p, const void* const SearchData_p);
+
+
+/**
+ * @brief Inserts an item in order
+ *
+ * Inserts the data after the last element that does not compare greater, so
+ * that a sorted list stays sorted and equal elements keep the order in which
+ * they were inserted. Takes O(n).
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_InsertSorted(SLIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Sorts the list
+ *
+ * Sorts the list in ascending order of the comparison function with a bottom
+ * up merge sort. The sort is stable, takes O(n log n) and relinks the
+ * existing nodes in place, so no memory is allocated and pointers to the data
+ * stay valid. A hash index is kept.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_Sort(SLIST_List_t *const List_p);
+
+
+/**
+ * @brief Merges two sorted lists
+ *
+ * Moves all elements of Source_p into List_p in O(n + m), so that List_p
+ * stays sorted by its comparison function. Both lists must be sorted by it.
+ * On equal elements those of List_p come first. Source_p is left empty and
+ * keeps its callbacks, pool and index.
+ * The nodes of Source_p are relinked if both lists allocate nodes the same
+ * way, i.e. both with malloc() or from one pool; otherwise every element is
+ * moved into a new node of List_p and the node of Source_p is freed.
+ *
+ * @param[in]     List_p    Pointer to the list that receives the elements
+ * @param[in]     Source_p  Pointer to the list that is emptied
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_Merge(SLIST_List_t *const List_p, SLIST_List_t *const Source_p);
+
+
+/**
+ * @brief Appends one list to another
+ *
+ * Moves all elements of Source_p to the end of List_p, leaving Source_p
+ * empty. Takes O(1) and allocates nothing if both lists allocate nodes the
+ * same way, see SLIST_CreateWithSharedPool(); otherwise every element is
+ * moved into a new node. A hash index on either list adds O(m) to update.
+ *
+ * @param[in]     List_p    Pointer to the list that receives the elements
+ * @param[in]     Source_p  Pointer to the list that is emptied
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_Concat(SLIST_List_t *const List_p, SLIST_List_t *const Source_p);
+
+
+/**
+ * @brief Splits a list at a position
+ *
+ * Moves the elements from position Position (counted from 0 at the head) to
+ * the end of the list to the end of Rest_p. Nothing is moved if Position is
+ * not less than the length of the list. Takes O(Position) and relinks the
+ * nodes as SLIST_Concat() does.
+ *
+ * @param[in]     List_p    Pointer to the list that is split
+ * @param[in]     Position  Position of the first element to move
+ * @param[in]     Rest_p    Pointer to the list that receives the elements
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_SplitAt(SLIST_List_t *const List_p, size_t Position, SLIST_List_t *const Rest_p);
+
+
+/**
+ * @brief Splits a list after an element
+ *
+ * Finds the first element that is equal to SearchData_p, according to the
+ * comparison function, and moves all elements after it to the end of
+ * Rest_p. Takes O(k) for an element at position k and relinks the nodes as
+ * SLIST_Concat() does.
+ *
+ * @param[in]     List_p        Pointer to the list that is split
+ * @param[in]     SearchData_p  The data to search for
+ * @param[in]     Rest_p        Pointer to the list that receives the elements
+ * @return        true if the element was found, false otherwise
+ *
+ ******************************************************************************/
+bool
+SLIST_SplitAfter(SLIST_List_t *const List_p,
+                 const void *const SearchData_p,
+                 SLIST_List_t *const Rest_p);
+
+
+/**
+ * @brief Moves a range of elements from one list into another
+ *
+ * Takes Count elements of Source_p starting at position First and inserts
+ * them, in order, before position Position of List_p. A Position equal to
+ * the length of List_p appends the range. Ranges reaching past the end of
+ * Source_p are shortened. Takes O(Position + First + Count), or O(First +
+ * Count) when appending, and relinks the nodes as SLIST_Concat() does. The
+ * two lists must not be the same.
+ *
+ * @param[in]     List_p    Pointer to the list that receives the elements
+ * @param[in]     Position  Position in List_p to insert the range at
+ * @param[in]     Source_p  Pointer to the list the range is taken from
+ * @param[in]     First     Position of the first element of the range
+ * @param[in]     Count     Number of elements in the range
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_SpliceRange(SLIST_List_t *const List_p,
+                  size_t Position,
+                  SLIST_List_t *const Source_p,
+                  size_t First,
+                  size_t Count);
+
+
+/**
+ * @brief Relays the nodes of the list out contiguously
+ *
+ * Copies every node, in traversal order, into one new slab of a pool that
+ * the list owns from then on, and releases the old nodes. Once a list has
+ * seen many inserts and removes its nodes are scattered over the heap or
+ * its pool, and a scan misses the cache on almost every node; after
+ * compaction a scan reads memory sequentially. Takes O(n).
+ * The data pointers stay valid, the nodes do not, so iterators must be
+ * initialized again. A list that shared the pool of another list stops
+ * sharing it. A hash index is rebuilt, which compacts its entries too.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        true on success, false if out of memory, in which case the
+ *                list is unchanged
+ *
+ ******************************************************************************/
+bool
+SLIST_Compact(SLIST_List_t *const List_p);
+
+
+/**
+ * @brief Attaches a hash index to the list
+ *
+ * Indexes every element in the list by the hash function and keeps the index
+ * up to date on every insert and remove from then on, so that SLIST_Find(),
+ * SLIST_RemoveSpecific() and SLIST_RemoveLast() no longer scan the list. The
+ * order of the list is not affected. Costs one index entry per element.
+ * The hash and compare functions must have been set before, and elements that
+ * compare equal must have the same hash.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_CreateIndex(SLIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes the hash index from the list
+ *
+ * Frees the index created by SLIST_CreateIndex(). Also called by
+ * SLIST_Destroy().
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_DestroyIndex(SLIST_List_t *const List_p);
+
+
 /**
  * @brief Print the list
  *
@@ -264,14 +762,102 @@ void
 SLIST_SetCompareFunction(SLIST_List_t *const List_p, DataCompare_t DataCompare_fp);
 
 
+/**
+ * @brief Sets hash function for the list
+ *
+ * Sets a hash function for the list. The function is used by the hash index,
+ * see SLIST_CreateIndex(), and must return the same value for elements that
+ * are equal according to the comparison function. It need not be well
+ * distributed; the index mixes the bits itself.
+ *
+ * @param[in]     List_p       Pointer to the list
+ * @param[in]     DataHash_fp  Pointer to the hash function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_SetHashFunction(SLIST_List_t *const List_p, DataHash_t DataHash_fp);
+
+
+/**
+ * @brief Sets the self-organizing policy of SLIST_Find()
+ *
+ * With SLIST_FIND_MOVE_TO_FRONT every element found by SLIST_Find() is moved
+ * to the head of the list, with SLIST_FIND_TRANSPOSE it is swapped with its
+ * predecessor. Frequently searched elements thus drift towards the head and
+ * are found after fewer compares when the lookups are skewed. Transpose
+ * adapts more slowly but is less disturbed by single lookups of cold
+ * elements. SLIST_FIND_STATIC, the default, leaves the order alone.
+ * The policy is not applied while the list has a hash index, as an indexed
+ * lookup does not depend on the position.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Policy  The policy
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_SetFindPolicy(SLIST_List_t *const List_p, SLIST_FindPolicy_t Policy);
+
+
+/**
+ * @brief Initializes an iterator
+ *
+ * Initializes an iterator placed by the caller, typically on the stack. The
+ * iterator does not modify the list and needs no destruction.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @param[in]     List_p      The list to be iterated.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_IteratorInit(SLIST_Iterator_t *const Iterator_p,
+                   const SLIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the iterator has more elements
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+SLIST_IteratorHasNext(const SLIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Returns the next element and advances the iterator
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        A pointer to the data of the current element
+ *
+ ******************************************************************************/
+void*
+SLIST_IteratorGetNext(SLIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Resets the iterator
+ *
+ * Moves the iterator back to the first element of the list.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_IteratorReset(SLIST_Iterator_t *const Iterator_p);
+
+
 //
-// Data Iterator
+// Data Iterator, a heap allocated SLIST_Iterator_t
 //
 
 typedef struct Iterator
 {
-  SLIST_List_t*  List_p;
-  SLIST_Node_t** Current_pp;
+  SLIST_Iterator_t Cursor;
 } Iterator_t;
 
 
@@ -279,7 +865,8 @@ typedef struct Iterator
 /**
  * @brief Creates a new iterator
  *
- * Creates an iterator for a singly-linked list.
+ * Creates an iterator for a singly-linked list. Prefer SLIST_IteratorInit()
+ * or SLIST_FOREACH, which need no allocation.
  *
  * @param[in]     List_p  The list to be iterated.
  * @return        A pointer to an iterator
@@ -0,0 +1,379 @@
+#ifndef SLIST_HPP
+#define SLIST_HPP
+
+/*
+ * C++ Singly Linked List
+ *
+ * Header-only class template linkedlist::slist<T, Allocator> on top of the
+ * intrusive list in ilist.h. Every element lives by value in a node obtained
+ * from the allocator, rebound to the node type, and the node is linked
+ * through its embedded ILIST_Link_t. The list offers STL forward iterators,
+ * so the algorithms in <algorithm> and <numeric> work on it, and in-place
+ * construction with emplace_front()/emplace_back().
+ *
+ * linkedlist::pmr::slist<T> uses std::pmr::polymorphic_allocator, so the
+ * nodes can come from e.g. a std::pmr::monotonic_buffer_resource. Allocators
+ * with fancy pointers are not supported. Requires C++17.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+extern "C"
+{
+#include "ilist.h"
+}
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+namespace linkedlist
+{
+
+template <class T, class Allocator = std::allocator<T>>
+class slist
+{
+  //
+  // Node Definition
+  //
+  // The value is kept in raw storage so that the node stays standard layout
+  // for any T, and the link is first so that a link is also its node.
+  //
+
+  struct Node
+  {
+    ILIST_Link_t Link;
+    alignas(T) unsigned char Storage[sizeof(T)];
+
+    T*
+    Value()
+    {
+      return std::launder(reinterpret_cast<T*>(Storage));
+    }
+  };
+
+  using NodeAllocator_t = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits_t = std::allocator_traits<NodeAllocator_t>;
+
+  static Node*
+  NodeOf(const ILIST_Link_t* Link_p)
+  {
+    return reinterpret_cast<Node*>(const_cast<ILIST_Link_t*>(Link_p));
+  }
+
+  //
+  // Forward Iterator Definition
+  //
+
+  template <bool IsConst>
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+
+    Iterator() = default;
+
+    explicit Iterator(const ILIST_Link_t* Link_p) : Link_p(Link_p) {}
+
+    // An iterator converts to a const_iterator, not the other way round
+    template <bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+    Iterator(const Iterator<WasConst>& Other) : Link_p(Other.Link_p) {}
+
+    reference
+    operator*() const
+    {
+      return *NodeOf(Link_p)->Value();
+    }
+
+    pointer
+    operator->() const
+    {
+      return NodeOf(Link_p)->Value();
+    }
+
+    Iterator&
+    operator++()
+    {
+      Link_p = Link_p->Next_p;
+      return *this;
+    }
+
+    Iterator
+    operator++(int)
+    {
+      Iterator Previous = *this;
+      Link_p = Link_p->Next_p;
+      return Previous;
+    }
+
+    friend bool
+    operator==(const Iterator& Left, const Iterator& Right)
+    {
+      return Left.Link_p == Right.Link_p;
+    }
+
+    friend bool
+    operator!=(const Iterator& Left, const Iterator& Right)
+    {
+      return Left.Link_p != Right.Link_p;
+    }
+
+  private:
+    friend class slist;
+    const ILIST_Link_t* Link_p = nullptr;
+  };
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  slist() : slist(Allocator()) {}
+
+  explicit slist(const Allocator& Alloc) : NodeAllocator(Alloc)
+  {
+    ILIST_Create(&List, offsetof(Node, Link));
+  }
+
+  slist(std::initializer_list<T> Values, const Allocator& Alloc = Allocator())
+    : slist(Alloc)
+  {
+    for (const T& Value : Values)
+    {
+      push_back(Value);
+    }
+  }
+
+  slist(const slist& Other)
+    : slist(NodeTraits_t::select_on_container_copy_construction(Other.NodeAllocator))
+  {
+    for (const T& Value : Other)
+    {
+      push_back(Value);
+    }
+  }
+
+  // Takes over the nodes; Other is left empty
+  slist(slist&& Other) noexcept : NodeAllocator(std::move(Other.NodeAllocator))
+  {
+    List = Other.List;
+    ILIST_Create(&Other.List, offsetof(Node, Link));
+  }
+
+  // Copies the elements into nodes from the allocator of *this, which is
+  // first replaced by that of Other if the allocator propagates on copy
+  slist&
+  operator=(const slist& Other)
+  {
+    if (this != &Other)
+    {
+      clear();
+      if constexpr (NodeTraits_t::propagate_on_container_copy_assignment::value)
+      {
+        NodeAllocator = Other.NodeAllocator;
+      }
+      for (const T& Value : Other)
+      {
+        push_back(Value);
+      }
+    }
+    return *this;
+  }
+
+  // Takes over the nodes of Other if the allocator propagates on move or both
+  // allocators are equal; otherwise the nodes of Other could not be freed by
+  // the allocator of *this, so the elements are moved one by one into new
+  // nodes. Other is left empty.
+  slist&
+  operator=(slist&& Other) noexcept(NodeTraits_t::propagate_on_container_move_assignment::value ||
+                                    NodeTraits_t::is_always_equal::value)
+  {
+    if (this == &Other)
+    {
+      return *this;
+    }
+
+    clear();
+    if constexpr (NodeTraits_t::propagate_on_container_move_assignment::value)
+    {
+      NodeAllocator = std::move(Other.NodeAllocator);
+    }
+    else if (!NodeTraits_t::is_always_equal::value && NodeAllocator != Other.NodeAllocator)
+    {
+      for (T& Value : Other)
+      {
+        push_back(std::move(Value));
+      }
+      Other.clear();
+      return *this;
+    }
+    List = Other.List;
+    ILIST_Create(&Other.List, offsetof(Node, Link));
+    return *this;
+  }
+
+  ~slist()
+  {
+    clear();
+  }
+
+  allocator_type
+  get_allocator() const
+  {
+    return allocator_type(NodeAllocator);
+  }
+
+  iterator begin() { return iterator(List.Head_p); }
+  iterator end() { return iterator(nullptr); }
+  const_iterator begin() const { return const_iterator(List.Head_p); }
+  const_iterator end() const { return const_iterator(nullptr); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool
+  empty() const
+  {
+    return ILIST_IsEmpty(&List);
+  }
+
+  size_type
+  size() const
+  {
+    return ILIST_Length(&List);
+  }
+
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *NodeOf(List.Tail_p)->Value(); }
+  const_reference back() const { return *NodeOf(List.Tail_p)->Value(); }
+
+  template <class... Args>
+  reference
+  emplace_front(Args&&... Arguments)
+  {
+    Node* Node_p = NewNode(std::forward<Args>(Arguments)...);
+    ILIST_InsertFirst(&List, Node_p);
+    return *Node_p->Value();
+  }
+
+  template <class... Args>
+  reference
+  emplace_back(Args&&... Arguments)
+  {
+    Node* Node_p = NewNode(std::forward<Args>(Arguments)...);
+    ILIST_InsertLast(&List, Node_p);
+    return *Node_p->Value();
+  }
+
+  void push_front(const T& Value) { emplace_front(Value); }
+  void push_front(T&& Value) { emplace_front(std::move(Value)); }
+  void push_back(const T& Value) { emplace_back(Value); }
+  void push_back(T&& Value) { emplace_back(std::move(Value)); }
+
+  // Removes the first element, which must exist
+  void
+  pop_front()
+  {
+    DeleteNode(static_cast<Node*>(ILIST_RemoveFirst(&List)));
+  }
+
+  void
+  clear() noexcept
+  {
+    while (!empty())
+    {
+      pop_front();
+    }
+  }
+
+  // Allocators that do not propagate on swap must compare equal
+  void
+  swap(slist& Other) noexcept
+  {
+    using std::swap;
+    if constexpr (NodeTraits_t::propagate_on_container_swap::value)
+    {
+      swap(NodeAllocator, Other.NodeAllocator);
+    }
+    swap(List, Other.List);
+  }
+
+private:
+  template <class... Args>
+  Node*
+  NewNode(Args&&... Arguments)
+  {
+    Node* Node_p = ::new (static_cast<void*>(NodeTraits_t::allocate(NodeAllocator, 1))) Node;
+    try
+    {
+      ::new (static_cast<void*>(Node_p->Storage)) T(std::forward<Args>(Arguments)...);
+    }
+    catch (...)
+    {
+      NodeTraits_t::deallocate(NodeAllocator, Node_p, 1);
+      throw;
+    }
+    return Node_p;
+  }
+
+  void
+  DeleteNode(Node* Node_p)
+  {
+    Node_p->Value()->~T();
+    NodeTraits_t::deallocate(NodeAllocator, Node_p, 1);
+  }
+
+  ILIST_List_t List;
+  NodeAllocator_t NodeAllocator;
+};
+
+template <class T, class Allocator>
+void
+swap(slist<T, Allocator>& Left, slist<T, Allocator>& Right) noexcept
+{
+  Left.swap(Right);
+}
+
+namespace pmr
+{
+
+template <class T>
+using slist = linkedlist::slist<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+} // namespace linkedlist
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+#endif // SLIST_HPP
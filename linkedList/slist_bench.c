@@ -0,0 +1,857 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "slist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define OPERATIONS_PER_RUN   10000000
+#define DESTROY_LIST_SIZE    10000000
+#define LOOKUPS_PER_RUN      20000
+#define TRAVERSE_LIST_SIZE   1000000
+#define TRAVERSE_ROUNDS      20
+#define INSERT_SORTED_SIZE   20000
+#define SPLICE_ROUNDS        1000
+#define BATCH_SIZE           1000
+#define ZIPF_LOOKUPS_PER_RUN 200000
+#define COMPACT_SCAN_ROUNDS  5
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 1000, 100000, 1000000 };
+
+static const size_t LookupListSizes[] = { 1000, 10000, 50000 };
+
+static const size_t SortListSizes[] = { 1000000, 10000000 };
+
+static const size_t ZipfListSizes[] = { 1000, 10000 };
+
+static const size_t CompactListSizes[] = { 100000, 1000000, 10000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+// Calls of CountingCompareInt() since the last reset
+static size_t CompareCount = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+CreateList(SLIST_List_t *const List_p, bool UsePool);
+
+static void
+BenchFillDrain(size_t Size, bool UsePool);
+
+static void
+BenchChurn(size_t Size, bool UsePool);
+
+static void
+BenchDestroy(size_t Size, bool UsePool);
+
+static void
+BenchLookup(size_t Size, bool UseIndex);
+
+static void
+BenchTraverse(size_t Size);
+
+static void
+BenchSort(size_t Size);
+
+static void
+BenchMerge(size_t Size);
+
+static void
+BenchInsertSorted(size_t Size);
+
+static int
+CompareIntPointers(const void* Pointer1_p, const void* Pointer2_p);
+
+static void
+BenchMoveAll(size_t Size, bool UseConcat);
+
+static void
+BenchSplitConcat(size_t Size);
+
+static void
+BenchSpliceRange(size_t Size);
+
+static void
+BenchBatch(bool UsePool, bool UseBatch);
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+static size_t
+DataHashInt(const void* const Data_p);
+
+static void
+BenchZipfFind(size_t Size, SLIST_FindPolicy_t Policy);
+
+static int
+CountingCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+static void
+BenchCompact(size_t Size, bool UsePool);
+
+static uint64_t
+ScanList(const SLIST_List_t *const List_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_Benchmarks(void)
+{
+  printf("SLIST node allocation: malloc vs pool\n");
+
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchFillDrain(ListSizes[i], false);
+    BenchFillDrain(ListSizes[i], true);
+    BenchChurn(ListSizes[i], false);
+    BenchChurn(ListSizes[i], true);
+  }
+  printf("\n");
+
+  printf("SLIST teardown: malloc vs pool\n");
+  BenchDestroy(DESTROY_LIST_SIZE, false);
+  BenchDestroy(DESTROY_LIST_SIZE, true);
+  printf("\n");
+
+  printf("SLIST lookup: linear scan vs hash index\n");
+  for (size_t i = 0; i < sizeof(LookupListSizes) / sizeof(LookupListSizes[0]); i++)
+  {
+    BenchLookup(LookupListSizes[i], false);
+    BenchLookup(LookupListSizes[i], true);
+  }
+  printf("\n");
+
+  printf("SLIST traversal: ITERATOR vs cursor vs SLIST_FOREACH\n");
+  BenchTraverse(TRAVERSE_LIST_SIZE);
+  printf("\n");
+
+  printf("SLIST ordering: SLIST_Sort vs qsort of a copy, SLIST_Merge, SLIST_InsertSorted\n");
+  for (size_t i = 0; i < sizeof(SortListSizes) / sizeof(SortListSizes[0]); i++)
+  {
+    BenchSort(SortListSizes[i]);
+    BenchMerge(SortListSizes[i]);
+  }
+  BenchInsertSorted(INSERT_SORTED_SIZE);
+  printf("\n");
+
+  printf("SLIST moving elements between lists: per element vs relinking\n");
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchMoveAll(ListSizes[i], false);
+    BenchMoveAll(ListSizes[i], true);
+    BenchSplitConcat(ListSizes[i]);
+    BenchSpliceRange(ListSizes[i]);
+  }
+  printf("\n");
+
+  printf("SLIST batches of %d: element by element vs batch API\n", BATCH_SIZE);
+  BenchBatch(false, false);
+  BenchBatch(false, true);
+  BenchBatch(true, false);
+  BenchBatch(true, true);
+  printf("\n");
+
+  printf("SLIST Zipf distributed lookups: static vs move-to-front vs transpose\n");
+  for (size_t i = 0; i < sizeof(ZipfListSizes) / sizeof(ZipfListSizes[0]); i++)
+  {
+    BenchZipfFind(ZipfListSizes[i], SLIST_FIND_STATIC);
+    BenchZipfFind(ZipfListSizes[i], SLIST_FIND_MOVE_TO_FRONT);
+    BenchZipfFind(ZipfListSizes[i], SLIST_FIND_TRANSPOSE);
+  }
+  printf("\n");
+
+  printf("SLIST scan of a fragmented list: before vs after SLIST_Compact\n");
+  for (size_t i = 0; i < sizeof(CompactListSizes) / sizeof(CompactListSizes[0]); i++)
+  {
+    BenchCompact(CompactListSizes[i], false);
+    BenchCompact(CompactListSizes[i], true);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+CreateList(SLIST_List_t *const List_p, bool UsePool)
+{
+  if (UsePool)
+  {
+    SLIST_CreateWithPool(List_p, 0);
+  }
+  else
+  {
+    SLIST_Create(List_p);
+  }
+}
+
+// Fills the list with Size elements and drains it again, repeatedly
+static void
+BenchFillDrain(size_t Size, bool UsePool)
+{
+  SLIST_List_t List;
+  static int Data;
+  char Name[64];
+  size_t Rounds = OPERATIONS_PER_RUN / (2 * Size);
+
+  CreateList(&List, UsePool);
+
+  uint64_t Start = BENCH_Now();
+  for (size_t r = 0; r < Rounds; r++)
+  {
+    for (size_t i = 0; i < Size; i++)
+    {
+      SLIST_InsertLast(&List, &Data);
+    }
+    for (size_t i = 0; i < Size; i++)
+    {
+      SLIST_RemoveFirst(&List);
+    }
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "FillDrain/%s/N=%zu", UsePool ? "pool" : "malloc", Size);
+  BENCH_Report(Name, Rounds * Size * 2, Elapsed);
+
+  SLIST_Destroy(&List);
+}
+
+// Keeps Size elements in the list while inserting at the tail and removing
+// at the head, like a work queue
+static void
+BenchChurn(size_t Size, bool UsePool)
+{
+  SLIST_List_t List;
+  static int Data;
+  char Name[64];
+  size_t Operations = OPERATIONS_PER_RUN / 2;
+
+  CreateList(&List, UsePool);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Operations; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+    SLIST_RemoveFirst(&List);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Churn/%s/N=%zu", UsePool ? "pool" : "malloc", Size);
+  BENCH_Report(Name, Operations * 2, Elapsed);
+
+  while (!SLIST_IsEmpty(&List))
+  {
+    SLIST_RemoveFirst(&List);
+  }
+  SLIST_Destroy(&List);
+}
+
+// Measures SLIST_Destroy() alone on a list of Size elements without a destroy
+// function
+static void
+BenchDestroy(size_t Size, bool UsePool)
+{
+  SLIST_List_t List;
+  static int Data;
+  char Name[64];
+
+  CreateList(&List, UsePool);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  SLIST_Destroy(&List);
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Destroy/%s/N=%zu", UsePool ? "pool" : "malloc", Size);
+  BENCH_Report(Name, Size, Elapsed);
+}
+
+// Looks up random keys with SLIST_Find(), then removes random keys with
+// SLIST_RemoveSpecific() and inserts them again at the tail
+static void
+BenchLookup(size_t Size, bool UseIndex)
+{
+  SLIST_List_t List;
+  char Name[64];
+  int* Keys_p = malloc(sizeof(int) * Size);
+  unsigned int Seed = 1;
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  if (UseIndex)
+  {
+    SLIST_CreateIndex(&List);
+  }
+  for (size_t i = 0; i < Size; i++)
+  {
+    Keys_p[i] = (int)i;
+    SLIST_InsertLast(&List, &Keys_p[i]);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < LOOKUPS_PER_RUN; i++)
+  {
+    SLIST_Find(&List, &Keys_p[rand_r(&Seed) % Size]);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Find/%s/N=%zu", UseIndex ? "index" : "linear", Size);
+  BENCH_Report(Name, LOOKUPS_PER_RUN, Elapsed);
+
+  Start = BENCH_Now();
+  for (size_t i = 0; i < LOOKUPS_PER_RUN; i++)
+  {
+    int* Key_p = SLIST_RemoveSpecific(&List, &Keys_p[rand_r(&Seed) % Size]);
+    SLIST_InsertLast(&List, Key_p);
+  }
+  Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "RemoveSpecific/%s/N=%zu", UseIndex ? "index" : "linear", Size);
+  BENCH_Report(Name, LOOKUPS_PER_RUN, Elapsed);
+
+  SLIST_Destroy(&List);
+  free(Keys_p);
+}
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+static size_t
+DataHashInt(const void* const Data_p)
+{
+  return (size_t)*(const int*)Data_p;
+}
+
+// Sums a list of Size elements with each way of iterating it
+static void
+BenchTraverse(size_t Size)
+{
+  SLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * Size);
+  char Name[64];
+  volatile long Sink;
+
+  SLIST_CreateWithPool(&List, 0);
+  for (size_t i = 0; i < Size; i++)
+  {
+    Data_p[i] = (int)i;
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (int r = 0; r < TRAVERSE_ROUNDS; r++)
+  {
+    long Sum = 0;
+    Iterator_t* It_p = ITERATOR_Create(&List);
+    while (ITERATOR_HasNext(It_p))
+    {
+      Sum += *(int*)ITERATOR_GetNext(It_p);
+    }
+    ITERATOR_Destroy(&It_p);
+    Sink = Sum;
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Traverse/ITERATOR/N=%zu", Size);
+  BENCH_Report(Name, TRAVERSE_ROUNDS * Size, Elapsed);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < TRAVERSE_ROUNDS; r++)
+  {
+    long Sum = 0;
+    SLIST_Iterator_t It;
+    SLIST_IteratorInit(&It, &List);
+    while (SLIST_IteratorHasNext(&It))
+    {
+      Sum += *(int*)SLIST_IteratorGetNext(&It);
+    }
+    Sink = Sum;
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Traverse/cursor/N=%zu", Size);
+  BENCH_Report(Name, TRAVERSE_ROUNDS * Size, Elapsed);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < TRAVERSE_ROUNDS; r++)
+  {
+    long Sum = 0;
+    int* Number_p;
+    SLIST_FOREACH(Number_p, &List)
+    {
+      Sum += *Number_p;
+    }
+    Sink = Sum;
+  }
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Traverse/SLIST_FOREACH/N=%zu", Size);
+  BENCH_Report(Name, TRAVERSE_ROUNDS * Size, Elapsed);
+
+  (void)Sink;
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+// Sorts a list of Size random numbers in place, and for comparison the way it
+// was done before: copy the data to an array, qsort() it and build a new list
+static void
+BenchSort(size_t Size)
+{
+  SLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * Size);
+  char Name[64];
+  unsigned int Seed = 1;
+
+  for (size_t i = 0; i < Size; i++)
+  {
+    Data_p[i] = rand_r(&Seed);
+  }
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  uint64_t Start = BENCH_Now();
+  SLIST_Sort(&List);
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Sort/SLIST_Sort/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+  SLIST_Destroy(&List);
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  Start = BENCH_Now();
+  void** Array_p = malloc(sizeof(void*) * Size);
+  size_t Count = 0;
+  while (!SLIST_IsEmpty(&List))
+  {
+    Array_p[Count++] = SLIST_RemoveFirst(&List);
+  }
+  qsort(Array_p, Count, sizeof(void*), CompareIntPointers);
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_InsertLast(&List, Array_p[i]);
+  }
+  free(Array_p);
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Sort/qsort-copy/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+// Merges two sorted lists of Size / 2 interleaved numbers each
+static void
+BenchMerge(size_t Size)
+{
+  SLIST_List_t List;
+  SLIST_List_t Source;
+  int* Data_p = malloc(sizeof(int) * Size);
+  char Name[64];
+
+  SLIST_Create(&List);
+  SLIST_Create(&Source);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    Data_p[i] = (int)i;
+    SLIST_InsertLast((i % 2 == 0) ? &List : &Source, &Data_p[i]);
+  }
+
+  uint64_t Start = BENCH_Now();
+  SLIST_Merge(&List, &Source);
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Merge/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Source);
+  free(Data_p);
+}
+
+// Builds a sorted list of Size random numbers one SLIST_InsertSorted() at a
+// time, which is O(n^2) and only suited to small lists
+static void
+BenchInsertSorted(size_t Size)
+{
+  SLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * Size);
+  char Name[64];
+  unsigned int Seed = 1;
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    Data_p[i] = rand_r(&Seed);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertSorted(&List, &Data_p[i]);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "InsertSorted/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+static int
+CompareIntPointers(const void* Pointer1_p, const void* Pointer2_p)
+{
+  return DataCompareInt(*(void* const*)Pointer1_p, *(void* const*)Pointer2_p);
+}
+
+// Moves all Size elements from one list to another and back, either one by
+// one with SLIST_RemoveFirst() and SLIST_InsertLast() or with SLIST_Concat().
+// Reported per list moved.
+static void
+BenchMoveAll(size_t Size, bool UseConcat)
+{
+  SLIST_List_t Lists[2];
+  static int Data;
+  char Name[64];
+  size_t Rounds = (UseConcat ? OPERATIONS_PER_RUN : OPERATIONS_PER_RUN / 10) / Size;
+  if (Rounds == 0)
+  {
+    Rounds = 1;
+  }
+
+  SLIST_CreateWithPool(&Lists[0], 0);
+  SLIST_CreateWithSharedPool(&Lists[1], &Lists[0]);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&Lists[0], &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t r = 0; r < Rounds; r++)
+  {
+    SLIST_List_t* From_p = &Lists[r % 2];
+    SLIST_List_t* To_p = &Lists[1 - r % 2];
+    if (UseConcat)
+    {
+      SLIST_Concat(To_p, From_p);
+    }
+    else
+    {
+      while (!SLIST_IsEmpty(From_p))
+      {
+        SLIST_InsertLast(To_p, SLIST_RemoveFirst(From_p));
+      }
+    }
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "MoveAll/%s/N=%zu", UseConcat ? "Concat" : "per-element", Size);
+  BENCH_Report(Name, Rounds, Elapsed);
+
+  SLIST_Destroy(&Lists[1]);
+  SLIST_Destroy(&Lists[0]);
+}
+
+// Splits a list of Size elements in the middle and joins it again; costs
+// O(Size / 2) for the walk to the middle
+static void
+BenchSplitConcat(size_t Size)
+{
+  SLIST_List_t List;
+  SLIST_List_t Rest;
+  static int Data;
+  char Name[64];
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_CreateWithSharedPool(&Rest, &List);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t r = 0; r < SPLICE_ROUNDS; r++)
+  {
+    SLIST_SplitAt(&List, Size / 2, &Rest);
+    SLIST_Concat(&List, &Rest);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "SplitAt+Concat/N=%zu", Size);
+  BENCH_Report(Name, SPLICE_ROUNDS, Elapsed);
+
+  SLIST_Destroy(&Rest);
+  SLIST_Destroy(&List);
+}
+
+// Moves a range of 100 elements from the head of one list to the head of the
+// other and back
+static void
+BenchSpliceRange(size_t Size)
+{
+  SLIST_List_t Lists[2];
+  static int Data;
+  char Name[64];
+  size_t Operations = OPERATIONS_PER_RUN / 100;
+
+  SLIST_CreateWithPool(&Lists[0], 0);
+  SLIST_CreateWithSharedPool(&Lists[1], &Lists[0]);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&Lists[i % 2], &Data);
+  }
+
+  uint64_t Start = BENCH_Now();
+  for (size_t r = 0; r < Operations; r++)
+  {
+    SLIST_SpliceRange(&Lists[r % 2], 0, &Lists[1 - r % 2], 0, 100);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "SpliceRange/100/N=%zu", Size);
+  BENCH_Report(Name, Operations, Elapsed);
+
+  SLIST_Destroy(&Lists[1]);
+  SLIST_Destroy(&Lists[0]);
+}
+
+// A producer hands over BATCH_SIZE items at a time and a consumer takes them
+// out again, like a pipeline stage. The list is emptied after every batch,
+// so a pooled list mostly recycles nodes; reported per element.
+static void
+BenchBatch(bool UsePool, bool UseBatch)
+{
+  SLIST_List_t List;
+  static int Data[BATCH_SIZE];
+  void* Items[BATCH_SIZE];
+  void* Removed[BATCH_SIZE];
+  char Name[64];
+  size_t Rounds = OPERATIONS_PER_RUN / BATCH_SIZE;
+
+  for (size_t i = 0; i < BATCH_SIZE; i++)
+  {
+    Items[i] = &Data[i];
+  }
+  CreateList(&List, UsePool);
+
+  uint64_t Start = BENCH_Now();
+  for (size_t r = 0; r < Rounds; r++)
+  {
+    if (UseBatch)
+    {
+      SLIST_InsertLastBatch(&List, Items, BATCH_SIZE);
+      SLIST_RemoveFirstBatch(&List, Removed, BATCH_SIZE);
+    }
+    else
+    {
+      for (size_t i = 0; i < BATCH_SIZE; i++)
+      {
+        SLIST_InsertLast(&List, Items[i]);
+      }
+      for (size_t i = 0; i < BATCH_SIZE; i++)
+      {
+        Removed[i] = SLIST_RemoveFirst(&List);
+      }
+    }
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Batch/%s/%s", UsePool ? "pool" : "malloc",
+           UseBatch ? "batch" : "single");
+  BENCH_Report(Name, Rounds * BATCH_SIZE, Elapsed);
+
+  SLIST_Destroy(&List);
+}
+
+// Looks up keys drawn from a Zipf distribution, where the key of rank r is
+// searched with a probability proportional to 1/r, and reports the average
+// number of compares per lookup next to the time. The ranks are shuffled over
+// the list so that the hot keys do not start at the head, and every policy
+// sees the same sequence of keys.
+static void
+BenchZipfFind(size_t Size, SLIST_FindPolicy_t Policy)
+{
+  static const char* PolicyNames[] = { "static", "move-to-front", "transpose" };
+  SLIST_List_t List;
+  char Name[64];
+  int* Keys_p = malloc(sizeof(int) * Size);
+  int** Ranked_pp = malloc(sizeof(int*) * Size);
+  int** Lookups_pp = malloc(sizeof(int*) * ZIPF_LOOKUPS_PER_RUN);
+  unsigned int Seed = 1;
+  BENCH_Zipf_t Zipf;
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, CountingCompareInt);
+  SLIST_SetFindPolicy(&List, Policy);
+
+  for (size_t i = 0; i < Size; i++)
+  {
+    Keys_p[i] = (int)i;
+    SLIST_InsertLast(&List, &Keys_p[i]);
+    Ranked_pp[i] = &Keys_p[i];
+  }
+  for (size_t i = Size - 1; i > 0; i--)
+  {
+    size_t j = (size_t)rand_r(&Seed) % (i + 1);
+    int* Swap_p = Ranked_pp[i];
+    Ranked_pp[i] = Ranked_pp[j];
+    Ranked_pp[j] = Swap_p;
+  }
+  BENCH_ZipfCreate(&Zipf, Size, Seed);
+  for (size_t i = 0; i < ZIPF_LOOKUPS_PER_RUN; i++)
+  {
+    Lookups_pp[i] = Ranked_pp[BENCH_ZipfNext(&Zipf)];
+  }
+  BENCH_ZipfDestroy(&Zipf);
+
+  CompareCount = 0;
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < ZIPF_LOOKUPS_PER_RUN; i++)
+  {
+    SLIST_Find(&List, Lookups_pp[i]);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "Find/zipf/%s/N=%zu", PolicyNames[Policy], Size);
+  BENCH_Report(Name, ZIPF_LOOKUPS_PER_RUN, Elapsed);
+  printf("%-48s %12.1f compares/lookup\n", "",
+         (double)CompareCount / ZIPF_LOOKUPS_PER_RUN);
+
+  SLIST_Destroy(&List);
+  free(Lookups_pp);
+  free(Ranked_pp);
+  free(Keys_p);
+}
+
+static int
+CountingCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  CompareCount++;
+  return DataCompareInt(Data1_p, Data2_p);
+}
+
+// Fragments a list and scans it before and after SLIST_Compact(). The nodes
+// of a sorted list of shuffled keys are freed in list order, which puts them
+// on the free list of the allocator in random address order, and the nodes
+// for the keys of the measured list are taken from there again. The keys
+// themselves stay in order in memory, so only the nodes are scattered.
+static void
+BenchCompact(size_t Size, bool UsePool)
+{
+  SLIST_List_t List;
+  char Name[64];
+  int* Keys_p = malloc(sizeof(int) * Size);
+  int** Shuffled_pp = malloc(sizeof(int*) * Size);
+  unsigned int Seed = 1;
+
+  for (size_t i = 0; i < Size; i++)
+  {
+    Keys_p[i] = (int)i;
+    Shuffled_pp[i] = &Keys_p[i];
+  }
+  for (size_t i = Size - 1; i > 0; i--)
+  {
+    size_t j = (size_t)rand_r(&Seed) % (i + 1);
+    int* Swap_p = Shuffled_pp[i];
+    Shuffled_pp[i] = Shuffled_pp[j];
+    Shuffled_pp[j] = Swap_p;
+  }
+
+  CreateList(&List, UsePool);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, Shuffled_pp[i]);
+  }
+  SLIST_Sort(&List);
+  while (!SLIST_IsEmpty(&List))
+  {
+    SLIST_RemoveFirst(&List);
+  }
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Keys_p[i]);
+  }
+
+  uint64_t Elapsed = ScanList(&List);
+  snprintf(Name, sizeof(Name), "Scan/fragmented/%s/N=%zu", UsePool ? "pool" : "malloc", Size);
+  BENCH_Report(Name, COMPACT_SCAN_ROUNDS * Size, Elapsed);
+
+  uint64_t Start = BENCH_Now();
+  SLIST_Compact(&List);
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Compact/%s/N=%zu", UsePool ? "pool" : "malloc", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Elapsed = ScanList(&List);
+  snprintf(Name, sizeof(Name), "Scan/compacted/%s/N=%zu", UsePool ? "pool" : "malloc", Size);
+  BENCH_Report(Name, COMPACT_SCAN_ROUNDS * Size, Elapsed);
+
+  SLIST_Destroy(&List);
+  free(Shuffled_pp);
+  free(Keys_p);
+}
+
+// Sums the list COMPACT_SCAN_ROUNDS times and returns the time taken
+static uint64_t
+ScanList(const SLIST_List_t *const List_p)
+{
+  volatile long Sink;
+
+  uint64_t Start = BENCH_Now();
+  for (int r = 0; r < COMPACT_SCAN_ROUNDS; r++)
+  {
+    long Sum = 0;
+    int* Number_p;
+    SLIST_FOREACH(Number_p, List_p)
+    {
+      Sum += *Number_p;
+    }
+    Sink = Sum;
+  }
+  (void)Sink;
+  return BENCH_Now() - Start;
+}
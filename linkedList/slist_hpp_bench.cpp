@@ -0,0 +1,128 @@
+/* > Includes *****************************************************************/
+
+#include <cstdio>
+#include <deque>
+#include <forward_list>
+#include <memory_resource>
+#include <numeric>
+
+extern "C"
+{
+#include "bench.h"
+}
+#include "slist.hpp"
+#include "slist_hpp_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define LIST_SIZE    1000000
+#define SCAN_ROUNDS  10
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static volatile long Sink;
+
+
+/* > Local Function Declarations **********************************************/
+
+template <class Container>
+static void
+BenchContainer(const char* Name_p, Container& List);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_HPP_Benchmarks(void)
+{
+  printf("C++ containers: push, scan, pop of %d ints\n", LIST_SIZE);
+
+  {
+    linkedlist::slist<int> List;
+    BenchContainer("slist", List);
+  }
+  {
+    std::pmr::monotonic_buffer_resource Resource;
+    linkedlist::pmr::slist<int> List(&Resource);
+    BenchContainer("pmr::slist/monotonic", List);
+  }
+  {
+    std::forward_list<int> List;
+    BenchContainer("forward_list", List);
+  }
+  {
+    std::pmr::monotonic_buffer_resource Resource;
+    std::pmr::forward_list<int> List(&Resource);
+    BenchContainer("pmr::forward_list/monotonic", List);
+  }
+  {
+    std::deque<int> List;
+    BenchContainer("deque", List);
+  }
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// std::forward_list has no push_back; pushing at the front visits the same
+// number of nodes
+template <class Container>
+static void
+Push(Container& List, int Value)
+{
+  if constexpr (std::is_same_v<Container, std::forward_list<int>> ||
+                std::is_same_v<Container, std::pmr::forward_list<int>>)
+  {
+    List.push_front(Value);
+  }
+  else
+  {
+    List.push_back(Value);
+  }
+}
+
+template <class Container>
+static void
+BenchContainer(const char* Name_p, Container& List)
+{
+  char Name[64];
+
+  uint64_t Start = BENCH_Now();
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    Push(List, i);
+  }
+  snprintf(Name, sizeof(Name), "Push/%s", Name_p);
+  BENCH_Report(Name, LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    Sink = std::accumulate(List.begin(), List.end(), 0L);
+  }
+  snprintf(Name, sizeof(Name), "Scan/%s", Name_p);
+  BENCH_Report(Name, (size_t)SCAN_ROUNDS * LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    List.pop_front();
+  }
+  snprintf(Name, sizeof(Name), "Pop/%s", Name_p);
+  BENCH_Report(Name, LIST_SIZE, BENCH_Now() - Start);
+}
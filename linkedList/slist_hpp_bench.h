@@ -0,0 +1,34 @@
+#ifndef SLIST_HPP_BENCH_H
+#define SLIST_HPP_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void
+Run_SLIST_HPP_Benchmarks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif // SLIST_HPP_BENCH_H
@@ -0,0 +1,273 @@
+/* > Includes *****************************************************************/
+
+#include <cstdio>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+#include "CuTest.h"
+}
+#include "slist.hpp"
+#include "slist_hpp_test.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+// Counts live instances and can only be moved, not copied
+struct Tracked
+{
+  static int Live;
+
+  explicit Tracked(int Value) : Value(Value) { Live++; }
+  Tracked(Tracked&& Other) noexcept : Value(Other.Value) { Live++; }
+  Tracked(const Tracked&) = delete;
+  ~Tracked() { Live--; }
+
+  int Value;
+};
+
+int Tracked::Live = 0;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestPushPop(CuTest* Test_p);
+
+static void
+TestAlgorithms(CuTest* Test_p);
+
+static void
+TestEmplaceMoveOnly(CuTest* Test_p);
+
+static void
+TestCopyMove(CuTest* Test_p);
+
+static void
+TestPmrAllocator(CuTest* Test_p);
+
+static void
+TestPmrAssignAcrossResources(CuTest* Test_p);
+
+static CuSuite*
+Get_SLIST_HPP_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_HPP_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SLIST_HPP_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+TestPushPop(CuTest* Test_p)
+{
+  linkedlist::slist<int> List;
+
+  CuAssertTrue(Test_p, List.empty());
+  CuAssertTrue(Test_p, List.begin() == List.end());
+
+  List.push_back(2);
+  List.push_back(3);
+  List.push_front(1);
+  CuAssertTrue(Test_p, List.size() == 3);
+  CuAssertIntEquals(Test_p, 1, List.front());
+  CuAssertIntEquals(Test_p, 3, List.back());
+
+  List.pop_front();
+  CuAssertIntEquals(Test_p, 2, List.front());
+  List.clear();
+  CuAssertTrue(Test_p, List.empty());
+}
+
+
+static void
+TestAlgorithms(CuTest* Test_p)
+{
+  linkedlist::slist<int> List = { 5, 1, 4, 2, 3 };
+
+  CuAssertIntEquals(Test_p, 15, std::accumulate(List.begin(), List.end(), 0));
+  CuAssertIntEquals(Test_p, 5, (int)std::distance(List.cbegin(), List.cend()));
+  CuAssertIntEquals(Test_p, 1, *std::min_element(List.begin(), List.end()));
+
+  auto Found = std::find(List.begin(), List.end(), 4);
+  CuAssertTrue(Test_p, Found != List.end());
+  *Found = 40;
+  CuAssertIntEquals(Test_p, 40, *std::max_element(List.begin(), List.end()));
+
+  linkedlist::slist<int>::const_iterator Converted = Found;
+  CuAssertIntEquals(Test_p, 40, *Converted);
+
+  std::vector<int> Copy(List.begin(), List.end());
+  CuAssertTrue(Test_p, (Copy == std::vector<int>{ 5, 1, 40, 2, 3 }));
+
+  linkedlist::slist<std::string> Strings = { "a", "bc" };
+  CuAssertIntEquals(Test_p, 1, (int)Strings.begin()->size());
+}
+
+
+static void
+TestEmplaceMoveOnly(CuTest* Test_p)
+{
+  {
+    linkedlist::slist<Tracked> List;
+
+    // Constructed in place, never copied
+    Tracked& Second = List.emplace_back(2);
+    List.emplace_front(1);
+    List.push_back(Tracked(3));
+    CuAssertIntEquals(Test_p, 2, Second.Value);
+    CuAssertIntEquals(Test_p, 3, Tracked::Live);
+
+    List.pop_front();
+    CuAssertIntEquals(Test_p, 2, Tracked::Live);
+
+    linkedlist::slist<Tracked> Moved(std::move(List));
+    CuAssertTrue(Test_p, List.empty());
+    CuAssertIntEquals(Test_p, 2, Moved.front().Value);
+    CuAssertIntEquals(Test_p, 2, Tracked::Live);
+  }
+  CuAssertIntEquals(Test_p, 0, Tracked::Live);
+}
+
+
+static void
+TestCopyMove(CuTest* Test_p)
+{
+  linkedlist::slist<int> List = { 1, 2, 3 };
+  linkedlist::slist<int> Copy(List);
+
+  Copy.front() = 10;
+  CuAssertIntEquals(Test_p, 1, List.front());
+  CuAssertTrue(Test_p, Copy.size() == 3);
+
+  linkedlist::slist<int> Other = { 7 };
+  Other = std::move(Copy);
+  CuAssertIntEquals(Test_p, 10, Other.front());
+  CuAssertIntEquals(Test_p, 3, Other.back());
+
+  swap(List, Other);
+  CuAssertIntEquals(Test_p, 10, List.front());
+  CuAssertIntEquals(Test_p, 1, Other.front());
+}
+
+
+static void
+TestPmrAllocator(CuTest* Test_p)
+{
+  alignas(std::max_align_t) unsigned char Buffer[4096];
+  std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer),
+                                               std::pmr::null_memory_resource());
+  linkedlist::pmr::slist<int> List(&Resource);
+
+  for (int i = 0; i < 10; i++)
+  {
+    List.push_back(i);
+  }
+  CuAssertIntEquals(Test_p, 45, std::accumulate(List.begin(), List.end(), 0));
+
+  // Every node was carved from the buffer
+  for (int& Value : List)
+  {
+    unsigned char* Address_p = reinterpret_cast<unsigned char*>(&Value);
+    CuAssertTrue(Test_p, Address_p >= Buffer && Address_p < Buffer + sizeof(Buffer));
+  }
+  CuAssertTrue(Test_p, List.get_allocator().resource() == &Resource);
+}
+
+
+// Assignment keeps the resource of the target, as polymorphic_allocator does
+// not propagate, so every node of the target must come from that resource
+static void
+TestPmrAssignAcrossResources(CuTest* Test_p)
+{
+  alignas(std::max_align_t) unsigned char Buffer[4096];
+  std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer),
+                                               std::pmr::null_memory_resource());
+  linkedlist::pmr::slist<std::pmr::string> Source(&Resource);
+  linkedlist::pmr::slist<std::pmr::string> Copied;
+  linkedlist::pmr::slist<std::pmr::string> Moved = { "old" };
+
+  for (int i = 0; i < 5; i++)
+  {
+    Source.push_back(std::pmr::string(1, static_cast<char>('a' + i)));
+  }
+
+  Copied = Source;
+  CuAssertTrue(Test_p, Copied.get_allocator().resource() == std::pmr::get_default_resource());
+  CuAssertTrue(Test_p, std::equal(Source.begin(), Source.end(), Copied.begin(), Copied.end()));
+
+  Moved = std::move(Source);
+  CuAssertTrue(Test_p, Moved.get_allocator().resource() == std::pmr::get_default_resource());
+  CuAssertTrue(Test_p, Source.empty());
+  CuAssertTrue(Test_p, std::equal(Copied.begin(), Copied.end(), Moved.begin(), Moved.end()));
+  for (std::pmr::string& Value : Moved)
+  {
+    unsigned char* Address_p = reinterpret_cast<unsigned char*>(&Value);
+    CuAssertTrue(Test_p, Address_p < Buffer || Address_p >= Buffer + sizeof(Buffer));
+  }
+
+  // The other way round, the nodes are carved from the buffer
+  linkedlist::pmr::slist<int> Numbers = { 1, 2, 3 };
+  linkedlist::pmr::slist<int> Buffered(&Resource);
+  Buffered = std::move(Numbers);
+  CuAssertIntEquals(Test_p, 6, std::accumulate(Buffered.begin(), Buffered.end(), 0));
+  for (int& Value : Buffered)
+  {
+    unsigned char* Address_p = reinterpret_cast<unsigned char*>(&Value);
+    CuAssertTrue(Test_p, Address_p >= Buffer && Address_p < Buffer + sizeof(Buffer));
+  }
+}
+
+
+static CuSuite*
+Get_SLIST_HPP_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestPushPop);
+  SUITE_ADD_TEST(Suite_p, TestAlgorithms);
+  SUITE_ADD_TEST(Suite_p, TestEmplaceMoveOnly);
+  SUITE_ADD_TEST(Suite_p, TestCopyMove);
+  SUITE_ADD_TEST(Suite_p, TestPmrAllocator);
+  SUITE_ADD_TEST(Suite_p, TestPmrAssignAcrossResources);
+
+  return Suite_p;
+}
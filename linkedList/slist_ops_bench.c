@@ -0,0 +1,552 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "slist_ops_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SAMPLE_COUNT      50
+
+// Operations per sample of the O(1) operations
+#define OPS_PER_SAMPLE    1000
+
+// Nodes visited per sample of the O(n) operations, which gives the number of
+// operations per sample for a list size
+#define NODES_PER_SAMPLE  1000000
+
+
+/* > Type Declarations  *******************************************************/
+
+// The list under test with its keys. The list always holds Keys_p[0] to
+// Keys_p[Size - 1] in order between two samples, which the operations undo
+// after every sample, untimed.
+typedef struct Fixture
+{
+  SLIST_List_t List;
+  const char*  Kind_p;
+  size_t       Size;
+  int*         Keys_p;
+  int**        Ranked_pp;
+  size_t*      Permutation_p;
+  size_t       NextPermuted;
+  void**       Removed_pp;
+  bool*        Taken_p;
+  BENCH_Zipf_t Zipf;
+  unsigned int Seed;
+  uint64_t     Samples[SAMPLE_COUNT];
+} Fixture_t;
+
+// Runs Count operations on the fixture, timed
+typedef void (*Operation_t)(Fixture_t *const Fixture_p, size_t Count);
+
+// Brings the list back to its state before the operations, untimed
+typedef void (*Restore_t)(Fixture_t *const Fixture_p, size_t Count);
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static volatile size_t Sink;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchListSize(size_t Size, bool UsePool);
+
+static void
+Measure(Fixture_t *const Fixture_p,
+        const char *const Operation_p,
+        size_t OpsPerSample,
+        size_t ElementsPerOp,
+        Operation_t Operation_fp,
+        Restore_t Restore_fp);
+
+static size_t
+LinearOps(size_t Size);
+
+static size_t
+DrawRandom(Fixture_t *const Fixture_p);
+
+static size_t
+DrawZipf(Fixture_t *const Fixture_p);
+
+static void
+InsertFirst(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+InsertLast(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RemoveFirst(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RemoveLast(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RemoveSpecificRandom(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RemoveSpecificZipf(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+FindRandom(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+FindZipf(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+Length(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+Print(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+Iterate(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+Foreach(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RestoreRemoveFirst(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RestoreInsertFirst(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RestoreRemoveLast(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RestoreInsertLast(Fixture_t *const Fixture_p, size_t Count);
+
+static void
+RestoreInsertSorted(Fixture_t *const Fixture_p, size_t Count);
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+static void
+NullPrint(const void* const Data_p);
+
+static void
+PrintProfile(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_OPS_Benchmarks(void)
+{
+  printf("SLIST public operations, %d samples each, ns/op with percentiles over samples\n",
+         SAMPLE_COUNT);
+  SLIST_ResetProfile();
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchListSize(ListSizes[i], false);
+    BenchListSize(ListSizes[i], true);
+  }
+  PrintProfile();
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Measures every operation on a list of Size elements. The O(1) operations
+// run OPS_PER_SAMPLE times per sample, the O(n) ones often enough to visit
+// about NODES_PER_SAMPLE nodes. Removals are limited to the elements there
+// are, and the removals of specific keys to distinct keys within a sample.
+// An operation is one call, except for the two traversals, where it is one
+// element.
+static void
+BenchListSize(size_t Size, bool UsePool)
+{
+  Fixture_t Fixture;
+  size_t LinearCount = LinearOps(Size);
+  size_t RemoveCount = (Size < OPS_PER_SAMPLE) ? Size : OPS_PER_SAMPLE;
+  size_t SpecificCount = (LinearCount < RemoveCount / 2) ? LinearCount : RemoveCount / 2;
+  size_t Traversals = (LinearCount > Size) ? LinearCount / Size : 1;
+
+  Fixture.Kind_p = UsePool ? "pool" : "malloc";
+  Fixture.Size = Size;
+  Fixture.Seed = 1;
+  Fixture.NextPermuted = 0;
+  Fixture.Keys_p = malloc(Size * sizeof(int));
+  Fixture.Ranked_pp = malloc(Size * sizeof(int*));
+  Fixture.Permutation_p = malloc(Size * sizeof(size_t));
+  Fixture.Taken_p = calloc(Size, sizeof(bool));
+  Fixture.Removed_pp = malloc(OPS_PER_SAMPLE * sizeof(void*));
+  BENCH_ZipfCreate(&Fixture.Zipf, Size, 1);
+
+  if (UsePool)
+  {
+    SLIST_CreateWithPool(&Fixture.List, 0);
+  }
+  else
+  {
+    SLIST_Create(&Fixture.List);
+  }
+  SLIST_SetCompareFunction(&Fixture.List, DataCompareInt);
+  SLIST_SetPrintFunction(&Fixture.List, NullPrint);
+  for (size_t i = 0; i < Size; i++)
+  {
+    Fixture.Keys_p[i] = (int)i;
+    Fixture.Ranked_pp[i] = &Fixture.Keys_p[i];
+    Fixture.Permutation_p[i] = i;
+    SLIST_InsertLast(&Fixture.List, &Fixture.Keys_p[i]);
+  }
+
+  // The hot Zipf ranks and the random removal order are spread over the list
+  for (size_t i = Size - 1; i > 0; i--)
+  {
+    size_t j = (size_t)rand_r(&Fixture.Seed) % (i + 1);
+    int* Swap_p = Fixture.Ranked_pp[i];
+    Fixture.Ranked_pp[i] = Fixture.Ranked_pp[j];
+    Fixture.Ranked_pp[j] = Swap_p;
+    j = (size_t)rand_r(&Fixture.Seed) % (i + 1);
+    size_t Swap = Fixture.Permutation_p[i];
+    Fixture.Permutation_p[i] = Fixture.Permutation_p[j];
+    Fixture.Permutation_p[j] = Swap;
+  }
+
+  Measure(&Fixture, "InsertFirst", OPS_PER_SAMPLE, 1, InsertFirst, RestoreRemoveFirst);
+  Measure(&Fixture, "InsertLast", OPS_PER_SAMPLE, 1, InsertLast, RestoreRemoveLast);
+  Measure(&Fixture, "RemoveFirst", RemoveCount, 1, RemoveFirst, RestoreInsertFirst);
+  Measure(&Fixture, "RemoveLast", (LinearCount < RemoveCount) ? LinearCount : RemoveCount, 1,
+          RemoveLast, RestoreInsertLast);
+  Measure(&Fixture, "RemoveSpecific/random", SpecificCount, 1,
+          RemoveSpecificRandom, RestoreInsertSorted);
+  Measure(&Fixture, "RemoveSpecific/zipf", SpecificCount, 1,
+          RemoveSpecificZipf, RestoreInsertSorted);
+  Measure(&Fixture, "Find/random", LinearCount, 1, FindRandom, NULL);
+  Measure(&Fixture, "Find/zipf", LinearCount, 1, FindZipf, NULL);
+  Measure(&Fixture, "Length", OPS_PER_SAMPLE, 1, Length, NULL);
+  Measure(&Fixture, "Print", Traversals, 1, Print, NULL);
+  Measure(&Fixture, "IteratorGetNext", Traversals, Size, Iterate, NULL);
+  Measure(&Fixture, "SLIST_FOREACH", Traversals, Size, Foreach, NULL);
+
+  SLIST_Destroy(&Fixture.List);
+  BENCH_ZipfDestroy(&Fixture.Zipf);
+  free(Fixture.Removed_pp);
+  free(Fixture.Taken_p);
+  free(Fixture.Permutation_p);
+  free(Fixture.Ranked_pp);
+  free(Fixture.Keys_p);
+}
+
+// Takes SAMPLE_COUNT samples of OpsPerSample calls of Operation_fp, each
+// followed by Restore_fp if given, and reports them. The allocations are
+// counted over the timed part only. ElementsPerOp scales calls to operations
+// for the Traversals.
+static void
+Measure(Fixture_t *const Fixture_p,
+        const char *const Operation_p,
+        size_t OpsPerSample,
+        size_t ElementsPerOp,
+        Operation_t Operation_fp,
+        Restore_t Restore_fp)
+{
+  char Name[64];
+  size_t Allocations = 0;
+
+  if (OpsPerSample == 0)
+  {
+    return;
+  }
+
+  for (size_t s = 0; s < SAMPLE_COUNT; s++)
+  {
+    size_t AllocationsBefore = BENCH_Allocations();
+    uint64_t Start = BENCH_Now();
+    Operation_fp(Fixture_p, OpsPerSample);
+    Fixture_p->Samples[s] = BENCH_Now() - Start;
+    Allocations += BENCH_Allocations() - AllocationsBefore;
+
+    if (Restore_fp != NULL)
+    {
+      Restore_fp(Fixture_p, OpsPerSample);
+    }
+  }
+
+  snprintf(Name, sizeof(Name), "slist/%s/%s/N=%zu", Operation_p, Fixture_p->Kind_p,
+           Fixture_p->Size);
+  BENCH_ReportSamples(Name, OpsPerSample * ElementsPerOp, Fixture_p->Samples,
+                      SAMPLE_COUNT, Allocations);
+}
+
+static size_t
+LinearOps(size_t Size)
+{
+  return (Size < NODES_PER_SAMPLE) ? NODES_PER_SAMPLE / Size : 1;
+}
+
+// Returns the Position of a key not yet taken in this sample, cycling through
+// a random permutation of all keys
+static size_t
+DrawRandom(Fixture_t *const Fixture_p)
+{
+  size_t Position = Fixture_p->Permutation_p[Fixture_p->NextPermuted];
+  Fixture_p->NextPermuted = (Fixture_p->NextPermuted + 1) % Fixture_p->Size;
+  return Position;
+}
+
+// Returns the Position of a Zipf distributed key
+static size_t
+DrawZipf(Fixture_t *const Fixture_p)
+{
+  return (size_t)(Fixture_p->Ranked_pp[BENCH_ZipfNext(&Fixture_p->Zipf)] - Fixture_p->Keys_p);
+}
+
+static void
+InsertFirst(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_InsertFirst(&Fixture_p->List, &Fixture_p->Keys_p[0]);
+  }
+}
+
+static void
+InsertLast(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_InsertLast(&Fixture_p->List, &Fixture_p->Keys_p[0]);
+  }
+}
+
+static void
+RemoveFirst(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    Fixture_p->Removed_pp[i] = SLIST_RemoveFirst(&Fixture_p->List);
+  }
+}
+
+static void
+RemoveLast(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    Fixture_p->Removed_pp[i] = SLIST_RemoveLast(&Fixture_p->List);
+  }
+}
+
+static void
+RemoveSpecificRandom(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    Fixture_p->Removed_pp[i] = SLIST_RemoveSpecific(&Fixture_p->List,
+                                                    &Fixture_p->Keys_p[DrawRandom(Fixture_p)]);
+  }
+}
+
+// Draws distinct keys, as a key can only be removed once per sample. Drawing
+// costs O(log n), next to the O(n) of the removal.
+static void
+RemoveSpecificZipf(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    size_t Position = DrawZipf(Fixture_p);
+    while (Fixture_p->Taken_p[Position])
+    {
+      Position = DrawZipf(Fixture_p);
+    }
+    Fixture_p->Taken_p[Position] = true;
+    Fixture_p->Removed_pp[i] = SLIST_RemoveSpecific(&Fixture_p->List,
+                                                    &Fixture_p->Keys_p[Position]);
+  }
+}
+
+static void
+FindRandom(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    size_t Position = (size_t)rand_r(&Fixture_p->Seed) % Fixture_p->Size;
+    Sink += (SLIST_Find(&Fixture_p->List, &Fixture_p->Keys_p[Position]) != NULL);
+  }
+}
+
+static void
+FindZipf(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    Sink += (SLIST_Find(&Fixture_p->List, &Fixture_p->Keys_p[DrawZipf(Fixture_p)]) != NULL);
+  }
+}
+
+static void
+Length(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    Sink += SLIST_Length(&Fixture_p->List);
+  }
+}
+
+static void
+Print(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_Print(&Fixture_p->List);
+  }
+}
+
+static void
+Iterate(Fixture_t *const Fixture_p, size_t Count)
+{
+  SLIST_Iterator_t It;
+  size_t Sum = 0;
+
+  SLIST_IteratorInit(&It, &Fixture_p->List);
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_IteratorReset(&It);
+    while (SLIST_IteratorHasNext(&It))
+    {
+      Sum += (size_t)*(int*)SLIST_IteratorGetNext(&It);
+    }
+  }
+  Sink += Sum;
+}
+
+static void
+Foreach(Fixture_t *const Fixture_p, size_t Count)
+{
+  size_t Sum = 0;
+
+  for (size_t i = 0; i < Count; i++)
+  {
+    int* Number_p;
+    SLIST_FOREACH(Number_p, &Fixture_p->List)
+    {
+      Sum += (size_t)*Number_p;
+    }
+  }
+  Sink += Sum;
+}
+
+static void
+RestoreRemoveFirst(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_RemoveFirst(&Fixture_p->List);
+  }
+}
+
+static void
+RestoreInsertFirst(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = Count; i > 0; i--)
+  {
+    SLIST_InsertFirst(&Fixture_p->List, Fixture_p->Removed_pp[i - 1]);
+  }
+}
+
+// Cuts the Count elements appended by InsertLast() off in one go
+static void
+RestoreRemoveLast(Fixture_t *const Fixture_p, size_t Count)
+{
+  SLIST_List_t Rest;
+
+  (void)Count;
+  SLIST_CreateWithSharedPool(&Rest, &Fixture_p->List);
+  SLIST_SplitAt(&Fixture_p->List, Fixture_p->Size, &Rest);
+  SLIST_Destroy(&Rest);
+}
+
+static void
+RestoreInsertLast(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = Count; i > 0; i--)
+  {
+    SLIST_InsertLast(&Fixture_p->List, Fixture_p->Removed_pp[i - 1]);
+  }
+}
+
+// Puts the removed keys back at their place, as the list is sorted
+static void
+RestoreInsertSorted(Fixture_t *const Fixture_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    int* Key_p = Fixture_p->Removed_pp[i];
+    Fixture_p->Taken_p[Key_p - Fixture_p->Keys_p] = false;
+    SLIST_InsertSorted(&Fixture_p->List, Key_p);
+  }
+}
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+static void
+NullPrint(const void* const Data_p)
+{
+  Sink += (Data_p != NULL);
+}
+
+// Summarizes the counters of an instrumented build over the whole suite,
+// fixture setup included
+static void
+PrintProfile(void)
+{
+  SLIST_Profile_t Profile;
+
+  if (!SLIST_GetProfile(&Profile))
+  {
+    return;
+  }
+
+  printf("Profile: %llu node allocs, %llu node frees, %llu compares, "
+         "%llu scans visiting %.1f nodes on average (p99 <= %llu)\n",
+         (unsigned long long)Profile.NodeAllocs,
+         (unsigned long long)Profile.NodeFrees,
+         (unsigned long long)Profile.Compares,
+         (unsigned long long)Profile.Scans,
+         (Profile.Scans != 0) ? (double)Profile.NodesVisited / Profile.Scans : 0.0,
+         (unsigned long long)SLIST_HistogramPercentile(Profile.ScanLength, 99));
+  for (int Op = 0; Op < SLIST_OP_COUNT; Op++)
+  {
+    uint64_t Calls = 0;
+    for (int b = 0; b < SLIST_HISTOGRAM_BUCKETS; b++)
+    {
+      Calls += Profile.Latency[Op][b];
+    }
+    if (Calls != 0)
+    {
+      printf("  %-16s %12llu calls  p50 <= %10llu ns  p99 <= %10llu ns\n",
+             SLIST_OperationName((SLIST_Operation_t)Op),
+             (unsigned long long)Calls,
+             (unsigned long long)SLIST_HistogramPercentile(Profile.Latency[Op], 50),
+             (unsigned long long)SLIST_HistogramPercentile(Profile.Latency[Op], 99));
+    }
+  }
+}
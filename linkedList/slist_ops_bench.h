@@ -0,0 +1,26 @@
+#ifndef SLIST_OPS_BENCH_H
+#define SLIST_OPS_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_OPS_Benchmarks(void);
+
+
+#endif // SLIST_OPS_BENCH_H
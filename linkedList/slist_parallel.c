@@ -0,0 +1,216 @@
+/* > Includes *****************************************************************/
+#include "slist_parallel.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "slist_trace.h"
+
+
+/* > Defines ******************************************************************/
+
+// Lists shorter than this are not worth handing to other threads
+#define PARALLEL_MIN_CHUNK_LENGTH  1024
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct VisitChunk
+{
+  const SLIST_Node_t* First_p;
+  size_t              Length;
+  DataVisit_t         Visit_fp;
+  void*               Context_p;
+} VisitChunk_t;
+
+typedef struct MergePair
+{
+  SLIST_List_t* List_p;
+  SLIST_List_t* Source_p;
+} MergePair_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static size_t
+ChunkCount(const SLIST_List_t *const List_p, const THREADPOOL_Pool_t *const Pool_p);
+
+static void
+VisitJob(void* const Argument_p);
+
+static void
+SortJob(void* const Argument_p);
+
+static void
+MergeJob(void* const Argument_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+SLIST_ParallelForEach(const SLIST_List_t *const List_p,
+                      THREADPOOL_Pool_t *const Pool_p,
+                      DataVisit_t Visit_fp,
+                      void *const Context_p)
+{
+  size_t chunkCount = ChunkCount(List_p, Pool_p);
+  if (chunkCount == 0)
+  {
+    return;
+  }
+
+  // One walk over the list finds the first node of every chunk; the first
+  // length % chunkCount chunks take one element more
+  VisitChunk_t* chunks_p = malloc(sizeof(VisitChunk_t) * chunkCount);
+  size_t length = List_p->Stats.Length;
+  const SLIST_Node_t* node_p = List_p->Head_p;
+  for (size_t i = 0; i < chunkCount; i++)
+  {
+    chunks_p[i].First_p = node_p;
+    chunks_p[i].Length = length / chunkCount + (i < length % chunkCount);
+    chunks_p[i].Visit_fp = Visit_fp;
+    chunks_p[i].Context_p = Context_p;
+    for (size_t n = 0; n < chunks_p[i].Length; n++)
+    {
+      node_p = node_p->Next_p;
+    }
+    THREADPOOL_Submit(Pool_p, VisitJob, &chunks_p[i]);
+  }
+  THREADPOOL_Wait(Pool_p);
+  free(chunks_p);
+}
+
+void
+SLIST_ParallelSort(SLIST_List_t *const List_p, THREADPOOL_Pool_t *const Pool_p)
+{
+  size_t chunkCount = ChunkCount(List_p, Pool_p);
+  if (chunkCount <= 1)
+  {
+    SLIST_Sort(List_p);
+    return;
+  }
+
+  // A trace sees one sort of List_p; the lists of the chunks are internal and
+  // their operations are not recorded, see SortJob()
+#ifdef SLIST_TRACE
+  if (SLIST_TraceIsActive())
+  {
+    SLIST_TraceRecord(SLIST_TRACE_SORT, (uint64_t)(uintptr_t)List_p, 0, true);
+  }
+#endif
+  SLIST_TracePause();
+
+  // Every chunk becomes a list of its own with plain malloc() bookkeeping, so
+  // that SLIST_Sort() and SLIST_Merge() relink its nodes without freeing or
+  // allocating any; the nodes go back to List_p at the end
+  SLIST_List_t* parts_p = malloc(sizeof(SLIST_List_t) * chunkCount);
+  MergePair_t* pairs_p = malloc(sizeof(MergePair_t) * chunkCount);
+  size_t length = List_p->Stats.Length;
+  SLIST_Node_t* node_p = List_p->Head_p;
+  for (size_t i = 0; i < chunkCount; i++)
+  {
+    SLIST_Create(&parts_p[i]);
+    parts_p[i].Callbacks.DataCompare_fp = List_p->Callbacks.DataCompare_fp;
+    parts_p[i].Stats.Length = length / chunkCount + (i < length % chunkCount);
+    parts_p[i].Head_p = node_p;
+    for (size_t n = 1; n < parts_p[i].Stats.Length; n++)
+    {
+      node_p = node_p->Next_p;
+    }
+    parts_p[i].Tail_p = node_p;
+    node_p = node_p->Next_p;
+    parts_p[i].Tail_p->Next_p = NULL;
+    THREADPOOL_Submit(Pool_p, SortJob, &parts_p[i]);
+  }
+  THREADPOOL_Wait(Pool_p);
+
+  // Merge neighbouring runs so that earlier elements stay first on ties
+  for (size_t step = 1; step < chunkCount; step *= 2)
+  {
+    size_t pairCount = 0;
+    for (size_t i = 0; i + step < chunkCount; i += 2 * step)
+    {
+      pairs_p[pairCount].List_p = &parts_p[i];
+      pairs_p[pairCount].Source_p = &parts_p[i + step];
+      THREADPOOL_Submit(Pool_p, MergeJob, &pairs_p[pairCount]);
+      pairCount++;
+    }
+    THREADPOOL_Wait(Pool_p);
+  }
+
+  List_p->Head_p = parts_p[0].Head_p;
+  List_p->Tail_p = parts_p[0].Tail_p;
+  free(pairs_p);
+  free(parts_p);
+  SLIST_TraceResume();
+
+  if (List_p->Index_p != NULL)
+  {
+    SLIST_CreateIndex(List_p);
+  }
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Returns the number of chunks to split the list into: one per worker, but
+// none shorter than PARALLEL_MIN_CHUNK_LENGTH, and at least one unless the
+// list is empty
+static size_t
+ChunkCount(const SLIST_List_t *const List_p, const THREADPOOL_Pool_t *const Pool_p)
+{
+  size_t length = List_p->Stats.Length;
+  size_t count = THREADPOOL_ThreadCount(Pool_p);
+
+  if (length == 0)
+  {
+    return 0;
+  }
+  if (count > length / PARALLEL_MIN_CHUNK_LENGTH)
+  {
+    count = length / PARALLEL_MIN_CHUNK_LENGTH;
+  }
+  return (count > 0) ? count : 1;
+}
+
+static void
+VisitJob(void* const Argument_p)
+{
+  const VisitChunk_t* chunk_p = Argument_p;
+  const SLIST_Node_t* node_p = chunk_p->First_p;
+
+  for (size_t n = 0; n < chunk_p->Length; n++)
+  {
+    chunk_p->Visit_fp(node_p->Data_p, chunk_p->Context_p);
+    node_p = node_p->Next_p;
+  }
+}
+
+// The jobs run on worker threads, which pause the trace for themselves
+static void
+SortJob(void* const Argument_p)
+{
+  SLIST_TracePause();
+  SLIST_Sort(Argument_p);
+  SLIST_TraceResume();
+}
+
+static void
+MergeJob(void* const Argument_p)
+{
+  MergePair_t* pair_p = Argument_p;
+  SLIST_TracePause();
+  SLIST_Merge(pair_p->List_p, pair_p->Source_p);
+  SLIST_TraceResume();
+}
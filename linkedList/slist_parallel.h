@@ -0,0 +1,87 @@
+#ifndef SLIST_PARALLEL_H
+#define SLIST_PARALLEL_H
+
+/*
+ * Parallel Operations on Singly Linked Lists
+ *
+ * Runs work on large lists on the worker threads of a thread pool. The list
+ * is cut into one chunk of about equal length per worker with a single walk
+ * over it, and every worker handles its chunk. The list must not be modified
+ * by other threads while an operation runs.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stddef.h>
+
+#include "slist.h"
+#include "threadpool.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Visit Function, called with the data of an element and the context given
+// to SLIST_ParallelForEach()
+//
+
+typedef void (*DataVisit_t)(void* const Data_p, void* const Context_p);
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Visits every element of the list in parallel
+ *
+ * Splits the list into one chunk per worker thread of the pool and calls the
+ * visit function for every element on the worker that owns its chunk. The
+ * elements of a chunk are visited in order, the chunks in any order and at
+ * the same time, so the visit function must be thread safe with respect to
+ * the context. Returns when all elements have been visited.
+ *
+ * @param[in]     List_p     Pointer to the list
+ * @param[in]     Pool_p     Pool whose threads do the work
+ * @param[in]     Visit_fp   The function to call for every element
+ * @param[in]     Context_p  Passed to every call of the visit function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ParallelForEach(const SLIST_List_t *const List_p,
+                      THREADPOOL_Pool_t *const Pool_p,
+                      DataVisit_t Visit_fp,
+                      void *const Context_p);
+
+
+/**
+ * @brief Sorts the list in parallel
+ *
+ * Sorts the list like SLIST_Sort(), with the same stable order. Every worker
+ * thread of the pool sorts one chunk of the list, and the sorted chunks are
+ * then merged pairwise, the merges of one round again in parallel. Nodes are
+ * relinked in place; only the bookkeeping for the jobs is allocated. A hash
+ * index is rebuilt afterwards.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Pool_p  Pool whose threads do the work
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ParallelSort(SLIST_List_t *const List_p, THREADPOOL_Pool_t *const Pool_p);
+
+
+#endif // SLIST_PARALLEL_H
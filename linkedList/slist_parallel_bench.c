@@ -0,0 +1,161 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "bench.h"
+#include "slist_parallel.h"
+#include "slist_parallel_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define FOREACH_LIST_SIZE  10000000
+#define SORT_LIST_SIZE     4000000
+
+// Rounds of integer hashing done per element, so that the visit is not only
+// bound by memory bandwidth
+#define VISIT_WORK         16
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ThreadCounts[] = { 1, 2, 4, 8 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchForEach(SLIST_List_t *const List_p, size_t Threads);
+
+static void
+BenchSort(const int *const Data_p, size_t Size, size_t Threads);
+
+static void
+VisitHash(void* const Data_p, void* const Context_p);
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_PARALLEL_Benchmarks(void)
+{
+  SLIST_List_t List;
+  int* Data_p = malloc(sizeof(int) * FOREACH_LIST_SIZE);
+  unsigned int Seed = 1;
+
+  SLIST_CreateWithPool(&List, 0);
+  for (size_t i = 0; i < FOREACH_LIST_SIZE; i++)
+  {
+    Data_p[i] = rand_r(&Seed);
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  printf("SLIST_ParallelForEach, N=%d, by worker threads\n", FOREACH_LIST_SIZE);
+  for (size_t i = 0; i < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); i++)
+  {
+    BenchForEach(&List, ThreadCounts[i]);
+  }
+  printf("\n");
+  SLIST_Destroy(&List);
+
+  printf("SLIST_ParallelSort, N=%d, by worker threads\n", SORT_LIST_SIZE);
+  for (size_t i = 0; i < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); i++)
+  {
+    BenchSort(Data_p, SORT_LIST_SIZE, ThreadCounts[i]);
+  }
+  printf("\n");
+
+  free(Data_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+BenchForEach(SLIST_List_t *const List_p, size_t Threads)
+{
+  THREADPOOL_Pool_t Pool;
+  atomic_ulong Sum = 0;
+  char Name[64];
+
+  THREADPOOL_Create(&Pool, Threads);
+
+  uint64_t Start = BENCH_Now();
+  SLIST_ParallelForEach(List_p, &Pool, VisitHash, &Sum);
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "ParallelForEach/T=%zu", Threads);
+  BENCH_Report(Name, SLIST_Length(List_p), Elapsed);
+
+  THREADPOOL_Destroy(&Pool);
+}
+
+// Sorts a fresh list of the first Size numbers, so every run sees the same
+// unsorted input
+static void
+BenchSort(const int *const Data_p, size_t Size, size_t Threads)
+{
+  SLIST_List_t List;
+  THREADPOOL_Pool_t Pool;
+  char Name[64];
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (size_t i = 0; i < Size; i++)
+  {
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+  THREADPOOL_Create(&Pool, Threads);
+
+  uint64_t Start = BENCH_Now();
+  SLIST_ParallelSort(&List, &Pool);
+  uint64_t Elapsed = BENCH_Now() - Start;
+
+  snprintf(Name, sizeof(Name), "ParallelSort/T=%zu", Threads);
+  BENCH_Report(Name, Size, Elapsed);
+
+  THREADPOOL_Destroy(&Pool);
+  SLIST_Destroy(&List);
+}
+
+// Hashes the element a few times and adds the result to a shared sum once
+// per element, which keeps the atomic off the critical path
+static void
+VisitHash(void* const Data_p, void* const Context_p)
+{
+  unsigned long Hash = (unsigned long)*(int*)Data_p;
+  for (int i = 0; i < VISIT_WORK; i++)
+  {
+    Hash = (Hash ^ (Hash >> 31)) * 0x9e3779b97f4a7c15UL;
+  }
+  if ((Hash & 0xff) == 0)
+  {
+    atomic_fetch_add_explicit((atomic_ulong*)Context_p, 1, memory_order_relaxed);
+  }
+}
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
@@ -0,0 +1,26 @@
+#ifndef SLIST_PARALLEL_BENCH_H
+#define SLIST_PARALLEL_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_PARALLEL_Benchmarks(void);
+
+
+#endif // SLIST_PARALLEL_BENCH_H
@@ -0,0 +1,351 @@
+/* > Includes *****************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "CuTest.h"
+#include "slist_parallel.h"
+#include "slist_parallel_test.h"
+#include "slist_trace.h"
+
+
+/* > Defines ******************************************************************/
+
+// Long enough for every worker of the test pools to get a chunk
+#define LIST_SIZE  20000
+
+#define TRACE_FILE "slist_parallel_test.trace"
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestForEachVisitsEveryElement(CuTest* Test_p);
+
+static void
+TestForEachShortList(CuTest* Test_p);
+
+static void
+TestParallelSort(CuTest* Test_p);
+
+static void
+TestParallelSortIsStable(CuTest* Test_p);
+
+static void
+TestParallelSortKeepsIndex(CuTest* Test_p);
+
+static void
+TestParallelSortTracesOneSort(CuTest* Test_p);
+
+static CuSuite*
+Get_SLIST_PARALLEL_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_PARALLEL_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SLIST_PARALLEL_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+// Orders numbers by their hundreds only, so that many elements compare equal
+static int
+DataCompareHundreds(const void* const Data1_p, const void* const Data2_p)
+{
+  int Hundreds1 = *(const int*)Data1_p / 100;
+  int Hundreds2 = *(const int*)Data2_p / 100;
+  return (Hundreds1 > Hundreds2) - (Hundreds1 < Hundreds2);
+}
+
+static size_t
+DataHashInt(const void* const Data_p)
+{
+  return (size_t)*(const int*)Data_p;
+}
+
+static void
+VisitSum(void* const Data_p, void* const Context_p)
+{
+  atomic_fetch_add((atomic_long*)Context_p, *(int*)Data_p);
+}
+
+// Doubles the element; every element must be visited exactly once
+static void
+VisitDouble(void* const Data_p, void* const Context_p)
+{
+  *(int*)Data_p *= 2;
+}
+
+static int*
+NewRandomNumbers(size_t Count, unsigned int Seed)
+{
+  int* Data_p = malloc(sizeof(int) * Count);
+  for (size_t i = 0; i < Count; i++)
+  {
+    Seed = Seed * 1103515245 + 12345;
+    Data_p[i] = (int)((Seed >> 8) % 10000);
+  }
+  return Data_p;
+}
+
+
+static void
+TestForEachVisitsEveryElement(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  THREADPOOL_Pool_t Pool;
+  int* Data_p = malloc(sizeof(int) * LIST_SIZE);
+  atomic_long Sum = 0;
+
+  SLIST_CreateWithPool(&List, 0);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    Data_p[i] = i;
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  THREADPOOL_Create(&Pool, 3);
+  SLIST_ParallelForEach(&List, &Pool, VisitDouble, NULL);
+  SLIST_ParallelForEach(&List, &Pool, VisitSum, &Sum);
+  THREADPOOL_Destroy(&Pool);
+
+  CuAssertTrue(Test_p, atomic_load(&Sum) == (long)LIST_SIZE * (LIST_SIZE - 1));
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    CuAssertIntEquals(Test_p, 2 * i, Data_p[i]);
+  }
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestForEachShortList(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  THREADPOOL_Pool_t Pool;
+  int Data[] = { 1, 2, 3 };
+  atomic_long Sum = 0;
+
+  THREADPOOL_Create(&Pool, 4);
+  SLIST_Create(&List);
+  SLIST_ParallelForEach(&List, &Pool, VisitSum, &Sum);
+  CuAssertTrue(Test_p, atomic_load(&Sum) == 0);
+
+  for (int i = 0; i < 3; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+  SLIST_ParallelForEach(&List, &Pool, VisitSum, &Sum);
+  CuAssertTrue(Test_p, atomic_load(&Sum) == 6);
+
+  SLIST_Destroy(&List);
+  THREADPOOL_Destroy(&Pool);
+}
+
+
+static void
+TestParallelSort(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Expected;
+  THREADPOOL_Pool_t Pool;
+  // Three workers leave an odd chunk out of the first round of merges
+  int* Data_p = NewRandomNumbers(LIST_SIZE + 1, 11);
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_Create(&Expected);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetCompareFunction(&Expected, DataCompareInt);
+  for (int i = 0; i < LIST_SIZE + 1; i++)
+  {
+    SLIST_InsertLast(&List, &Data_p[i]);
+    SLIST_InsertLast(&Expected, &Data_p[i]);
+  }
+
+  THREADPOOL_Create(&Pool, 3);
+  SLIST_ParallelSort(&List, &Pool);
+  THREADPOOL_Destroy(&Pool);
+  SLIST_Sort(&Expected);
+
+  // Same nodes in the same order as the serial sort
+  SLIST_Node_t* Node_p = List.Head_p;
+  for (SLIST_Node_t* Other_p = Expected.Head_p; Other_p != NULL; Other_p = Other_p->Next_p)
+  {
+    CuAssertPtrNotNull(Test_p, Node_p);
+    CuAssertPtrEquals(Test_p, Other_p->Data_p, Node_p->Data_p);
+    if (Node_p->Next_p == NULL)
+    {
+      CuAssertPtrEquals(Test_p, Node_p, List.Tail_p);
+    }
+    Node_p = Node_p->Next_p;
+  }
+  CuAssertPtrEquals(Test_p, NULL, Node_p);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == LIST_SIZE + 1);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Expected);
+  free(Data_p);
+}
+
+
+static void
+TestParallelSortIsStable(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  THREADPOOL_Pool_t Pool;
+  int* Data_p = NewRandomNumbers(LIST_SIZE, 5);
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareHundreds);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  THREADPOOL_Create(&Pool, 4);
+  SLIST_ParallelSort(&List, &Pool);
+  THREADPOOL_Destroy(&Pool);
+
+  // Equal elements keep their original order, i.e. their addresses grow
+  SLIST_Node_t* Previous_p = List.Head_p;
+  for (SLIST_Node_t* Node_p = Previous_p->Next_p; Node_p != NULL; Node_p = Node_p->Next_p)
+  {
+    int Order = DataCompareHundreds(Previous_p->Data_p, Node_p->Data_p);
+    CuAssertTrue(Test_p, Order < 0 || (Order == 0 && (int*)Previous_p->Data_p < (int*)Node_p->Data_p));
+    Previous_p = Node_p;
+  }
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestParallelSortKeepsIndex(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  THREADPOOL_Pool_t Pool;
+  int* Data_p = malloc(sizeof(int) * LIST_SIZE);
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    Data_p[i] = LIST_SIZE - i;
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+
+  THREADPOOL_Create(&Pool, 2);
+  SLIST_ParallelSort(&List, &Pool);
+  THREADPOOL_Destroy(&Pool);
+
+  CuAssertIntEquals(Test_p, 1, *(int*)List.Head_p->Data_p);
+  CuAssertPtrEquals(Test_p, &Data_p[0], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data_p[1], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data_p[LIST_SIZE / 2], SLIST_RemoveSpecific(&List, &Data_p[LIST_SIZE / 2]));
+  CuAssertTrue(Test_p, List.Index_p->EntryCount == LIST_SIZE - 3);
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+// The trace holds one sort of the list and nothing of the chunk lists; only
+// run when slist.c is built with SLIST_TRACE
+static void
+TestParallelSortTracesOneSort(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  THREADPOOL_Pool_t Pool;
+  SLIST_TraceReader_t Reader;
+  SLIST_TraceRecord_t Record;
+  int* Data_p = NewRandomNumbers(LIST_SIZE, 5);
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+  THREADPOOL_Create(&Pool, 4);
+
+  if (SLIST_TraceStart(TRACE_FILE))
+  {
+    SLIST_ParallelSort(&List, &Pool);
+    // Recording goes on for the caller afterwards
+    SLIST_Find(&List, &Data_p[0]);
+    SLIST_TraceStop();
+
+    CuAssertTrue(Test_p, SLIST_TraceOpen(&Reader, TRACE_FILE));
+    CuAssertTrue(Test_p, SLIST_TraceNext(&Reader, &Record));
+    CuAssertIntEquals(Test_p, SLIST_TRACE_SORT, (int)Record.Operation);
+    CuAssertTrue(Test_p, Record.ListId == (uint64_t)(uintptr_t)&List);
+    CuAssertTrue(Test_p, SLIST_TraceNext(&Reader, &Record));
+    CuAssertIntEquals(Test_p, SLIST_TRACE_FIND, (int)Record.Operation);
+    CuAssertTrue(Test_p, !SLIST_TraceNext(&Reader, &Record));
+    SLIST_TraceClose(&Reader);
+    remove(TRACE_FILE);
+  }
+
+  THREADPOOL_Destroy(&Pool);
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static CuSuite*
+Get_SLIST_PARALLEL_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestForEachVisitsEveryElement);
+  SUITE_ADD_TEST(Suite_p, TestForEachShortList);
+  SUITE_ADD_TEST(Suite_p, TestParallelSort);
+  SUITE_ADD_TEST(Suite_p, TestParallelSortIsStable);
+  SUITE_ADD_TEST(Suite_p, TestParallelSortKeepsIndex);
+  SUITE_ADD_TEST(Suite_p, TestParallelSortTracesOneSort);
+
+  return Suite_p;
+}
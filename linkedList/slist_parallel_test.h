@@ -0,0 +1,26 @@
+#ifndef SLIST_PARALLEL_TEST_H
+#define SLIST_PARALLEL_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_PARALLEL_Tests(void);
+
+
+#endif // SLIST_PARALLEL_TEST_H
@@ -0,0 +1,604 @@
+/* > Includes *****************************************************************/
+#include "slist_replay.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "idxlist.h"
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+#define MIN_RECORDS  4096
+#define MIN_LISTS    16
+
+
+/* > Type Declarations  *******************************************************/
+
+//
+// A list of the trace, found by the id it had when it was recorded
+//
+
+typedef struct SLIST_Replayed
+{
+  uint64_t       Id;
+  bool           Live;
+  SLIST_List_t   Slist;
+  IDXLIST_List_t Idxlist;
+} Replayed_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const char *const VariantNames[SLIST_REPLAY_VARIANT_COUNT] =
+{
+  "slist",
+  "pool",
+  "indexed",
+  "mtf",
+  "transpose",
+  "idxlist"
+};
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+ApplySlist(SLIST_Replay_t *const Replay_p,
+           SLIST_List_t *const List_p,
+           SLIST_List_t *const Other_p,
+           const SLIST_TraceRecord_t *const Record_p);
+
+static void
+ApplyIdxlist(SLIST_Replay_t *const Replay_p,
+             IDXLIST_List_t *const List_p,
+             IDXLIST_List_t *const Other_p,
+             const SLIST_TraceRecord_t *const Record_p);
+
+static void
+MoveIdxlist(SLIST_Replay_t *const Replay_p,
+            IDXLIST_List_t *const List_p,
+            IDXLIST_List_t *const Other_p,
+            const SLIST_TraceRecord_t *const Record_p);
+
+static void**
+Drain(IDXLIST_List_t *const List_p, size_t *const Count_p);
+
+static void
+Refill(IDXLIST_List_t *const List_p, void** const Elements_pp, size_t Begin, size_t End);
+
+static bool
+HasOtherList(uint32_t Operation);
+
+static Replayed_t*
+Lookup(SLIST_Replay_t *const Replay_p, uint64_t Id);
+
+static void
+CreateList(SLIST_Replay_t *const Replay_p, Replayed_t *const Replayed_p);
+
+static void
+DestroyList(SLIST_Replay_t *const Replay_p, Replayed_t *const Replayed_p);
+
+static void
+Check(SLIST_Replay_t *const Replay_p,
+      const void *const Result_p,
+      const SLIST_TraceRecord_t *const Record_p);
+
+static int
+CompareKeys(const void* const Key1_p, const void* const Key2_p);
+
+static size_t
+HashKey(const void* const Key_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+SLIST_TraceRecord_t*
+SLIST_ReplayLoad(const char *const Path_p, size_t *const Count_p)
+{
+  SLIST_TraceReader_t reader;
+  size_t capacity = MIN_RECORDS;
+  size_t count = 0;
+
+  if (!SLIST_TraceOpen(&reader, Path_p))
+  {
+    return NULL;
+  }
+
+  SLIST_TraceRecord_t* records_p = malloc(capacity * sizeof(SLIST_TraceRecord_t));
+  while (records_p != NULL && SLIST_TraceNext(&reader, &records_p[count]))
+  {
+    if (++count == capacity)
+    {
+      capacity *= 2;
+      SLIST_TraceRecord_t* grown_p = realloc(records_p, capacity * sizeof(SLIST_TraceRecord_t));
+      if (grown_p == NULL)
+      {
+        free(records_p);
+      }
+      records_p = grown_p;
+    }
+  }
+  SLIST_TraceClose(&reader);
+  *Count_p = count;
+  return records_p;
+}
+
+void
+SLIST_ReplayCreate(SLIST_Replay_t *const Replay_p, SLIST_ReplayVariant_t Variant)
+{
+  memset(Replay_p, 0, sizeof(SLIST_Replay_t));
+  Replay_p->Variant = Variant;
+}
+
+void
+SLIST_ReplayApply(SLIST_Replay_t *const Replay_p, const SLIST_TraceRecord_t *const Record_p)
+{
+  if (Record_p->Operation >= SLIST_TRACE_OP_COUNT)
+  {
+    Replay_p->Skipped++;
+    return;
+  }
+
+  // Adding the other list of a move later could move this one
+  bool hasOther = HasOtherList(Record_p->Operation);
+  if (hasOther && Lookup(Replay_p, Record_p->OtherId) == NULL)
+  {
+    Replay_p->Skipped++;
+    return;
+  }
+  Replayed_t* replayed_p = Lookup(Replay_p, Record_p->ListId);
+  if (replayed_p == NULL)
+  {
+    Replay_p->Skipped++;
+    return;
+  }
+
+  if (Record_p->Operation == SLIST_TRACE_CREATE)
+  {
+    // Lists created before the trace started are created on first use
+    if (replayed_p->Live)
+    {
+      DestroyList(Replay_p, replayed_p);
+    }
+    CreateList(Replay_p, replayed_p);
+    return;
+  }
+  if (!replayed_p->Live)
+  {
+    CreateList(Replay_p, replayed_p);
+  }
+  if (Record_p->Operation == SLIST_TRACE_DESTROY)
+  {
+    DestroyList(Replay_p, replayed_p);
+    return;
+  }
+
+  Replayed_t* other_p = NULL;
+  if (hasOther)
+  {
+    other_p = Lookup(Replay_p, Record_p->OtherId);
+    if (other_p == replayed_p)
+    {
+      Replay_p->Skipped++;
+      return;
+    }
+    if (!other_p->Live)
+    {
+      CreateList(Replay_p, other_p);
+    }
+  }
+
+  if (Replay_p->Variant == SLIST_REPLAY_IDXLIST)
+  {
+    ApplyIdxlist(Replay_p, &replayed_p->Idxlist,
+                 (other_p != NULL) ? &other_p->Idxlist : NULL, Record_p);
+  }
+  else
+  {
+    ApplySlist(Replay_p, &replayed_p->Slist,
+               (other_p != NULL) ? &other_p->Slist : NULL, Record_p);
+  }
+}
+
+void
+SLIST_ReplayFinish(SLIST_Replay_t *const Replay_p)
+{
+  for (size_t i = 0; i < Replay_p->ListCount; i++)
+  {
+    if (Replay_p->Lists_p[i].Live)
+    {
+      DestroyList(Replay_p, &Replay_p->Lists_p[i]);
+    }
+  }
+  Replay_p->ListCount = 0;
+}
+
+void
+SLIST_ReplayDestroy(SLIST_Replay_t *const Replay_p)
+{
+  SLIST_ReplayFinish(Replay_p);
+  free(Replay_p->Lists_p);
+  Replay_p->Lists_p = NULL;
+  Replay_p->ListCapacity = 0;
+}
+
+const char*
+SLIST_ReplayVariantName(SLIST_ReplayVariant_t Variant)
+{
+  return (Variant < SLIST_REPLAY_VARIANT_COUNT) ? VariantNames[Variant] : "unknown";
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// The data of a list is the address of the key in the record, compared and
+// hashed by the key it points to, so every key, 0 as well, is found by value.
+// Other_p is the other list of an operation between two lists.
+static void
+ApplySlist(SLIST_Replay_t *const Replay_p,
+           SLIST_List_t *const List_p,
+           SLIST_List_t *const Other_p,
+           const SLIST_TraceRecord_t *const Record_p)
+{
+  void* key_p = (void*)&Record_p->Key;
+
+  switch (Record_p->Operation)
+  {
+    case SLIST_TRACE_INSERT_FIRST:
+      SLIST_InsertFirst(List_p, key_p);
+      break;
+    case SLIST_TRACE_INSERT_LAST:
+      SLIST_InsertLast(List_p, key_p);
+      break;
+    case SLIST_TRACE_INSERT_SORTED:
+      SLIST_InsertSorted(List_p, key_p);
+      break;
+    case SLIST_TRACE_REMOVE_FIRST:
+    case SLIST_TRACE_REMOVE_LAST:
+      if (SLIST_IsEmpty(List_p))
+      {
+        Check(Replay_p, NULL, Record_p);
+        break;
+      }
+      Check(Replay_p,
+            (Record_p->Operation == SLIST_TRACE_REMOVE_FIRST) ? SLIST_RemoveFirst(List_p)
+                                                              : SLIST_RemoveLast(List_p),
+            Record_p);
+      break;
+    case SLIST_TRACE_REMOVE_SPECIFIC:
+      Check(Replay_p, SLIST_RemoveSpecific(List_p, key_p), Record_p);
+      break;
+    case SLIST_TRACE_FIND:
+      Check(Replay_p, SLIST_Find(List_p, key_p), Record_p);
+      break;
+    case SLIST_TRACE_SORT:
+      SLIST_Sort(List_p);
+      break;
+    case SLIST_TRACE_CONCAT:
+      SLIST_Concat(List_p, Other_p);
+      break;
+    case SLIST_TRACE_MERGE:
+      SLIST_Merge(List_p, Other_p);
+      break;
+    case SLIST_TRACE_SPLIT_AT:
+      SLIST_SplitAt(List_p, (size_t)Record_p->Position, Other_p);
+      break;
+    case SLIST_TRACE_SPLIT_AFTER:
+      Check(Replay_p, SLIST_SplitAfter(List_p, key_p, Other_p) ? key_p : NULL, Record_p);
+      break;
+    case SLIST_TRACE_SPLICE_RANGE:
+      SLIST_SpliceRange(List_p, (size_t)Record_p->Position, Other_p,
+                        (size_t)Record_p->First, (size_t)Record_p->Count);
+      break;
+    case SLIST_TRACE_COMPACT:
+      SLIST_Compact(List_p);
+      break;
+    default:
+      Replay_p->Skipped++;
+      break;
+  }
+}
+
+// IDXLIST has no sorting, InsertSorted() and Sort() are skipped
+static void
+ApplyIdxlist(SLIST_Replay_t *const Replay_p,
+             IDXLIST_List_t *const List_p,
+             IDXLIST_List_t *const Other_p,
+             const SLIST_TraceRecord_t *const Record_p)
+{
+  void* key_p = (void*)&Record_p->Key;
+
+  switch (Record_p->Operation)
+  {
+    case SLIST_TRACE_INSERT_FIRST:
+      IDXLIST_InsertFirst(List_p, key_p);
+      break;
+    case SLIST_TRACE_INSERT_LAST:
+      IDXLIST_InsertLast(List_p, key_p);
+      break;
+    case SLIST_TRACE_REMOVE_FIRST:
+    case SLIST_TRACE_REMOVE_LAST:
+      if (IDXLIST_IsEmpty(List_p))
+      {
+        Check(Replay_p, NULL, Record_p);
+        break;
+      }
+      Check(Replay_p,
+            (Record_p->Operation == SLIST_TRACE_REMOVE_FIRST) ? IDXLIST_RemoveFirst(List_p)
+                                                              : IDXLIST_RemoveLast(List_p),
+            Record_p);
+      break;
+    case SLIST_TRACE_REMOVE_SPECIFIC:
+      Check(Replay_p, IDXLIST_RemoveSpecific(List_p, key_p), Record_p);
+      break;
+    case SLIST_TRACE_FIND:
+      Check(Replay_p, IDXLIST_Find(List_p, key_p), Record_p);
+      break;
+    case SLIST_TRACE_CONCAT:
+    case SLIST_TRACE_MERGE:
+    case SLIST_TRACE_SPLIT_AT:
+    case SLIST_TRACE_SPLIT_AFTER:
+    case SLIST_TRACE_SPLICE_RANGE:
+      MoveIdxlist(Replay_p, List_p, Other_p, Record_p);
+      break;
+    case SLIST_TRACE_COMPACT:
+      IDXLIST_Compact(List_p);
+      break;
+    default:
+      Replay_p->Skipped++;
+      break;
+  }
+}
+
+// IDXLIST has no operations between lists, so both lists are taken apart and
+// built again, with the elements where the SLIST function puts them
+static void
+MoveIdxlist(SLIST_Replay_t *const Replay_p,
+            IDXLIST_List_t *const List_p,
+            IDXLIST_List_t *const Other_p,
+            const SLIST_TraceRecord_t *const Record_p)
+{
+  size_t count = 0;
+  size_t otherCount = 0;
+  void** elements_pp = Drain(List_p, &count);
+  void** others_pp = (elements_pp != NULL) ? Drain(Other_p, &otherCount) : NULL;
+  if (others_pp == NULL)
+  {
+    if (elements_pp != NULL)
+    {
+      Refill(List_p, elements_pp, 0, count);
+      free(elements_pp);
+    }
+    Replay_p->Skipped++;
+    return;
+  }
+
+  switch (Record_p->Operation)
+  {
+    case SLIST_TRACE_CONCAT:
+      Refill(List_p, elements_pp, 0, count);
+      Refill(List_p, others_pp, 0, otherCount);
+      break;
+    case SLIST_TRACE_MERGE:
+    {
+      // On equal elements those of List_p come first
+      size_t i = 0;
+      size_t j = 0;
+      while (i < count && j < otherCount)
+      {
+        if (CompareKeys(others_pp[j], elements_pp[i]) < 0)
+        {
+          IDXLIST_InsertLast(List_p, others_pp[j++]);
+        }
+        else
+        {
+          IDXLIST_InsertLast(List_p, elements_pp[i++]);
+        }
+      }
+      Refill(List_p, elements_pp, i, count);
+      Refill(List_p, others_pp, j, otherCount);
+      break;
+    }
+    case SLIST_TRACE_SPLIT_AT:
+    case SLIST_TRACE_SPLIT_AFTER:
+    {
+      size_t position = (Record_p->Position < count) ? (size_t)Record_p->Position : count;
+      if (Record_p->Operation == SLIST_TRACE_SPLIT_AFTER)
+      {
+        bool found = false;
+        for (position = 0; position < count && !found; position++)
+        {
+          found = (CompareKeys(elements_pp[position], &Record_p->Key) == 0);
+        }
+        Check(Replay_p, found ? &Record_p->Key : NULL, Record_p);
+      }
+      Refill(List_p, elements_pp, 0, position);
+      Refill(Other_p, others_pp, 0, otherCount);
+      Refill(Other_p, elements_pp, position, count);
+      break;
+    }
+    case SLIST_TRACE_SPLICE_RANGE:
+    {
+      // Other_p is the source; ranges past its end are shortened
+      size_t position = (Record_p->Position < count) ? (size_t)Record_p->Position : count;
+      size_t first = (Record_p->First < otherCount) ? (size_t)Record_p->First : otherCount;
+      size_t end = (Record_p->Count < otherCount - first) ? first + (size_t)Record_p->Count
+                                                           : otherCount;
+      Refill(List_p, elements_pp, 0, position);
+      Refill(List_p, others_pp, first, end);
+      Refill(List_p, elements_pp, position, count);
+      Refill(Other_p, others_pp, 0, first);
+      Refill(Other_p, others_pp, end, otherCount);
+      break;
+    }
+    default:
+      break;
+  }
+  free(elements_pp);
+  free(others_pp);
+}
+
+// Removes all elements of List_p into a new array, in order, or returns NULL
+// and leaves the list as it is if out of memory
+static void**
+Drain(IDXLIST_List_t *const List_p, size_t *const Count_p)
+{
+  size_t count = IDXLIST_Length(List_p);
+  void** elements_pp = malloc((count + 1) * sizeof(void*));
+
+  if (elements_pp != NULL)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      elements_pp[i] = IDXLIST_RemoveFirst(List_p);
+    }
+  }
+  *Count_p = count;
+  return elements_pp;
+}
+
+// Appends the elements from Begin up to End to List_p
+static void
+Refill(IDXLIST_List_t *const List_p, void** const Elements_pp, size_t Begin, size_t End)
+{
+  for (size_t i = Begin; i < End; i++)
+  {
+    IDXLIST_InsertLast(List_p, Elements_pp[i]);
+  }
+}
+
+// Returns true for the operations that record a second list in OtherId
+static bool
+HasOtherList(uint32_t Operation)
+{
+  return (Operation == SLIST_TRACE_CONCAT ||
+          Operation == SLIST_TRACE_MERGE ||
+          Operation == SLIST_TRACE_SPLIT_AT ||
+          Operation == SLIST_TRACE_SPLIT_AFTER ||
+          Operation == SLIST_TRACE_SPLICE_RANGE);
+}
+
+// Returns the list recorded with Id, adding a list that is not live yet if
+// the id is new, or NULL if out of memory. Traces hold few lists, so they are
+// searched linearly.
+static Replayed_t*
+Lookup(SLIST_Replay_t *const Replay_p, uint64_t Id)
+{
+  for (size_t i = 0; i < Replay_p->ListCount; i++)
+  {
+    if (Replay_p->Lists_p[i].Id == Id)
+    {
+      return &Replay_p->Lists_p[i];
+    }
+  }
+
+  if (Replay_p->ListCount == Replay_p->ListCapacity)
+  {
+    size_t capacity = (Replay_p->ListCapacity == 0) ? MIN_LISTS : 2 * Replay_p->ListCapacity;
+    Replayed_t* lists_p = realloc(Replay_p->Lists_p, capacity * sizeof(Replayed_t));
+    if (lists_p == NULL)
+    {
+      return NULL;
+    }
+    Replay_p->Lists_p = lists_p;
+    Replay_p->ListCapacity = capacity;
+  }
+
+  Replayed_t* replayed_p = &Replay_p->Lists_p[Replay_p->ListCount++];
+  replayed_p->Id = Id;
+  replayed_p->Live = false;
+  return replayed_p;
+}
+
+static void
+CreateList(SLIST_Replay_t *const Replay_p, Replayed_t *const Replayed_p)
+{
+  SLIST_List_t* list_p = &Replayed_p->Slist;
+
+  switch (Replay_p->Variant)
+  {
+    case SLIST_REPLAY_POOL:
+      SLIST_CreateWithPool(list_p, 0);
+      break;
+    case SLIST_REPLAY_IDXLIST:
+      IDXLIST_Create(&Replayed_p->Idxlist);
+      IDXLIST_SetCompareFunction(&Replayed_p->Idxlist, CompareKeys);
+      break;
+    default:
+      SLIST_Create(list_p);
+      break;
+  }
+
+  if (Replay_p->Variant != SLIST_REPLAY_IDXLIST)
+  {
+    SLIST_SetCompareFunction(list_p, CompareKeys);
+    SLIST_SetHashFunction(list_p, HashKey);
+    if (Replay_p->Variant == SLIST_REPLAY_INDEXED)
+    {
+      SLIST_CreateIndex(list_p);
+    }
+    else if (Replay_p->Variant == SLIST_REPLAY_MOVE_TO_FRONT)
+    {
+      SLIST_SetFindPolicy(list_p, SLIST_FIND_MOVE_TO_FRONT);
+    }
+    else if (Replay_p->Variant == SLIST_REPLAY_TRANSPOSE)
+    {
+      SLIST_SetFindPolicy(list_p, SLIST_FIND_TRANSPOSE);
+    }
+  }
+  Replayed_p->Live = true;
+}
+
+static void
+DestroyList(SLIST_Replay_t *const Replay_p, Replayed_t *const Replayed_p)
+{
+  if (Replay_p->Variant == SLIST_REPLAY_IDXLIST)
+  {
+    IDXLIST_Destroy(&Replayed_p->Idxlist);
+  }
+  else
+  {
+    SLIST_Destroy(&Replayed_p->Slist);
+  }
+  Replayed_p->Live = false;
+}
+
+// Counts a result that differs from the recorded one; Result_p is NULL if the
+// operation found nothing
+static void
+Check(SLIST_Replay_t *const Replay_p,
+      const void *const Result_p,
+      const SLIST_TraceRecord_t *const Record_p)
+{
+  bool found = (Result_p != NULL);
+  if (found != (Record_p->Found != 0) ||
+      (found && *(const uint64_t*)Result_p != Record_p->Key))
+  {
+    Replay_p->Mismatches++;
+  }
+}
+
+static int
+CompareKeys(const void* const Key1_p, const void* const Key2_p)
+{
+  uint64_t key1 = *(const uint64_t*)Key1_p;
+  uint64_t key2 = *(const uint64_t*)Key2_p;
+  return (key1 > key2) - (key1 < key2);
+}
+
+static size_t
+HashKey(const void* const Key_p)
+{
+  return (size_t)*(const uint64_t*)Key_p;
+}
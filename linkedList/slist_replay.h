@@ -0,0 +1,156 @@
+#ifndef SLIST_REPLAY_H
+#define SLIST_REPLAY_H
+
+/*
+ * Replay of Singly Linked List Traces
+ *
+ * Runs the operations of a trace recorded with SLIST_TraceStart() again on a
+ * chosen list implementation, e.g. to compare variants on a real workload;
+ * the slist_replay tool times it. Every list of the trace is replayed by a
+ * list of its own. The data of the replayed lists are the keys of the
+ * records, referenced in place, so they hold no user payloads and the
+ * records must outlive the replay.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "slist_trace.h"
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// List Implementations a trace can be replayed on
+//
+
+typedef enum SLIST_ReplayVariant
+{
+  SLIST_REPLAY_SLIST,
+  SLIST_REPLAY_POOL,
+  SLIST_REPLAY_INDEXED,
+  SLIST_REPLAY_MOVE_TO_FRONT,
+  SLIST_REPLAY_TRANSPOSE,
+  SLIST_REPLAY_IDXLIST,
+  SLIST_REPLAY_VARIANT_COUNT
+} SLIST_ReplayVariant_t;
+
+
+//
+// Replay Definition
+//
+// Mismatches counts results that differ from the recorded ones, which
+// happens when a variant orders equal keys differently or an operation was
+// skipped; Skipped counts records the variant cannot replay.
+//
+
+typedef struct SLIST_Replay
+{
+  SLIST_ReplayVariant_t  Variant;
+  struct SLIST_Replayed* Lists_p;
+  size_t                 ListCount;
+  size_t                 ListCapacity;
+  size_t                 Mismatches;
+  size_t                 Skipped;
+} SLIST_Replay_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Reads a whole trace file
+ *
+ * Reads all records into one array, so that a replay does no file I/O.
+ *
+ * @param[in]     Path_p   Name of the trace file
+ * @param[out]    Count_p  Receives the number of records
+ * @return        The records, to be freed with free(), or NULL if the file
+ *                cannot be read or memory runs out
+ *
+ ******************************************************************************/
+SLIST_TraceRecord_t*
+SLIST_ReplayLoad(const char *const Path_p, size_t *const Count_p);
+
+
+/**
+ * @brief Creates a replay
+ *
+ * @param[in]     Replay_p  The replay to be initialized
+ * @param[in]     Variant   The list implementation to replay on
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ReplayCreate(SLIST_Replay_t *const Replay_p, SLIST_ReplayVariant_t Variant);
+
+
+/**
+ * @brief Replays one record
+ *
+ * Applies the operation of the record to the list that replays the recorded
+ * list, creating it on first use, and compares the result with the recorded
+ * one. The record must stay valid until SLIST_ReplayFinish().
+ *
+ * @param[in]     Replay_p  Pointer to the replay
+ * @param[in]     Record_p  The record
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ReplayApply(SLIST_Replay_t *const Replay_p, const SLIST_TraceRecord_t *const Record_p);
+
+
+/**
+ * @brief Ends a replay
+ *
+ * Destroys the lists that are left, keeping the counters, so that the same
+ * records can be replayed again from the start.
+ *
+ * @param[in]     Replay_p  Pointer to the replay
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ReplayFinish(SLIST_Replay_t *const Replay_p);
+
+
+/**
+ * @brief Destroys a replay
+ *
+ * Destroys the lists that are left and frees the replay.
+ *
+ * @param[in]     Replay_p  Pointer to the replay
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_ReplayDestroy(SLIST_Replay_t *const Replay_p);
+
+
+/**
+ * @brief Returns the name of a variant
+ *
+ * @param[in]     Variant  The variant
+ * @return        Name of the variant, such as "pool"
+ *
+ ******************************************************************************/
+const char*
+SLIST_ReplayVariantName(SLIST_ReplayVariant_t Variant);
+
+
+#endif // SLIST_REPLAY_H
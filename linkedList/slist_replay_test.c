@@ -0,0 +1,290 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "slist.h"
+#include "slist_trace.h"
+#include "slist_replay.h"
+#include "slist_replay_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define LIST_ID    1
+#define OTHER_ID   2
+#define TRACE_FILE "slist_replay_test.trace"
+#define RECORD(Operation, ListId, Key, Found)                                   \
+  { 0, (Key), (ListId), 0, 0, 0, 0, (Operation), (Found) }
+#define MOVE(Operation, ListId, OtherId, Key, Position, First, Count, Found)   \
+  { 0, (Key), (ListId), (OtherId), (Position), (First), (Count), (Operation), (Found) }
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+// A trace as slist.c records it, with key 0 being found and removed
+static const SLIST_TraceRecord_t Trace[] =
+{
+  RECORD(SLIST_TRACE_CREATE, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 1, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 2, 1),
+  RECORD(SLIST_TRACE_FIND, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_FIND, LIST_ID, 5, 0),
+  RECORD(SLIST_TRACE_REMOVE_SPECIFIC, LIST_ID, 1, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_FIND, LIST_ID, 0, 0),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 2, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 0, 0),
+  RECORD(SLIST_TRACE_INSERT_FIRST, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, OTHER_ID, 3, 1),
+  MOVE(SLIST_TRACE_CONCAT, LIST_ID, OTHER_ID, 0, 0, 0, 0, 1),
+  RECORD(SLIST_TRACE_REMOVE_LAST, LIST_ID, 3, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 4, 1),
+  RECORD(SLIST_TRACE_DESTROY, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_OP_COUNT, LIST_ID, 0, 1)
+};
+
+#define TRACE_LENGTH  (sizeof(Trace) / sizeof(Trace[0]))
+
+// Moves between two lists, with the contents of both after every move
+static const SLIST_TraceRecord_t MoveTrace[] =
+{
+  RECORD(SLIST_TRACE_CREATE, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 1, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 2, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 3, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 4, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 5, 1),
+  RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 6, 1),
+  RECORD(SLIST_TRACE_CREATE, OTHER_ID, 0, 1),
+  // 0 1 2 3 4 | 5 6
+  MOVE(SLIST_TRACE_SPLIT_AT, LIST_ID, OTHER_ID, 0, 5, 0, 0, 1),
+  // 0 1 2 | 5 6 3 4
+  MOVE(SLIST_TRACE_SPLIT_AFTER, LIST_ID, OTHER_ID, 2, 0, 0, 0, 1),
+  MOVE(SLIST_TRACE_SPLIT_AFTER, LIST_ID, OTHER_ID, 9, 0, 0, 0, 0),
+  // 0 3 4 1 2 | 5 6, the range is shortened
+  MOVE(SLIST_TRACE_SPLICE_RANGE, LIST_ID, OTHER_ID, 0, 1, 2, 10, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_REMOVE_LAST, LIST_ID, 2, 1),
+  // 3 4 1 5 | 6, appended
+  MOVE(SLIST_TRACE_SPLICE_RANGE, LIST_ID, OTHER_ID, 0, 99, 0, 1, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 3, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 4, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 1, 1),
+  RECORD(SLIST_TRACE_INSERT_FIRST, OTHER_ID, 2, 1),
+  // 2 5 6 |
+  MOVE(SLIST_TRACE_MERGE, LIST_ID, OTHER_ID, 0, 0, 0, 0, 1),
+  RECORD(SLIST_TRACE_COMPACT, LIST_ID, 0, 1),
+  RECORD(SLIST_TRACE_REMOVE_LAST, OTHER_ID, 0, 0),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 2, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 5, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 6, 1),
+  RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 0, 0),
+  RECORD(SLIST_TRACE_DESTROY, OTHER_ID, 0, 1),
+  RECORD(SLIST_TRACE_DESTROY, LIST_ID, 0, 1)
+};
+
+#define MOVE_TRACE_LENGTH  (sizeof(MoveTrace) / sizeof(MoveTrace[0]))
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestReplayMatchesOnEveryVariant(CuTest* Test_p);
+
+static void
+TestReplayMovesBetweenLists(CuTest* Test_p);
+
+static void
+TestReplayRecordedSplit(CuTest* Test_p);
+
+static void
+TestReplayCountsMismatches(CuTest* Test_p);
+
+static CuSuite*
+Get_SLIST_REPLAY_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_REPLAY_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SLIST_REPLAY_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+TestReplayMatchesOnEveryVariant(CuTest* Test_p)
+{
+  SLIST_Replay_t Replay;
+
+  for (int v = 0; v < SLIST_REPLAY_VARIANT_COUNT; v++)
+  {
+    SLIST_ReplayCreate(&Replay, (SLIST_ReplayVariant_t)v);
+
+    // Twice, as the replay tool does
+    for (int Run = 1; Run <= 2; Run++)
+    {
+      for (size_t i = 0; i < TRACE_LENGTH; i++)
+      {
+        SLIST_ReplayApply(&Replay, &Trace[i]);
+      }
+      SLIST_ReplayFinish(&Replay);
+      CuAssertIntEquals(Test_p, 0, (int)Replay.Mismatches);
+      CuAssertIntEquals(Test_p, Run, (int)Replay.Skipped);
+    }
+    SLIST_ReplayDestroy(&Replay);
+  }
+}
+
+static void
+TestReplayMovesBetweenLists(CuTest* Test_p)
+{
+  SLIST_Replay_t Replay;
+
+  for (int v = 0; v < SLIST_REPLAY_VARIANT_COUNT; v++)
+  {
+    SLIST_ReplayCreate(&Replay, (SLIST_ReplayVariant_t)v);
+    for (size_t i = 0; i < MOVE_TRACE_LENGTH; i++)
+    {
+      SLIST_ReplayApply(&Replay, &MoveTrace[i]);
+    }
+    SLIST_ReplayDestroy(&Replay);
+    CuAssertIntEquals(Test_p, 0, (int)Replay.Mismatches);
+    CuAssertIntEquals(Test_p, 0, (int)Replay.Skipped);
+  }
+}
+
+static size_t
+HashInt(const void* const Data_p)
+{
+  return (size_t)*(const int*)Data_p;
+}
+
+// A split recorded by slist.c, then both halves drained from opposite ends;
+// only run when slist.c is built with SLIST_TRACE
+static void
+TestReplayRecordedSplit(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Rest;
+  SLIST_Replay_t Replay;
+  int Data[10];
+  size_t Count = 0;
+
+  if (!SLIST_TraceStart(TRACE_FILE))
+  {
+    return;
+  }
+  SLIST_Create(&List);
+  SLIST_Create(&Rest);
+  SLIST_SetHashFunction(&List, HashInt);
+  SLIST_SetHashFunction(&Rest, HashInt);
+  for (int i = 0; i < 10; i++)
+  {
+    Data[i] = i;
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+  SLIST_SplitAt(&List, 5, &Rest);
+  while (!SLIST_IsEmpty(&Rest))
+  {
+    SLIST_RemoveFirst(&Rest);
+  }
+  while (!SLIST_IsEmpty(&List))
+  {
+    SLIST_RemoveLast(&List);
+  }
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Rest);
+  SLIST_TraceStop();
+
+  SLIST_TraceRecord_t* Records_p = SLIST_ReplayLoad(TRACE_FILE, &Count);
+  CuAssertPtrNotNull(Test_p, Records_p);
+  CuAssertIntEquals(Test_p, 25, (int)Count);
+  for (int v = 0; v < SLIST_REPLAY_VARIANT_COUNT; v++)
+  {
+    SLIST_ReplayCreate(&Replay, (SLIST_ReplayVariant_t)v);
+    for (size_t i = 0; i < Count; i++)
+    {
+      SLIST_ReplayApply(&Replay, &Records_p[i]);
+    }
+    SLIST_ReplayDestroy(&Replay);
+    CuAssertIntEquals(Test_p, 0, (int)Replay.Mismatches);
+    CuAssertIntEquals(Test_p, 0, (int)Replay.Skipped);
+  }
+  free(Records_p);
+  remove(TRACE_FILE);
+}
+
+static void
+TestReplayCountsMismatches(CuTest* Test_p)
+{
+  SLIST_Replay_t Replay;
+  const SLIST_TraceRecord_t Wrong[] =
+  {
+    RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 0, 1),
+    RECORD(SLIST_TRACE_INSERT_LAST, LIST_ID, 1, 1),
+    RECORD(SLIST_TRACE_FIND, LIST_ID, 7, 1),
+    RECORD(SLIST_TRACE_FIND, LIST_ID, 0, 0),
+    RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 1, 1),
+    RECORD(SLIST_TRACE_REMOVE_FIRST, LIST_ID, 1, 1),
+    RECORD(SLIST_TRACE_REMOVE_LAST, LIST_ID, 1, 1)
+  };
+
+  SLIST_ReplayCreate(&Replay, SLIST_REPLAY_SLIST);
+  for (size_t i = 0; i < sizeof(Wrong) / sizeof(Wrong[0]); i++)
+  {
+    SLIST_ReplayApply(&Replay, &Wrong[i]);
+  }
+  SLIST_ReplayDestroy(&Replay);
+
+  // Not found, found, the wrong key, and nothing left to remove
+  CuAssertIntEquals(Test_p, 4, (int)Replay.Mismatches);
+  CuAssertIntEquals(Test_p, 0, (int)Replay.Skipped);
+}
+
+
+static CuSuite*
+Get_SLIST_REPLAY_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestReplayMatchesOnEveryVariant);
+  SUITE_ADD_TEST(Suite_p, TestReplayMovesBetweenLists);
+  SUITE_ADD_TEST(Suite_p, TestReplayRecordedSplit);
+  SUITE_ADD_TEST(Suite_p, TestReplayCountsMismatches);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef SLIST_REPLAY_TEST_H
+#define SLIST_REPLAY_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_REPLAY_Tests(void);
+
+
+#endif // SLIST_REPLAY_TEST_H
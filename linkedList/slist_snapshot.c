@@ -0,0 +1,304 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include "slist_snapshot.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/* > Defines ******************************************************************/
+
+// Initial size of the buffer handed to the serialize function
+#define SAVE_MIN_BUFFER   256
+
+// Size of the stdio buffer of the file written by SLIST_Save()
+#define SAVE_FILE_BUFFER  (1024 * 1024)
+
+// Number of elements SLIST_Load() passes to SLIST_InsertLastBatch() at once
+#define LOAD_BATCH        1024
+
+#define TEMP_SUFFIX       ".tmp"
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const char Padding[SLIST_SNAPSHOT_ALIGNMENT] = { 0 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static bool
+WriteNodes(const SLIST_List_t *const List_p, FILE* const File_p, DataSerialize_t Serialize_fp,
+           uint64_t* const FileSize_p);
+
+static const SLIST_SnapshotNode_t*
+NodeAt(const SLIST_Snapshot_t *const Snapshot_p, uint64_t Offset);
+
+static uint64_t
+Align(uint64_t Size);
+
+
+/* > Global Function Definitions **********************************************/
+
+bool
+SLIST_Save(const SLIST_List_t *const List_p,
+           const char *const Path_p,
+           DataSerialize_t Serialize_fp)
+{
+  SLIST_SnapshotHeader_t header;
+  size_t pathLength = strlen(Path_p);
+  char* tempPath_p = malloc(pathLength + sizeof(TEMP_SUFFIX));
+  if (tempPath_p == NULL)
+  {
+    return false;
+  }
+  memcpy(tempPath_p, Path_p, pathLength);
+  memcpy(tempPath_p + pathLength, TEMP_SUFFIX, sizeof(TEMP_SUFFIX));
+
+  FILE* file_p = fopen(tempPath_p, "wb");
+  if (file_p == NULL)
+  {
+    free(tempPath_p);
+    return false;
+  }
+  setvbuf(file_p, NULL, _IOFBF, SAVE_FILE_BUFFER);
+
+  // The header is written last, once the size of the file is known
+  memset(&header, 0, sizeof(header));
+  memcpy(header.Magic, SLIST_SNAPSHOT_MAGIC, sizeof(SLIST_SNAPSHOT_MAGIC));
+  header.Version = SLIST_SNAPSHOT_VERSION;
+  header.Alignment = SLIST_SNAPSHOT_ALIGNMENT;
+  header.Length = SLIST_Length(List_p);
+  header.FirstOffset = (header.Length > 0) ? sizeof(header) : 0;
+
+  bool ok = (fwrite(&header, sizeof(header), 1, file_p) == 1) &&
+            WriteNodes(List_p, file_p, Serialize_fp, &header.FileSize) &&
+            fseek(file_p, 0, SEEK_SET) == 0 &&
+            fwrite(&header, sizeof(header), 1, file_p) == 1 &&
+            fflush(file_p) == 0 &&
+            fsync(fileno(file_p)) == 0;
+  ok = (fclose(file_p) == 0) && ok;
+  ok = ok && (rename(tempPath_p, Path_p) == 0);
+  if (!ok)
+  {
+    remove(tempPath_p);
+  }
+  free(tempPath_p);
+  return ok;
+}
+
+bool
+SLIST_SnapshotOpen(SLIST_Snapshot_t *const Snapshot_p, const char *const Path_p)
+{
+  struct stat status;
+
+  Snapshot_p->Base_p = NULL;
+  Snapshot_p->Size = 0;
+  Snapshot_p->Header_p = NULL;
+
+  int fd = open(Path_p, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(SLIST_SnapshotHeader_t))
+  {
+    close(fd);
+    return false;
+  }
+
+  // The mapping stays valid after the descriptor is closed
+  void* base_p = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base_p == MAP_FAILED)
+  {
+    return false;
+  }
+  Snapshot_p->Base_p = base_p;
+  Snapshot_p->Size = (size_t)status.st_size;
+  Snapshot_p->Header_p = base_p;
+
+  const SLIST_SnapshotHeader_t* header_p = Snapshot_p->Header_p;
+  if (memcmp(header_p->Magic, SLIST_SNAPSHOT_MAGIC, sizeof(SLIST_SNAPSHOT_MAGIC)) != 0 ||
+      header_p->Version != SLIST_SNAPSHOT_VERSION ||
+      header_p->Alignment != SLIST_SNAPSHOT_ALIGNMENT ||
+      header_p->FileSize != Snapshot_p->Size ||
+      (header_p->Length > 0) != (NodeAt(Snapshot_p, header_p->FirstOffset) != NULL))
+  {
+    SLIST_SnapshotClose(Snapshot_p);
+    return false;
+  }
+  return true;
+}
+
+void
+SLIST_SnapshotClose(SLIST_Snapshot_t *const Snapshot_p)
+{
+  if (Snapshot_p->Base_p != NULL)
+  {
+    munmap((void*)Snapshot_p->Base_p, Snapshot_p->Size);
+  }
+  Snapshot_p->Base_p = NULL;
+  Snapshot_p->Size = 0;
+  Snapshot_p->Header_p = NULL;
+}
+
+size_t
+SLIST_SnapshotLength(const SLIST_Snapshot_t *const Snapshot_p)
+{
+  return (size_t)Snapshot_p->Header_p->Length;
+}
+
+const SLIST_SnapshotNode_t*
+SLIST_SnapshotFirst(const SLIST_Snapshot_t *const Snapshot_p)
+{
+  return NodeAt(Snapshot_p, Snapshot_p->Header_p->FirstOffset);
+}
+
+// Records are written in list order, so a link always leads past the end of
+// its own record; any other link would let a corrupt file loop forever
+const SLIST_SnapshotNode_t*
+SLIST_SnapshotNext(const SLIST_Snapshot_t *const Snapshot_p,
+                   const SLIST_SnapshotNode_t *const Node_p)
+{
+  uint64_t end = (uint64_t)((const char*)(Node_p + 1) - Snapshot_p->Base_p) + Node_p->Size;
+  if (Node_p->NextOffset < end)
+  {
+    return NULL;
+  }
+  return NodeAt(Snapshot_p, Node_p->NextOffset);
+}
+
+const void*
+SLIST_SnapshotData(const SLIST_SnapshotNode_t *const Node_p)
+{
+  return Node_p + 1;
+}
+
+// The elements are collected in a list sharing the allocation of List_p and
+// appended in O(1) only once the whole file has been read, so that a corrupt
+// file leaves List_p unchanged
+bool
+SLIST_Load(SLIST_List_t *const List_p, const SLIST_Snapshot_t *const Snapshot_p)
+{
+  SLIST_List_t loaded;
+  void* batch_pp[LOAD_BATCH];
+  size_t count = 0;
+  uint64_t visited = 0;
+  uint64_t length = Snapshot_p->Header_p->Length;
+  const SLIST_SnapshotNode_t* last_p = NULL;
+
+  SLIST_CreateWithSharedPool(&loaded, List_p);
+  for (const SLIST_SnapshotNode_t* node_p = SLIST_SnapshotFirst(Snapshot_p);
+       node_p != NULL && visited < length;
+       node_p = SLIST_SnapshotNext(Snapshot_p, node_p))
+  {
+    batch_pp[count++] = (void*)SLIST_SnapshotData(node_p);
+    visited++;
+    last_p = node_p;
+    if (count == LOAD_BATCH)
+    {
+      SLIST_InsertLastBatch(&loaded, batch_pp, count);
+      count = 0;
+    }
+  }
+  SLIST_InsertLastBatch(&loaded, batch_pp, count);
+
+  // The records must end exactly where the header says
+  if (visited != length || (last_p != NULL && last_p->NextOffset != 0))
+  {
+    SLIST_Destroy(&loaded);
+    return false;
+  }
+  SLIST_Concat(List_p, &loaded);
+  SLIST_Destroy(&loaded);
+  return true;
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Writes one record per element after the header, each linked to the one
+// written after it, and returns the size of the file in FileSize_p
+static bool
+WriteNodes(const SLIST_List_t *const List_p, FILE* const File_p, DataSerialize_t Serialize_fp,
+           uint64_t* const FileSize_p)
+{
+  uint64_t offset = sizeof(SLIST_SnapshotHeader_t);
+  size_t capacity = SAVE_MIN_BUFFER;
+  char* buffer_p = malloc(capacity);
+  bool ok = (buffer_p != NULL);
+
+  for (const SLIST_Node_t* node_p = List_p->Head_p; ok && node_p != NULL; node_p = node_p->Next_p)
+  {
+    size_t size = Serialize_fp(node_p->Data_p, buffer_p, capacity);
+    if (size > capacity)
+    {
+      char* grown_p = realloc(buffer_p, size);
+      if (grown_p == NULL)
+      {
+        ok = false;
+        break;
+      }
+      buffer_p = grown_p;
+      capacity = size;
+      size = Serialize_fp(node_p->Data_p, buffer_p, capacity);
+    }
+
+    SLIST_SnapshotNode_t record;
+    uint64_t recordSize = sizeof(record) + Align(size);
+    record.NextOffset = (node_p->Next_p != NULL) ? offset + recordSize : 0;
+    record.Size = size;
+    ok = fwrite(&record, sizeof(record), 1, File_p) == 1 &&
+         fwrite(buffer_p, 1, size, File_p) == size &&
+         fwrite(Padding, 1, Align(size) - size, File_p) == Align(size) - size;
+    offset += recordSize;
+  }
+
+  free(buffer_p);
+  *FileSize_p = offset;
+  return ok;
+}
+
+// Returns the record at Offset, or NULL for offset 0 or a record that does
+// not lie entirely within the file
+static const SLIST_SnapshotNode_t*
+NodeAt(const SLIST_Snapshot_t *const Snapshot_p, uint64_t Offset)
+{
+  if (Offset < sizeof(SLIST_SnapshotHeader_t) ||
+      Offset % SLIST_SNAPSHOT_ALIGNMENT != 0 ||
+      Offset > Snapshot_p->Size - sizeof(SLIST_SnapshotNode_t))
+  {
+    return NULL;
+  }
+
+  const SLIST_SnapshotNode_t* node_p = (const SLIST_SnapshotNode_t*)(Snapshot_p->Base_p + Offset);
+  if (node_p->Size > Snapshot_p->Size - Offset - sizeof(SLIST_SnapshotNode_t))
+  {
+    return NULL;
+  }
+  return node_p;
+}
+
+static uint64_t
+Align(uint64_t Size)
+{
+  return (Size + SLIST_SNAPSHOT_ALIGNMENT - 1) & ~(uint64_t)(SLIST_SNAPSHOT_ALIGNMENT - 1);
+}
@@ -0,0 +1,233 @@
+#ifndef SLIST_SNAPSHOT_H
+#define SLIST_SNAPSHOT_H
+
+/*
+ * Snapshot Files of Singly Linked Lists
+ *
+ * SLIST_Save() writes the elements of a list, serialized by a callback, to a
+ * flat file in which every node record is linked to the next by its offset
+ * in the file. SLIST_SnapshotOpen() maps such a file read-only in O(1); its
+ * elements are then visited in place, without copying or allocating anything
+ * per node, and SLIST_Load() turns them into a list whose data points into
+ * the mapping.
+ *
+ * The file starts with a SLIST_SnapshotHeader_t, followed by one
+ * SLIST_SnapshotNode_t per element, each directly followed by its payload,
+ * in the byte order of the writing machine. Records start at multiples of
+ * SLIST_SNAPSHOT_ALIGNMENT bytes, so payloads are aligned as well.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SLIST_SNAPSHOT_MAGIC      "SLSNAP"
+#define SLIST_SNAPSHOT_VERSION    1
+#define SLIST_SNAPSHOT_ALIGNMENT  8
+
+//
+// Visits every element of an open snapshot in order, with Variable set to a
+// const pointer to its payload. Nothing is copied; the payload stays valid
+// until the snapshot is closed.
+//
+//   const int* Number_p;
+//   SLIST_SNAPSHOT_FOREACH(Number_p, &Snapshot)
+//   {
+//     printf("%d\n", *Number_p);
+//   }
+//
+#define SLIST_SNAPSHOT_FOREACH(Variable, Snapshot_p)                            \
+  for (const SLIST_SnapshotNode_t* Variable##_Node_p = SLIST_SnapshotFirst(Snapshot_p); \
+       Variable##_Node_p != NULL &&                                             \
+       ((Variable) = (const void*)(Variable##_Node_p + 1), 1);                  \
+       Variable##_Node_p = SLIST_SnapshotNext((Snapshot_p), Variable##_Node_p))
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Serialize Function
+//
+// Writes the payload of Data_p to Buffer_p, which holds Size bytes, and
+// returns the length of the payload. If the payload needs more than Size
+// bytes it returns the length without writing, and is called again with a
+// buffer that large.
+//
+
+typedef size_t (*DataSerialize_t)(const void* const Data_p, void* const Buffer_p, size_t Size);
+
+
+//
+// File Format, offset 0 stands for no node
+//
+
+typedef struct SLIST_SnapshotHeader
+{
+  char     Magic[8];
+  uint32_t Version;
+  uint32_t Alignment;
+  uint64_t Length;
+  uint64_t FirstOffset;
+  uint64_t FileSize;
+} SLIST_SnapshotHeader_t;
+
+typedef struct SLIST_SnapshotNode
+{
+  uint64_t NextOffset;
+  uint64_t Size;
+} SLIST_SnapshotNode_t;
+
+
+//
+// Open Snapshot
+//
+
+typedef struct SLIST_Snapshot
+{
+  const char*                   Base_p;
+  size_t                        Size;
+  const SLIST_SnapshotHeader_t* Header_p;
+} SLIST_Snapshot_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Saves a list to a snapshot file
+ *
+ * Serializes every element of the list with Serialize_fp into a new file,
+ * which replaces Path_p only when it is complete, so an existing snapshot is
+ * never left half written. The list is not modified.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     Path_p        Name of the snapshot file
+ * @param[in]     Serialize_fp  Writes the payload of an element
+ * @return        false if the file cannot be written or memory runs out
+ *
+ ******************************************************************************/
+bool
+SLIST_Save(const SLIST_List_t *const List_p,
+           const char *const Path_p,
+           DataSerialize_t Serialize_fp);
+
+
+/**
+ * @brief Opens a snapshot file
+ *
+ * Maps the file read-only and checks its header, in O(1) for any number of
+ * elements. Pages of the file are read by the system when they are first
+ * visited. The links of the records are checked as they are followed.
+ *
+ * @param[in]     Snapshot_p  The snapshot to be initialized
+ * @param[in]     Path_p      Name of the snapshot file
+ * @return        false if the file cannot be mapped or is not a snapshot of
+ *                this version
+ *
+ ******************************************************************************/
+bool
+SLIST_SnapshotOpen(SLIST_Snapshot_t *const Snapshot_p, const char *const Path_p);
+
+
+/**
+ * @brief Closes a snapshot file
+ *
+ * Unmaps the file. Payloads of the snapshot, also those in lists filled by
+ * SLIST_Load(), must not be used afterwards.
+ *
+ * @param[in]     Snapshot_p  An open snapshot
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_SnapshotClose(SLIST_Snapshot_t *const Snapshot_p);
+
+
+/**
+ * @brief Returns the number of elements in a snapshot
+ *
+ * @param[in]     Snapshot_p  An open snapshot
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+SLIST_SnapshotLength(const SLIST_Snapshot_t *const Snapshot_p);
+
+
+/**
+ * @brief Returns the first node record of a snapshot
+ *
+ * The payload of a record directly follows it, see SLIST_SnapshotData().
+ *
+ * @param[in]     Snapshot_p  An open snapshot
+ * @return        The first record, or NULL if the snapshot is empty
+ *
+ ******************************************************************************/
+const SLIST_SnapshotNode_t*
+SLIST_SnapshotFirst(const SLIST_Snapshot_t *const Snapshot_p);
+
+
+/**
+ * @brief Returns the next node record of a snapshot
+ *
+ * @param[in]     Snapshot_p  An open snapshot
+ * @param[in]     Node_p      A record of the snapshot
+ * @return        The following record, or NULL after the last one or if the
+ *                link leads outside of the file or does not lead forward
+ *
+ ******************************************************************************/
+const SLIST_SnapshotNode_t*
+SLIST_SnapshotNext(const SLIST_Snapshot_t *const Snapshot_p,
+                   const SLIST_SnapshotNode_t *const Node_p);
+
+
+/**
+ * @brief Returns the payload of a node record
+ *
+ * @param[in]     Node_p  A record of an open snapshot
+ * @return        Pointer to the Node_p->Size bytes of the payload in the
+ *                mapping
+ *
+ ******************************************************************************/
+const void*
+SLIST_SnapshotData(const SLIST_SnapshotNode_t *const Node_p);
+
+
+/**
+ * @brief Loads the elements of a snapshot into a list
+ *
+ * Appends the payload of every element of the snapshot to List_p, in order,
+ * as data pointing into the mapping. No payload is copied; nodes are added
+ * in batches, see SLIST_InsertLastBatch(), so a list with a node pool takes
+ * them from few large slabs. The list must not destroy or modify the data of
+ * these elements, and must not use them after SLIST_SnapshotClose().
+ * Nothing is appended unless the records of the file link up to exactly the
+ * number of elements in its header.
+ *
+ * @param[in]     List_p      Pointer to the list
+ * @param[in]     Snapshot_p  An open snapshot
+ * @return        false if the file is corrupt, in which case the list is
+ *                unchanged
+ *
+ ******************************************************************************/
+bool
+SLIST_Load(SLIST_List_t *const List_p, const SLIST_Snapshot_t *const Snapshot_p);
+
+
+#endif // SLIST_SNAPSHOT_H
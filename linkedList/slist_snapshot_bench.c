@@ -0,0 +1,136 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "slist_snapshot.h"
+#include "slist_snapshot_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SNAPSHOT_FILE  "slist_snapshot_bench.snap"
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const size_t ListSizes[] = { 1000000, 10000000 };
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+BenchSnapshot(size_t Size);
+
+static size_t
+SerializeLong(const void* const Data_p, void* const Buffer_p, size_t Size);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_SNAPSHOT_Benchmarks(void)
+{
+  printf("Snapshot files: rebuilding a list vs saving, mapping and loading it\n");
+  for (size_t i = 0; i < sizeof(ListSizes) / sizeof(ListSizes[0]); i++)
+  {
+    BenchSnapshot(ListSizes[i]);
+  }
+  remove(SNAPSHOT_FILE);
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Builds a list of Size malloc'ed longs as a cold start would, saves it, and
+// restarts from the file: mapping it, visiting it in place and loading it
+// into a pooled list. The file is still in the page cache, so the restart is
+// a warm one.
+static void
+BenchSnapshot(size_t Size)
+{
+  SLIST_List_t List;
+  SLIST_Snapshot_t Snapshot;
+  char Name[64];
+  volatile long Sink;
+
+  SLIST_Create(&List);
+  SLIST_SetDestroyFunction(&List, free);
+  uint64_t Start = BENCH_Now();
+  for (size_t i = 0; i < Size; i++)
+  {
+    long* Number_p = malloc(sizeof(long));
+    *Number_p = (long)i;
+    SLIST_InsertLast(&List, Number_p);
+  }
+  uint64_t Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Rebuild/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Start = BENCH_Now();
+  bool Saved = SLIST_Save(&List, SNAPSHOT_FILE, SerializeLong);
+  Elapsed = BENCH_Now() - Start;
+  SLIST_Destroy(&List);
+  if (!Saved)
+  {
+    printf("Cannot save %s\n", SNAPSHOT_FILE);
+    return;
+  }
+  snprintf(Name, sizeof(Name), "Save/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Start = BENCH_Now();
+  SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE);
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Open/N=%zu", Size);
+  BENCH_Report(Name, 1, Elapsed);
+
+  Start = BENCH_Now();
+  long Sum = 0;
+  const long* Number_p;
+  SLIST_SNAPSHOT_FOREACH(Number_p, &Snapshot)
+  {
+    Sum += *Number_p;
+  }
+  Sink = Sum;
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Traverse/N=%zu", Size);
+  BENCH_Report(Name, Size, Elapsed);
+
+  Start = BENCH_Now();
+  SLIST_CreateWithPool(&List, Size);
+  bool Loaded = SLIST_Load(&List, &Snapshot);
+  Elapsed = BENCH_Now() - Start;
+  snprintf(Name, sizeof(Name), "Load/pool/N=%zu", Size);
+  BENCH_Report(Name, Loaded ? Size : 0, Elapsed);
+
+  (void)Sink;
+  SLIST_Destroy(&List);
+  SLIST_SnapshotClose(&Snapshot);
+}
+
+static size_t
+SerializeLong(const void* const Data_p, void* const Buffer_p, size_t Size)
+{
+  if (Size >= sizeof(long))
+  {
+    memcpy(Buffer_p, Data_p, sizeof(long));
+  }
+  return sizeof(long);
+}
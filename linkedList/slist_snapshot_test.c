@@ -0,0 +1,391 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "slist.h"
+#include "slist_snapshot.h"
+#include "slist_snapshot_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SNAPSHOT_FILE  "slist_snapshot_test.snap"
+#define TEST_ELEMENTS  100
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static int Numbers[TEST_ELEMENTS];
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestSaveAndForeach(CuTest* Test_p);
+
+static void
+TestLoad(CuTest* Test_p);
+
+static void
+TestLargePayloads(CuTest* Test_p);
+
+static void
+TestEmptyList(CuTest* Test_p);
+
+static void
+TestOpenRejectsBadFiles(CuTest* Test_p);
+
+static void
+TestBadLinksEndTraversal(CuTest* Test_p);
+
+static CuSuite*
+Get_SLIST_SNAPSHOT_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_SNAPSHOT_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SLIST_SNAPSHOT_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static size_t
+SerializeInt(const void* const Data_p, void* const Buffer_p, size_t Size)
+{
+  if (Size >= sizeof(int))
+  {
+    memcpy(Buffer_p, Data_p, sizeof(int));
+  }
+  return sizeof(int);
+}
+
+static size_t
+SerializeString(const void* const Data_p, void* const Buffer_p, size_t Size)
+{
+  size_t Length = strlen(Data_p) + 1;
+  if (Size >= Length)
+  {
+    memcpy(Buffer_p, Data_p, Length);
+  }
+  return Length;
+}
+
+// Saves a list of 0 .. TEST_ELEMENTS-1
+static void
+SaveNumbers(CuTest* Test_p)
+{
+  SLIST_List_t List;
+
+  SLIST_Create(&List);
+  for (int i = 0; i < TEST_ELEMENTS; i++)
+  {
+    Numbers[i] = i;
+    SLIST_InsertLast(&List, &Numbers[i]);
+  }
+  CuAssertTrue(Test_p, SLIST_Save(&List, SNAPSHOT_FILE, SerializeInt));
+  SLIST_Destroy(&List);
+}
+
+static void
+TestSaveAndForeach(CuTest* Test_p)
+{
+  SLIST_Snapshot_t Snapshot;
+  const int* Number_p;
+  int Expected = 0;
+
+  SaveNumbers(Test_p);
+  CuAssertTrue(Test_p, SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)SLIST_SnapshotLength(&Snapshot));
+
+  SLIST_SNAPSHOT_FOREACH(Number_p, &Snapshot)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+
+  const SLIST_SnapshotNode_t* Node_p = SLIST_SnapshotFirst(&Snapshot);
+  CuAssertIntEquals(Test_p, (int)sizeof(int), (int)Node_p->Size);
+  CuAssertIntEquals(Test_p, 0, *(const int*)SLIST_SnapshotData(Node_p));
+
+  SLIST_SnapshotClose(&Snapshot);
+  CuAssertPtrEquals(Test_p, NULL, (void*)Snapshot.Base_p);
+  remove(SNAPSHOT_FILE);
+}
+
+static void
+TestLoad(CuTest* Test_p)
+{
+  SLIST_Snapshot_t Snapshot;
+  SLIST_List_t List;
+  int* Number_p;
+  int Expected = 0;
+
+  SaveNumbers(Test_p);
+  CuAssertTrue(Test_p, SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+
+  SLIST_CreateWithPool(&List, 0);
+  CuAssertTrue(Test_p, SLIST_Load(&List, &Snapshot));
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, (int)SLIST_Length(&List));
+
+  // The data lives in the mapping, not in a copy
+  SLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    CuAssertTrue(Test_p, (const char*)Number_p > Snapshot.Base_p &&
+                         (const char*)Number_p < Snapshot.Base_p + Snapshot.Size);
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, TEST_ELEMENTS, Expected);
+
+  // The loaded list is an ordinary list
+  SLIST_RemoveFirst(&List);
+  SLIST_InsertLast(&List, &Numbers[0]);
+  CuAssertPtrEquals(Test_p, &Numbers[0], List.Tail_p->Data_p);
+
+  SLIST_Destroy(&List);
+  SLIST_SnapshotClose(&Snapshot);
+  remove(SNAPSHOT_FILE);
+}
+
+// Payloads larger than the first serialize buffer, of odd sizes, stay aligned
+static void
+TestLargePayloads(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_Snapshot_t Snapshot;
+  char* Strings[3];
+  size_t Lengths[3] = { 5, 1000, 13 };
+  const char* String_p;
+  int i = 0;
+
+  SLIST_Create(&List);
+  for (int s = 0; s < 3; s++)
+  {
+    Strings[s] = malloc(Lengths[s] + 1);
+    memset(Strings[s], 'a' + s, Lengths[s]);
+    Strings[s][Lengths[s]] = '\0';
+    SLIST_InsertLast(&List, Strings[s]);
+  }
+  CuAssertTrue(Test_p, SLIST_Save(&List, SNAPSHOT_FILE, SerializeString));
+
+  CuAssertTrue(Test_p, SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+  SLIST_SNAPSHOT_FOREACH(String_p, &Snapshot)
+  {
+    CuAssertStrEquals(Test_p, Strings[i], String_p);
+    CuAssertTrue(Test_p, (uintptr_t)String_p % SLIST_SNAPSHOT_ALIGNMENT == 0);
+    i++;
+  }
+  CuAssertIntEquals(Test_p, 3, i);
+  SLIST_SnapshotClose(&Snapshot);
+
+  for (int s = 0; s < 3; s++)
+  {
+    free(Strings[s]);
+  }
+  SLIST_Destroy(&List);
+  remove(SNAPSHOT_FILE);
+}
+
+static void
+TestEmptyList(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_Snapshot_t Snapshot;
+
+  SLIST_Create(&List);
+  CuAssertTrue(Test_p, SLIST_Save(&List, SNAPSHOT_FILE, SerializeInt));
+  CuAssertTrue(Test_p, SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+  CuAssertIntEquals(Test_p, 0, (int)SLIST_SnapshotLength(&Snapshot));
+  CuAssertPtrEquals(Test_p, NULL, (void*)SLIST_SnapshotFirst(&Snapshot));
+  CuAssertTrue(Test_p, SLIST_Load(&List, &Snapshot));
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&List));
+
+  SLIST_SnapshotClose(&Snapshot);
+  SLIST_Destroy(&List);
+  remove(SNAPSHOT_FILE);
+}
+
+static void
+TestOpenRejectsBadFiles(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_Snapshot_t Snapshot;
+  char Contents[4096];
+
+  SLIST_Create(&List);
+  CuAssertTrue(Test_p, !SLIST_Save(&List, "no/such/" SNAPSHOT_FILE, SerializeInt));
+  SLIST_Destroy(&List);
+  CuAssertTrue(Test_p, !SLIST_SnapshotOpen(&Snapshot, "no/such/" SNAPSHOT_FILE));
+
+  // A truncated file no longer matches the size in its header
+  SaveNumbers(Test_p);
+  FILE* File_p = fopen(SNAPSHOT_FILE, "rb");
+  size_t Size = fread(Contents, 1, sizeof(Contents), File_p);
+  fclose(File_p);
+  File_p = fopen(SNAPSHOT_FILE, "wb");
+  fwrite(Contents, 1, Size - 8, File_p);
+  fclose(File_p);
+  CuAssertTrue(Test_p, !SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+  CuAssertPtrEquals(Test_p, NULL, (void*)Snapshot.Base_p);
+
+  // A link leading out of the file ends the traversal
+  SLIST_SnapshotNode_t* First_p = (SLIST_SnapshotNode_t*)(Contents + sizeof(SLIST_SnapshotHeader_t));
+  First_p->NextOffset = Size;
+  File_p = fopen(SNAPSHOT_FILE, "wb");
+  fwrite(Contents, 1, Size, File_p);
+  fclose(File_p);
+  CuAssertTrue(Test_p, SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+  CuAssertPtrNotNull(Test_p, (void*)SLIST_SnapshotFirst(&Snapshot));
+  CuAssertPtrEquals(Test_p, NULL,
+                    (void*)SLIST_SnapshotNext(&Snapshot, SLIST_SnapshotFirst(&Snapshot)));
+  SLIST_SnapshotClose(&Snapshot);
+
+  memset(Contents, 'x', sizeof(SLIST_SnapshotHeader_t));
+  File_p = fopen(SNAPSHOT_FILE, "wb");
+  fwrite(Contents, 1, Size, File_p);
+  fclose(File_p);
+  CuAssertTrue(Test_p, !SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+  remove(SNAPSHOT_FILE);
+}
+
+// Saves the two elements Numbers[0] and Numbers[1], applies Patch_fp to the
+// records and writes the file back
+static void
+SavePatched(CuTest* Test_p, void (*Patch_fp)(SLIST_SnapshotNode_t*, SLIST_SnapshotNode_t*))
+{
+  SLIST_List_t List;
+  char Contents[256];
+
+  SLIST_Create(&List);
+  SLIST_InsertLast(&List, &Numbers[0]);
+  SLIST_InsertLast(&List, &Numbers[1]);
+  CuAssertTrue(Test_p, SLIST_Save(&List, SNAPSHOT_FILE, SerializeInt));
+  SLIST_Destroy(&List);
+
+  FILE* File_p = fopen(SNAPSHOT_FILE, "rb");
+  size_t Size = fread(Contents, 1, sizeof(Contents), File_p);
+  fclose(File_p);
+
+  SLIST_SnapshotNode_t* First_p = (SLIST_SnapshotNode_t*)(Contents + sizeof(SLIST_SnapshotHeader_t));
+  SLIST_SnapshotNode_t* Second_p = (SLIST_SnapshotNode_t*)(Contents + First_p->NextOffset);
+  Patch_fp(First_p, Second_p);
+
+  File_p = fopen(SNAPSHOT_FILE, "wb");
+  fwrite(Contents, 1, Size, File_p);
+  fclose(File_p);
+}
+
+static void
+LinkBackToFirst(SLIST_SnapshotNode_t* First_p, SLIST_SnapshotNode_t* Second_p)
+{
+  Second_p->NextOffset = sizeof(SLIST_SnapshotHeader_t);
+}
+
+static void
+LinkToItself(SLIST_SnapshotNode_t* First_p, SLIST_SnapshotNode_t* Second_p)
+{
+  First_p->NextOffset = sizeof(SLIST_SnapshotHeader_t);
+}
+
+static void
+CutAfterFirst(SLIST_SnapshotNode_t* First_p, SLIST_SnapshotNode_t* Second_p)
+{
+  First_p->NextOffset = 0;
+}
+
+// Visits the records of the file, giving up after a few more than it holds
+static int
+CountRecords(const SLIST_Snapshot_t *const Snapshot_p)
+{
+  const int* Number_p;
+  int Count = 0;
+
+  SLIST_SNAPSHOT_FOREACH(Number_p, Snapshot_p)
+  {
+    (void)Number_p;
+    if (++Count > 10)
+    {
+      break;
+    }
+  }
+  return Count;
+}
+
+// Links that lead backwards end a traversal, and SLIST_Load() fails on them
+// and on a chain shorter than the header says, leaving the list unchanged
+static void
+TestBadLinksEndTraversal(CuTest* Test_p)
+{
+  SLIST_Snapshot_t Snapshot;
+  SLIST_List_t List;
+  void (*Patches[])(SLIST_SnapshotNode_t*, SLIST_SnapshotNode_t*) =
+  {
+    LinkBackToFirst, LinkToItself, CutAfterFirst
+  };
+  int Expected[] = { 2, 1, 1 };
+
+  for (int p = 0; p < 3; p++)
+  {
+    SavePatched(Test_p, Patches[p]);
+    CuAssertTrue(Test_p, SLIST_SnapshotOpen(&Snapshot, SNAPSHOT_FILE));
+    CuAssertIntEquals(Test_p, 2, (int)SLIST_SnapshotLength(&Snapshot));
+    CuAssertIntEquals(Test_p, Expected[p], CountRecords(&Snapshot));
+
+    SLIST_CreateWithPool(&List, 0);
+    SLIST_InsertLast(&List, &Numbers[5]);
+    CuAssertTrue(Test_p, !SLIST_Load(&List, &Snapshot));
+    CuAssertIntEquals(Test_p, 1, (int)SLIST_Length(&List));
+    CuAssertPtrEquals(Test_p, &Numbers[5], List.Tail_p->Data_p);
+    SLIST_Destroy(&List);
+    SLIST_SnapshotClose(&Snapshot);
+  }
+  remove(SNAPSHOT_FILE);
+}
+
+
+static CuSuite*
+Get_SLIST_SNAPSHOT_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestSaveAndForeach);
+  SUITE_ADD_TEST(Suite_p, TestLoad);
+  SUITE_ADD_TEST(Suite_p, TestLargePayloads);
+  SUITE_ADD_TEST(Suite_p, TestEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestOpenRejectsBadFiles);
+  SUITE_ADD_TEST(Suite_p, TestBadLinksEndTraversal);
+
+  return Suite_p;
+}
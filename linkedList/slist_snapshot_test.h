@@ -0,0 +1,26 @@
+#ifndef SLIST_SNAPSHOT_TEST_H
+#define SLIST_SNAPSHOT_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_SNAPSHOT_Tests(void);
+
+
+#endif // SLIST_SNAPSHOT_TEST_H
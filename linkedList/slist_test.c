@@ -50,6 +50,96 @@ TestRemoveSpecific(CuTest* Test_p);
 static void
 TestIterator(CuTest* Test_p);
 
+static void
+TestCursor(CuTest* Test_p);
+
+static void
+TestForeach(CuTest* Test_p);
+
+static void
+TestPoolInsertRemove(CuTest* Test_p);
+
+static void
+TestPoolRecyclesNodes(CuTest* Test_p);
+
+static void
+TestDestroyPoolCallsDestroyFunction(CuTest* Test_p);
+
+static void
+TestStats(CuTest* Test_p);
+
+static void
+TestFind(CuTest* Test_p);
+
+static void
+TestIndexKeepsOrder(CuTest* Test_p);
+
+static void
+TestIndexDuplicates(CuTest* Test_p);
+
+static void
+TestIndexGrows(CuTest* Test_p);
+
+static void
+TestSort(CuTest* Test_p);
+
+static void
+TestSortIsStable(CuTest* Test_p);
+
+static void
+TestSortKeepsIndex(CuTest* Test_p);
+
+static void
+TestInsertSorted(CuTest* Test_p);
+
+static void
+TestMerge(CuTest* Test_p);
+
+static void
+TestMergePooled(CuTest* Test_p);
+
+static void
+TestSharedPool(CuTest* Test_p);
+
+static void
+TestConcat(CuTest* Test_p);
+
+static void
+TestConcatIndexed(CuTest* Test_p);
+
+static void
+TestSplitAt(CuTest* Test_p);
+
+static void
+TestSplitAfter(CuTest* Test_p);
+
+static void
+TestSpliceRange(CuTest* Test_p);
+
+static void
+TestInsertLastBatch(CuTest* Test_p);
+
+static void
+TestRemoveFirstBatch(CuTest* Test_p);
+
+static void
+TestFindMoveToFront(CuTest* Test_p);
+
+static void
+TestFindTranspose(CuTest* Test_p);
+
+static void
+TestCompact(CuTest* Test_p);
+
+static void
+TestCompactSharedPool(CuTest* Test_p);
+
+static void
+TestProfile(CuTest* Test_p);
+
+static void
+TestHistogramPercentile(CuTest* Test_p);
+
 static CuSuite*
 Get_SLIST_Suite(void);
 
@@ -273,6 +363,15 @@ DataCompare(const void* const Data1_p, const void* const Data2_p)
 }
 
 
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+
 static void
 TestRemoveSpecific(CuTest* Test_p)
 {
@@ -303,16 +402,19 @@ TestRemoveSpecific(CuTest* Test_p)
   char* Two_p = SLIST_RemoveSpecific(&List, "Two");
   CuAssertStrEquals(Test_p, "Two", Two_p);
   CuAssertTrue(Test_p, SLIST_Length(&List) == 2);
+  free(Two_p);
 
   // Last item
   char* Three_p = SLIST_RemoveSpecific(&List, "Three");
   CuAssertStrEquals(Test_p, "Three", Three_p);
   CuAssertTrue(Test_p, SLIST_Length(&List) == 1);
+  free(Three_p);
 
   // First item
   char* One_p = SLIST_RemoveSpecific(&List, "One");
   CuAssertStrEquals(Test_p, "One", One_p);
   CuAssertTrue(Test_p, SLIST_Length(&List) == 0);
+  free(One_p);
 
   SLIST_Destroy(&List);
 }
@@ -347,12 +449,1121 @@ TestIterator(CuTest* Test_p)
     CuAssertIntEquals(Test_p, Expected, Number);
     Expected--;
   }
+  CuAssertIntEquals(Test_p, 0, Expected);
 
+  // Iterating leaves the list untouched
   ITERATOR_Destroy(&It_p);
+  CuAssertPtrEquals(Test_p, NULL, It_p);
+  CuAssertIntEquals(Test_p, 3, *(int*)List.Head_p->Data_p);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == 3);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestCursor(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_Iterator_t It;
+  SLIST_Iterator_t Other;
+  int Data[] = { 1, 2, 3 };
+
+  SLIST_Create(&List);
+  SLIST_IteratorInit(&It, &List);
+  CuAssertTrue(Test_p, SLIST_IteratorHasNext(&It) == false);
+
+  for (int i = 0; i < 3; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+
+  // Two cursors walk the same list independently
+  SLIST_IteratorInit(&It, &List);
+  SLIST_IteratorInit(&Other, &List);
+  CuAssertIntEquals(Test_p, 1, *(int*)SLIST_IteratorGetNext(&It));
+  CuAssertIntEquals(Test_p, 2, *(int*)SLIST_IteratorGetNext(&It));
+  CuAssertIntEquals(Test_p, 1, *(int*)SLIST_IteratorGetNext(&Other));
+  CuAssertIntEquals(Test_p, 3, *(int*)SLIST_IteratorGetNext(&It));
+  CuAssertTrue(Test_p, SLIST_IteratorHasNext(&It) == false);
+  CuAssertTrue(Test_p, SLIST_IteratorHasNext(&Other) == true);
+
+  SLIST_IteratorReset(&It);
+  CuAssertIntEquals(Test_p, 1, *(int*)SLIST_IteratorGetNext(&It));
+  CuAssertPtrEquals(Test_p, &Data[0], List.Head_p->Data_p);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestForeach(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3, 4 };
+  int* Number_p;
+  int Sum = 0;
+
+  SLIST_Create(&List);
+  SLIST_FOREACH(Number_p, &List)
+  {
+    Sum += 100;
+  }
+  CuAssertIntEquals(Test_p, 0, Sum);
+
+  for (int i = 0; i < 4; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+
+  int Expected = 1;
+  SLIST_FOREACH(Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Sum += *Number_p;
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, 10, Sum);
+
+  // Nested loops over the same list, and leaving a loop early
+  int* Other_p;
+  int Pairs = 0;
+  SLIST_FOREACH(Number_p, &List)
+  {
+    SLIST_FOREACH(Other_p, &List)
+    {
+      if (*Other_p > *Number_p)
+      {
+        break;
+      }
+      Pairs++;
+    }
+  }
+  CuAssertIntEquals(Test_p, 10, Pairs);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == 4);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestPoolInsertRemove(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3, 4, 5 };
+
+  SLIST_CreateWithPool(&List, 2);
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&List) == true);
+
+  for (int i = 0; i < 5; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+  CuAssertTrue(Test_p, SLIST_Length(&List) == 5);
+
+  CuAssertIntEquals(Test_p, 1, *(int*)SLIST_RemoveFirst(&List));
+  CuAssertIntEquals(Test_p, 5, *(int*)SLIST_RemoveLast(&List));
+  CuAssertTrue(Test_p, SLIST_Length(&List) == 3);
+
+  SLIST_InsertFirst(&List, &Data[0]);
+  CuAssertIntEquals(Test_p, 1, *(int*)SLIST_RemoveFirst(&List));
+  CuAssertIntEquals(Test_p, 2, *(int*)SLIST_RemoveFirst(&List));
+  CuAssertIntEquals(Test_p, 3, *(int*)SLIST_RemoveFirst(&List));
+  CuAssertIntEquals(Test_p, 4, *(int*)SLIST_RemoveFirst(&List));
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&List) == true);
+
+  SLIST_Destroy(&List);
+  CuAssertPtrEquals(Test_p, NULL, List.Pool_p);
+}
+
+
+static void
+TestPoolRecyclesNodes(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data = 42;
+
+  SLIST_CreateWithPool(&List, 4);
+
+  SLIST_InsertLast(&List, &Data);
+  SLIST_Node_t* First_p = List.Head_p;
+  SLIST_RemoveFirst(&List);
+
+  // The released node is handed out again by the next insert
+  SLIST_InsertFirst(&List, &Data);
+  CuAssertPtrEquals(Test_p, First_p, List.Head_p);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestDestroyPoolCallsDestroyFunction(CuTest* Test_p)
+{
+  SLIST_List_t List;
+
+  SLIST_CreateWithPool(&List, 8);
+  SLIST_SetDestroyFunction(&List, DataDestroy);
+
+  for (int i = 0; i < 100; i++)
+  {
+    SLIST_InsertLast(&List, malloc(1));
+  }
+  free(SLIST_RemoveFirst(&List));
+
+  ResetDestroyAndPrintCount();
+  SLIST_Destroy(&List);
+
+  CuAssertIntEquals(Test_p, 99, DestroyCount);
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&List) == true);
+  CuAssertPtrEquals(Test_p, NULL, List.Pool_p);
+}
+
+
+static void
+TestStats(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_Stats_t Stats;
+  int Data[] = { 1, 2, 3, 4 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+
+  SLIST_GetStats(&List, &Stats);
+  CuAssertTrue(Test_p, Stats.Length == 0);
+  CuAssertTrue(Test_p, Stats.HighWaterMark == 0);
+
+  SLIST_InsertLast(&List, &Data[0]);
+  SLIST_InsertLast(&List, &Data[1]);
+  SLIST_InsertFirst(&List, &Data[2]);
+  SLIST_RemoveLast(&List);
+  SLIST_RemoveFirst(&List);
+  SLIST_InsertLast(&List, &Data[3]);
+
+  // A failed search does not count as a removal
+  int Missing = 7;
+  SLIST_RemoveSpecific(&List, &Missing);
+  SLIST_RemoveSpecific(&List, &Data[3]);
+
+  SLIST_GetStats(&List, &Stats);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == 1);
+  CuAssertTrue(Test_p, Stats.Length == 1);
+  CuAssertTrue(Test_p, Stats.HighWaterMark == 3);
+  CuAssertTrue(Test_p, Stats.TotalInserts == 4);
+  CuAssertTrue(Test_p, Stats.TotalRemoves == 3);
+
+  SLIST_Destroy(&List);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == 0);
+}
+
+
+static size_t
+DataHashInt(const void* const Data_p)
+{
+  return (size_t)*(const int*)Data_p;
+}
+
+
+// Checks that the list holds exactly the numbers in Expected_p, in order
+static void
+AssertContents(CuTest* Test_p, const SLIST_List_t *const List_p,
+               const int *const Expected_p, size_t Count)
+{
+  SLIST_Node_t* Node_p = List_p->Head_p;
+  SLIST_Node_t* Last_p = NULL;
+  for (size_t i = 0; i < Count; i++)
+  {
+    CuAssertPtrNotNull(Test_p, Node_p);
+    CuAssertIntEquals(Test_p, Expected_p[i], *(int*)Node_p->Data_p);
+    Last_p = Node_p;
+    Node_p = Node_p->Next_p;
+  }
+  CuAssertPtrEquals(Test_p, NULL, Node_p);
+  CuAssertPtrEquals(Test_p, Last_p, List_p->Tail_p);
+  CuAssertTrue(Test_p, SLIST_Length(List_p) == Count);
+}
+
+
+static void
+TestFind(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3 };
+  int Two = 2;
+  int Missing = 4;
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+
+  for (int i = 0; i < 3; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+
+  // The stored data is returned, not the search key
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_Find(&List, &Two));
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Missing));
+
+  SLIST_CreateIndex(&List);
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_Find(&List, &Two));
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Missing));
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveSpecific(&List, &Two));
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Two));
+
+  SLIST_DestroyIndex(&List);
+  CuAssertPtrEquals(Test_p, NULL, List.Index_p);
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_Find(&List, &Data[2]));
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestIndexKeepsOrder(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 0, 1, 2, 3, 4, 5, 6 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+
+  SLIST_InsertLast(&List, &Data[3]);
+  SLIST_InsertLast(&List, &Data[4]);
+  SLIST_InsertFirst(&List, &Data[2]);
+  SLIST_InsertLast(&List, &Data[5]);
+  SLIST_InsertFirst(&List, &Data[1]);
+  SLIST_InsertLast(&List, &Data[6]);
+  SLIST_InsertFirst(&List, &Data[0]);
+  AssertContents(Test_p, &List, (int[]){ 0, 1, 2, 3, 4, 5, 6 }, 7);
+
+  // Middle, head and tail removals all keep the predecessors up to date
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_RemoveSpecific(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 0, 1, 2, 4, 5, 6 }, 6);
+  CuAssertPtrEquals(Test_p, &Data[4], SLIST_RemoveSpecific(&List, &Data[4]));
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_RemoveSpecific(&List, &Data[0]));
+  CuAssertPtrEquals(Test_p, &Data[6], SLIST_RemoveSpecific(&List, &Data[6]));
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 5 }, 3);
+
+  CuAssertPtrEquals(Test_p, &Data[5], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_RemoveLast(&List));
+  SLIST_InsertLast(&List, &Data[6]);
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveFirst(&List));
+  AssertContents(Test_p, &List, (int[]){ 6 }, 1);
+
+  CuAssertPtrEquals(Test_p, &Data[6], SLIST_RemoveSpecific(&List, &Data[6]));
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, List.Index_p->EntryCount == 0);
+
+  SLIST_InsertLast(&List, &Data[2]);
+  SLIST_InsertFirst(&List, &Data[1]);
+  AssertContents(Test_p, &List, (int[]){ 1, 2 }, 2);
+
+  SLIST_Destroy(&List);
+  CuAssertPtrEquals(Test_p, NULL, List.Index_p);
+}
+
+
+static void
+TestIndexDuplicates(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 7, 7, 7, 8 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+
+  SLIST_InsertLast(&List, &Data[1]);
+  SLIST_InsertLast(&List, &Data[3]);
+  SLIST_CreateIndex(&List);
+  SLIST_InsertLast(&List, &Data[2]);
+  SLIST_InsertFirst(&List, &Data[0]);
+
+  // Equal elements come out in list order, as without an index
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_Find(&List, &Data[2]));
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_RemoveSpecific(&List, &Data[2]));
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveSpecific(&List, &Data[2]));
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_RemoveSpecific(&List, &Data[2]));
+  CuAssertPtrEquals(Test_p, NULL, SLIST_RemoveSpecific(&List, &Data[2]));
+  AssertContents(Test_p, &List, (int[]){ 8 }, 1);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestIndexGrows(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  enum { COUNT = 5000 };
+  int* Data_p = malloc(sizeof(int) * COUNT);
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+
+  for (int i = 0; i < COUNT; i++)
+  {
+    Data_p[i] = i;
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+  CuAssertTrue(Test_p, List.Index_p->BucketCount >= COUNT);
+
+  // Remove every odd number, then check the even ones are still in order
+  for (int i = 1; i < COUNT; i += 2)
+  {
+    CuAssertPtrEquals(Test_p, &Data_p[i], SLIST_RemoveSpecific(&List, &Data_p[i]));
+  }
+  int Expected = 0;
+  for (SLIST_Node_t* Node_p = List.Head_p; Node_p != NULL; Node_p = Node_p->Next_p)
+  {
+    CuAssertIntEquals(Test_p, Expected, *(int*)Node_p->Data_p);
+    Expected += 2;
+  }
+  CuAssertIntEquals(Test_p, COUNT, Expected);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == COUNT / 2);
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+// Orders numbers by their tens only, so that e.g. 11 and 13 compare equal
+static int
+DataCompareTens(const void* const Data1_p, const void* const Data2_p)
+{
+  int Tens1 = *(const int*)Data1_p / 10;
+  int Tens2 = *(const int*)Data2_p / 10;
+  return (Tens1 > Tens2) - (Tens1 < Tens2);
+}
+
+
+static void
+TestSort(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  enum { COUNT = 1000 };
+  int* Data_p = malloc(sizeof(int) * COUNT);
+  unsigned int Seed = 7;
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+
+  // Sorting an empty list or a single element changes nothing
+  SLIST_Sort(&List);
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&List) == true);
+  Data_p[0] = 5;
+  SLIST_InsertLast(&List, &Data_p[0]);
+  SLIST_Sort(&List);
+  AssertContents(Test_p, &List, (int[]){ 5 }, 1);
+  SLIST_RemoveFirst(&List);
+
+  // Sizes that are not a power of two leave several runs to merge at the end
+  for (int i = 0; i < COUNT - 3; i++)
+  {
+    Seed = Seed * 1103515245 + 12345;
+    Data_p[i] = (int)((Seed >> 8) % 100);
+    SLIST_InsertLast(&List, &Data_p[i]);
+  }
+  SLIST_Sort(&List);
+
+  int Previous = -1;
+  SLIST_Node_t* Last_p = NULL;
+  for (SLIST_Node_t* Node_p = List.Head_p; Node_p != NULL; Node_p = Node_p->Next_p)
+  {
+    CuAssertTrue(Test_p, Previous <= *(int*)Node_p->Data_p);
+    Previous = *(int*)Node_p->Data_p;
+    Last_p = Node_p;
+  }
+  CuAssertPtrEquals(Test_p, Last_p, List.Tail_p);
+  CuAssertTrue(Test_p, SLIST_Length(&List) == COUNT - 3);
+
+  // The tail is usable after the sort
+  Data_p[COUNT - 1] = 1000;
+  SLIST_InsertLast(&List, &Data_p[COUNT - 1]);
+  CuAssertPtrEquals(Test_p, &Data_p[COUNT - 1], SLIST_RemoveLast(&List));
+  CuAssertIntEquals(Test_p, Previous, *(int*)SLIST_RemoveLast(&List));
+
+  SLIST_Destroy(&List);
+  free(Data_p);
+}
+
+
+static void
+TestSortIsStable(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 31, 12, 33, 11, 5, 34, 13, 2, 32 };
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareTens);
+  for (int i = 0; i < 9; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+
+  SLIST_Sort(&List);
+  AssertContents(Test_p, &List, (int[]){ 5, 2, 12, 11, 13, 31, 33, 34, 32 }, 9);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestSortKeepsIndex(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 4, 2, 4, 1, 3 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+  for (int i = 0; i < 5; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+  }
+
+  SLIST_Sort(&List);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 4, 4 }, 5);
+
+  // The first of the equal elements is still found first, and removals
+  // through the index see the new predecessors
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_Find(&List, &Data[2]));
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveSpecific(&List, &Data[1]));
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_RemoveLast(&List));
+  AssertContents(Test_p, &List, (int[]){ 1, 3 }, 2);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestInsertSorted(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 20, 10, 30, 21, 5, 35 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareTens);
+  for (int i = 0; i < 6; i++)
+  {
+    SLIST_InsertSorted(&List, &Data[i]);
+  }
+  // Equal elements stay in insertion order
+  AssertContents(Test_p, &List, (int[]){ 5, 10, 20, 21, 30, 35 }, 6);
+  SLIST_Destroy(&List);
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+  for (int i = 0; i < 6; i++)
+  {
+    SLIST_InsertSorted(&List, &Data[i]);
+  }
+  AssertContents(Test_p, &List, (int[]){ 5, 10, 20, 21, 30, 35 }, 6);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_RemoveSpecific(&List, &Data[3]));
+  CuAssertPtrEquals(Test_p, &Data[5], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_RemoveLast(&List));
+  AssertContents(Test_p, &List, (int[]){ 5, 10, 20 }, 3);
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestMerge(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Source;
+  int Data[] = { 1, 3, 3, 7, 2, 3, 8, 9 };
+
+  SLIST_Create(&List);
+  SLIST_Create(&Source);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetCompareFunction(&Source, DataCompareInt);
+  for (int i = 0; i < 4; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+    SLIST_InsertLast(&Source, &Data[i + 4]);
+  }
+
+  SLIST_Merge(&List, &Source);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 3, 3, 7, 8, 9 }, 8);
+  CuAssertTrue(Test_p, SLIST_IsEmpty(&Source) == true);
+  CuAssertPtrEquals(Test_p, NULL, Source.Tail_p);
+  CuAssertTrue(Test_p, SLIST_Length(&Source) == 0);
+
+  // Elements of the receiving list come first on ties
+  SLIST_Node_t* Node_p = List.Head_p->Next_p->Next_p;
+  CuAssertPtrEquals(Test_p, &Data[1], Node_p->Data_p);
+  CuAssertPtrEquals(Test_p, &Data[2], Node_p->Next_p->Data_p);
+  CuAssertPtrEquals(Test_p, &Data[5], Node_p->Next_p->Next_p->Data_p);
+
+  // Merging into an empty list, and merging an empty list
+  SLIST_Merge(&Source, &List);
+  AssertContents(Test_p, &Source, (int[]){ 1, 2, 3, 3, 3, 7, 8, 9 }, 8);
+  SLIST_Merge(&Source, &List);
+  CuAssertTrue(Test_p, SLIST_Length(&Source) == 8);
+
+  SLIST_Stats_t Stats;
+  SLIST_GetStats(&List, &Stats);
+  CuAssertTrue(Test_p, Stats.TotalInserts == 4 + 4 && Stats.TotalRemoves == 8);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Source);
+}
+
+
+static void
+TestMergePooled(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Source;
+  int Data[] = { 2, 4, 6, 1, 4, 7 };
+
+  // Nodes of different pools cannot be relinked, they are moved one by one
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_Create(&Source);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_SetCompareFunction(&Source, DataCompareInt);
+  SLIST_SetHashFunction(&Source, DataHashInt);
+  SLIST_CreateIndex(&List);
+  SLIST_CreateIndex(&Source);
+  for (int i = 0; i < 3; i++)
+  {
+    SLIST_InsertLast(&List, &Data[i]);
+    SLIST_InsertLast(&Source, &Data[i + 3]);
+  }
+
+  SLIST_Merge(&List, &Source);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 4, 4, 6, 7 }, 6);
+  CuAssertTrue(Test_p, List.Index_p->EntryCount == 6);
+  CuAssertTrue(Test_p, Source.Index_p->EntryCount == 0);
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_Find(&List, &Data[4]));
+  CuAssertPtrEquals(Test_p, &Data[5], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveSpecific(&List, &Data[1]));
+  CuAssertPtrEquals(Test_p, &Data[4], SLIST_RemoveSpecific(&List, &Data[4]));
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 6 }, 3);
+
+  // The emptied list is still indexed and usable
+  SLIST_InsertLast(&Source, &Data[0]);
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_Find(&Source, &Data[0]));
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Source);
+}
+
+// Fills a list with the numbers in Data_p, in order
+static void
+FillList(SLIST_List_t *const List_p, int *const Data_p, size_t Count)
+{
+  for (size_t i = 0; i < Count; i++)
+  {
+    SLIST_InsertLast(List_p, &Data_p[i]);
+  }
+}
+
+
+static void
+TestSharedPool(CuTest* Test_p)
+{
+  SLIST_List_t Owner;
+  SLIST_List_t Sharer;
+  int Data[] = { 1, 2, 3, 4 };
+
+  SLIST_CreateWithPool(&Owner, 0);
+  SLIST_CreateWithSharedPool(&Sharer, &Owner);
+  CuAssertPtrEquals(Test_p, Owner.Pool_p, Sharer.Pool_p);
+  CuAssertTrue(Test_p, Owner.Pool_p->References == 2);
+  FillList(&Owner, Data, 2);
+  FillList(&Sharer, &Data[2], 2);
+
+  // A node handed over by concatenation outlives the list it came from
+  SLIST_Concat(&Sharer, &Owner);
+  SLIST_Destroy(&Owner);
+  AssertContents(Test_p, &Sharer, (int[]){ 3, 4, 1, 2 }, 4);
+  CuAssertTrue(Test_p, Sharer.Pool_p->References == 1);
+
+  // Freed nodes went back to the pool and are handed out again
+  SLIST_InsertLast(&Sharer, &Data[0]);
+  SLIST_Destroy(&Sharer);
+
+  // Sharing with a list without a pool means plain malloc()
+  SLIST_Create(&Owner);
+  SLIST_CreateWithSharedPool(&Sharer, &Owner);
+  CuAssertPtrEquals(Test_p, NULL, Sharer.Pool_p);
+  SLIST_Destroy(&Sharer);
+  SLIST_Destroy(&Owner);
+}
+
+
+static void
+TestConcat(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Source;
+  int Data[] = { 1, 2, 3, 4, 5 };
+
+  SLIST_Create(&List);
+  SLIST_Create(&Source);
+  FillList(&List, Data, 2);
+  FillList(&Source, &Data[2], 3);
+  SLIST_Node_t* Moved_p = Source.Head_p;
+
+  SLIST_Concat(&List, &Source);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 4, 5 }, 5);
+  AssertContents(Test_p, &Source, NULL, 0);
+  CuAssertPtrEquals(Test_p, Moved_p, List.Head_p->Next_p->Next_p);
+
+  // Empty on either side
+  SLIST_Concat(&List, &Source);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 4, 5 }, 5);
+  SLIST_Concat(&Source, &List);
+  AssertContents(Test_p, &Source, (int[]){ 1, 2, 3, 4, 5 }, 5);
+
+  SLIST_Stats_t Stats;
+  SLIST_GetStats(&List, &Stats);
+  CuAssertTrue(Test_p, Stats.TotalInserts == 5 && Stats.TotalRemoves == 5);
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Source);
+
+  // Lists with different pools still concatenate, by moving the data
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_CreateWithPool(&Source, 0);
+  FillList(&List, Data, 2);
+  FillList(&Source, &Data[2], 3);
+  SLIST_Concat(&List, &Source);
+  SLIST_Destroy(&Source);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 4, 5 }, 5);
   SLIST_Destroy(&List);
 }
 
 
+static void
+TestConcatIndexed(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Source;
+  int Data[] = { 1, 2, 3, 4 };
+
+  SLIST_Create(&List);
+  SLIST_Create(&Source);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_SetCompareFunction(&Source, DataCompareInt);
+  SLIST_SetHashFunction(&Source, DataHashInt);
+  SLIST_CreateIndex(&List);
+  SLIST_CreateIndex(&Source);
+  FillList(&List, Data, 2);
+  FillList(&Source, &Data[2], 2);
+
+  SLIST_Concat(&List, &Source);
+  CuAssertTrue(Test_p, List.Index_p->EntryCount == 4);
+  CuAssertTrue(Test_p, Source.Index_p->EntryCount == 0);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveLast(&List));
+  AssertContents(Test_p, &List, (int[]){ 1 }, 1);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Source);
+}
+
+
+static void
+TestSplitAt(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Rest;
+  int Data[] = { 1, 2, 3, 4, 5 };
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_CreateWithSharedPool(&Rest, &List);
+  FillList(&List, Data, 5);
+
+  SLIST_SplitAt(&List, 5, &Rest);
+  AssertContents(Test_p, &Rest, NULL, 0);
+  SLIST_SplitAt(&List, 3, &Rest);
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3 }, 3);
+  AssertContents(Test_p, &Rest, (int[]){ 4, 5 }, 2);
+
+  // Moved elements are appended to what Rest already holds
+  SLIST_SplitAt(&List, 0, &Rest);
+  AssertContents(Test_p, &List, NULL, 0);
+  AssertContents(Test_p, &Rest, (int[]){ 4, 5, 1, 2, 3 }, 5);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Rest);
+}
+
+
+static void
+TestSplitAfter(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Rest;
+  int Data[] = { 1, 2, 3, 4 };
+  int Missing = 9;
+
+  SLIST_Create(&List);
+  SLIST_Create(&Rest);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+  FillList(&List, Data, 4);
+
+  CuAssertTrue(Test_p, SLIST_SplitAfter(&List, &Missing, &Rest) == false);
+  CuAssertTrue(Test_p, SLIST_SplitAfter(&List, &Data[3], &Rest) == true);
+  AssertContents(Test_p, &Rest, NULL, 0);
+
+  CuAssertTrue(Test_p, SLIST_SplitAfter(&List, &Data[1], &Rest) == true);
+  AssertContents(Test_p, &List, (int[]){ 1, 2 }, 2);
+  AssertContents(Test_p, &Rest, (int[]){ 3, 4 }, 2);
+  CuAssertTrue(Test_p, List.Index_p->EntryCount == 2);
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Data[2]));
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveLast(&List));
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Rest);
+}
+
+
+static void
+TestSpliceRange(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Source;
+  int Data[] = { 1, 2, 3, 10, 20, 30, 40 };
+
+  SLIST_Create(&List);
+  SLIST_Create(&Source);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+  FillList(&List, Data, 3);
+  FillList(&Source, &Data[3], 4);
+
+  // Middle of Source into the middle of List
+  SLIST_SpliceRange(&List, 1, &Source, 1, 2);
+  AssertContents(Test_p, &List, (int[]){ 1, 20, 30, 2, 3 }, 5);
+  AssertContents(Test_p, &Source, (int[]){ 10, 40 }, 2);
+  CuAssertPtrEquals(Test_p, &Data[4], SLIST_Find(&List, &Data[4]));
+
+  // Tail of Source, shortened, to the head of List
+  SLIST_SpliceRange(&List, 0, &Source, 1, 5);
+  AssertContents(Test_p, &List, (int[]){ 40, 1, 20, 30, 2, 3 }, 6);
+  AssertContents(Test_p, &Source, (int[]){ 10 }, 1);
+
+  // Appending, and ranges that are empty
+  SLIST_SpliceRange(&List, 100, &Source, 0, 1);
+  SLIST_SpliceRange(&List, 0, &Source, 0, 1);
+  AssertContents(Test_p, &List, (int[]){ 40, 1, 20, 30, 2, 3, 10 }, 7);
+  AssertContents(Test_p, &Source, NULL, 0);
+
+  // The index has the new order
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[6], SLIST_RemoveFirst(&List));
+  CuAssertPtrEquals(Test_p, &Data[5], SLIST_RemoveSpecific(&List, &Data[5]));
+  AssertContents(Test_p, &List, (int[]){ 1, 20, 2, 3 }, 4);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Source);
+}
+
+static void
+TestInsertLastBatch(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3, 4, 5 };
+  void* Batch[] = { &Data[1], &Data[2], &Data[3] };
+
+  for (int UsePool = 0; UsePool < 2; UsePool++)
+  {
+    if (UsePool)
+    {
+      SLIST_CreateWithPool(&List, 2);
+    }
+    else
+    {
+      SLIST_Create(&List);
+    }
+    SLIST_SetCompareFunction(&List, DataCompareInt);
+    SLIST_SetHashFunction(&List, DataHashInt);
+
+    SLIST_InsertLastBatch(&List, Batch, 0);
+    AssertContents(Test_p, &List, NULL, 0);
+    SLIST_InsertLastBatch(&List, Batch, 3);
+    AssertContents(Test_p, &List, (int[]){ 2, 3, 4 }, 3);
+
+    SLIST_CreateIndex(&List);
+    SLIST_InsertFirst(&List, &Data[0]);
+    SLIST_InsertLastBatch(&List, (void*[]){ &Data[4], &Data[0] }, 2);
+    AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 4, 5, 1 }, 6);
+    CuAssertPtrEquals(Test_p, &Data[4], SLIST_RemoveSpecific(&List, &Data[4]));
+    CuAssertPtrEquals(Test_p, &Data[0], SLIST_RemoveLast(&List));
+    CuAssertPtrEquals(Test_p, &Data[3], SLIST_RemoveLast(&List));
+
+    SLIST_Stats_t Stats;
+    SLIST_GetStats(&List, &Stats);
+    CuAssertTrue(Test_p, Stats.TotalInserts == 6 && Stats.HighWaterMark == 6);
+    SLIST_Destroy(&List);
+  }
+}
+
+
+static void
+TestRemoveFirstBatch(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3, 4, 5 };
+  void* Removed[5] = { NULL };
+
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_CreateIndex(&List);
+  FillList(&List, Data, 5);
+
+  CuAssertTrue(Test_p, SLIST_RemoveFirstBatch(&List, Removed, 0) == 0);
+  CuAssertTrue(Test_p, SLIST_RemoveFirstBatch(&List, Removed, 2) == 2);
+  CuAssertPtrEquals(Test_p, &Data[0], Removed[0]);
+  CuAssertPtrEquals(Test_p, &Data[1], Removed[1]);
+  AssertContents(Test_p, &List, (int[]){ 3, 4, 5 }, 3);
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Data[1]));
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_RemoveSpecific(&List, &Data[3]));
+
+  // More than the list holds empties it
+  CuAssertTrue(Test_p, SLIST_RemoveFirstBatch(&List, Removed, 5) == 2);
+  CuAssertPtrEquals(Test_p, &Data[2], Removed[0]);
+  CuAssertPtrEquals(Test_p, &Data[4], Removed[1]);
+  AssertContents(Test_p, &List, NULL, 0);
+  CuAssertTrue(Test_p, SLIST_RemoveFirstBatch(&List, Removed, 5) == 0);
+
+  // The nodes went back to the pool
+  SLIST_InsertLast(&List, &Data[0]);
+  CuAssertTrue(Test_p, List.Pool_p->Free_p != NULL);
+
+  SLIST_Destroy(&List);
+}
+
+static void
+TestFindMoveToFront(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3, 4 };
+  int Missing = 5;
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  FillList(&List, Data, 4);
+
+  // The default policy keeps the order
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_Find(&List, &Data[2]));
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 3, 4 }, 4);
+
+  SLIST_SetFindPolicy(&List, SLIST_FIND_MOVE_TO_FRONT);
+  CuAssertPtrEquals(Test_p, &Data[2], SLIST_Find(&List, &Data[2]));
+  AssertContents(Test_p, &List, (int[]){ 3, 1, 2, 4 }, 4);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_Find(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 4, 3, 1, 2 }, 4);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_Find(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 4, 3, 1, 2 }, 4);
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Missing));
+  AssertContents(Test_p, &List, (int[]){ 4, 3, 1, 2 }, 4);
+
+  // An indexed lookup does not move anything
+  SLIST_CreateIndex(&List);
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_Find(&List, &Data[1]));
+  AssertContents(Test_p, &List, (int[]){ 4, 3, 1, 2 }, 4);
+  CuAssertPtrEquals(Test_p, &Data[1], SLIST_RemoveLast(&List));
+  SLIST_DestroyIndex(&List);
+
+  CuAssertPtrEquals(Test_p, &Data[0], SLIST_Find(&List, &Data[0]));
+  AssertContents(Test_p, &List, (int[]){ 1, 4, 3 }, 3);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestFindTranspose(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 1, 2, 3, 4 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetFindPolicy(&List, SLIST_FIND_TRANSPOSE);
+  FillList(&List, Data, 4);
+
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_Find(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 1, 2, 4, 3 }, 4);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_Find(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 1, 4, 2, 3 }, 4);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_Find(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 4, 1, 2, 3 }, 4);
+  CuAssertPtrEquals(Test_p, &Data[3], SLIST_Find(&List, &Data[3]));
+  AssertContents(Test_p, &List, (int[]){ 4, 1, 2, 3 }, 4);
+
+  // The tail stays valid for appends
+  SLIST_InsertLast(&List, &Data[0]);
+  CuAssertPtrEquals(Test_p, &Data[0], List.Tail_p->Data_p);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestCompact(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  int Data[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  CuAssertTrue(Test_p, SLIST_Compact(&List));
+  CuAssertPtrEquals(Test_p, NULL, List.Pool_p);
+
+  for (int i = 7; i >= 0; i--)
+  {
+    SLIST_InsertFirst(&List, &Data[i]);
+  }
+  SLIST_RemoveSpecific(&List, &Data[3]);
+  SLIST_CreateIndex(&List);
+
+  CuAssertTrue(Test_p, SLIST_Compact(&List));
+  AssertContents(Test_p, &List, (int[]){ 0, 1, 2, 4, 5, 6, 7 }, 7);
+  CuAssertPtrNotNull(Test_p, List.Pool_p);
+  CuAssertTrue(Test_p, List.Stats.TotalInserts == 8);
+
+  // The nodes are adjacent in traversal order
+  SLIST_Node_t* Node_p = List.Head_p;
+  while (Node_p->Next_p != NULL)
+  {
+    CuAssertPtrEquals(Test_p, Node_p + 1, Node_p->Next_p);
+    Node_p = Node_p->Next_p;
+  }
+
+  // The index was rebuilt on the new nodes
+  CuAssertPtrNotNull(Test_p, List.Index_p);
+  CuAssertPtrEquals(Test_p, &Data[5], SLIST_Find(&List, &Data[5]));
+  CuAssertPtrEquals(Test_p, &Data[7], SLIST_RemoveLast(&List));
+  CuAssertPtrEquals(Test_p, &Data[4], SLIST_RemoveSpecific(&List, &Data[4]));
+  SLIST_InsertLast(&List, &Data[3]);
+  AssertContents(Test_p, &List, (int[]){ 0, 1, 2, 5, 6, 3 }, 6);
+
+  SLIST_Destroy(&List);
+}
+
+
+static void
+TestCompactSharedPool(CuTest* Test_p)
+{
+  SLIST_List_t Owner;
+  SLIST_List_t Sharer;
+  int Data[] = { 1, 2, 3, 4 };
+
+  SLIST_CreateWithPool(&Owner, 16);
+  SLIST_CreateWithSharedPool(&Sharer, &Owner);
+  FillList(&Owner, Data, 2);
+  FillList(&Sharer, &Data[2], 2);
+
+  CuAssertTrue(Test_p, SLIST_Compact(&Sharer));
+  CuAssertTrue(Test_p, Owner.Pool_p->References == 1);
+  CuAssertTrue(Test_p, Sharer.Pool_p != Owner.Pool_p);
+  CuAssertTrue(Test_p, Sharer.Pool_p->BlocksPerSlab == 16);
+  AssertContents(Test_p, &Sharer, (int[]){ 3, 4 }, 2);
+
+  // The old nodes of the sharer went back to the pool of the owner
+  CuAssertPtrNotNull(Test_p, Owner.Pool_p->Free_p);
+  SLIST_InsertLast(&Owner, &Data[2]);
+  AssertContents(Test_p, &Owner, (int[]){ 1, 2, 3 }, 3);
+
+  SLIST_Destroy(&Owner);
+  SLIST_Destroy(&Sharer);
+}
+
+// The counters are only kept when slist.c is built with SLIST_INSTRUMENT
+static void
+TestProfile(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_Profile_t Profile;
+  int Data[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  int Missing = 9;
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  FillList(&List, Data, 8);
+  SLIST_ResetProfile();
+
+  CuAssertPtrEquals(Test_p, &Data[4], SLIST_Find(&List, &Data[4]));
+  CuAssertPtrEquals(Test_p, NULL, SLIST_Find(&List, &Missing));
+  SLIST_RemoveFirst(&List);
+  SLIST_InsertLast(&List, &Data[0]);
+
+  if (!SLIST_GetProfile(&Profile))
+  {
+    CuAssertTrue(Test_p, Profile.Compares == 0 && Profile.Scans == 0);
+    SLIST_Destroy(&List);
+    return;
+  }
+
+  CuAssertTrue(Test_p, Profile.Compares == 5 + 8);
+  CuAssertTrue(Test_p, Profile.Scans == 2);
+  CuAssertTrue(Test_p, Profile.NodesVisited == 5 + 8);
+  CuAssertTrue(Test_p, Profile.ScanLength[3] == 1);
+  CuAssertTrue(Test_p, Profile.ScanLength[4] == 1);
+  CuAssertTrue(Test_p, Profile.NodeAllocs == 1);
+  CuAssertTrue(Test_p, Profile.NodeFrees == 1);
+
+  uint64_t Finds = 0;
+  uint64_t Allocs = 0;
+  for (int b = 0; b < SLIST_HISTOGRAM_BUCKETS; b++)
+  {
+    Finds += Profile.Latency[SLIST_OP_FIND][b];
+    Allocs += Profile.Latency[SLIST_OP_ALLOC_NODE][b];
+  }
+  CuAssertTrue(Test_p, Finds == 2);
+  CuAssertTrue(Test_p, Allocs == 1);
+
+  SLIST_ResetProfile();
+  SLIST_GetProfile(&Profile);
+  CuAssertTrue(Test_p, Profile.Compares == 0 && Profile.NodeAllocs == 0);
+  CuAssertTrue(Test_p, Profile.Latency[SLIST_OP_FIND][0] == 0);
+
+  SLIST_Destroy(&List);
+}
+
+static void
+TestHistogramPercentile(CuTest* Test_p)
+{
+  uint64_t Histogram[SLIST_HISTOGRAM_BUCKETS] = { 0 };
+
+  CuAssertTrue(Test_p, SLIST_HistogramPercentile(Histogram, 50) == 0);
+
+  // 90 values from 8 to 15 and 10 values from 1024 to 2047
+  Histogram[4] = 90;
+  Histogram[11] = 10;
+  CuAssertTrue(Test_p, SLIST_HistogramPercentile(Histogram, 0) == 15);
+  CuAssertTrue(Test_p, SLIST_HistogramPercentile(Histogram, 50) == 15);
+  CuAssertTrue(Test_p, SLIST_HistogramPercentile(Histogram, 90) == 15);
+  CuAssertTrue(Test_p, SLIST_HistogramPercentile(Histogram, 91) == 2047);
+  CuAssertTrue(Test_p, SLIST_HistogramPercentile(Histogram, 100) == 2047);
+  CuAssertStrEquals(Test_p, "RemoveSpecific", SLIST_OperationName(SLIST_OP_REMOVE_SPECIFIC));
+}
+
+
 static CuSuite*
 Get_SLIST_Suite(void)
 {
@@ -366,6 +1577,36 @@ Get_SLIST_Suite(void)
   SUITE_ADD_TEST(Suite_p, TestInsertMalloc);
   SUITE_ADD_TEST(Suite_p, TestRemoveSpecific);
   SUITE_ADD_TEST(Suite_p, TestIterator);
+  SUITE_ADD_TEST(Suite_p, TestCursor);
+  SUITE_ADD_TEST(Suite_p, TestForeach);
+  SUITE_ADD_TEST(Suite_p, TestPoolInsertRemove);
+  SUITE_ADD_TEST(Suite_p, TestPoolRecyclesNodes);
+  SUITE_ADD_TEST(Suite_p, TestDestroyPoolCallsDestroyFunction);
+  SUITE_ADD_TEST(Suite_p, TestStats);
+  SUITE_ADD_TEST(Suite_p, TestFind);
+  SUITE_ADD_TEST(Suite_p, TestIndexKeepsOrder);
+  SUITE_ADD_TEST(Suite_p, TestIndexDuplicates);
+  SUITE_ADD_TEST(Suite_p, TestIndexGrows);
+  SUITE_ADD_TEST(Suite_p, TestSort);
+  SUITE_ADD_TEST(Suite_p, TestSortIsStable);
+  SUITE_ADD_TEST(Suite_p, TestSortKeepsIndex);
+  SUITE_ADD_TEST(Suite_p, TestInsertSorted);
+  SUITE_ADD_TEST(Suite_p, TestMerge);
+  SUITE_ADD_TEST(Suite_p, TestMergePooled);
+  SUITE_ADD_TEST(Suite_p, TestSharedPool);
+  SUITE_ADD_TEST(Suite_p, TestConcat);
+  SUITE_ADD_TEST(Suite_p, TestConcatIndexed);
+  SUITE_ADD_TEST(Suite_p, TestSplitAt);
+  SUITE_ADD_TEST(Suite_p, TestSplitAfter);
+  SUITE_ADD_TEST(Suite_p, TestSpliceRange);
+  SUITE_ADD_TEST(Suite_p, TestInsertLastBatch);
+  SUITE_ADD_TEST(Suite_p, TestRemoveFirstBatch);
+  SUITE_ADD_TEST(Suite_p, TestFindMoveToFront);
+  SUITE_ADD_TEST(Suite_p, TestFindTranspose);
+  SUITE_ADD_TEST(Suite_p, TestCompact);
+  SUITE_ADD_TEST(Suite_p, TestCompactSharedPool);
+  SUITE_ADD_TEST(Suite_p, TestProfile);
+  SUITE_ADD_TEST(Suite_p, TestHistogramPercentile);
 
   return Suite_p;
 }
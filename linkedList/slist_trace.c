@@ -0,0 +1,198 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include "slist_trace.h"
+#include <string.h>
+#include <time.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+static const char *const OperationNames[SLIST_TRACE_OP_COUNT] =
+{
+  "Create",
+  "Destroy",
+  "InsertFirst",
+  "InsertLast",
+  "InsertSorted",
+  "RemoveFirst",
+  "RemoveLast",
+  "RemoveSpecific",
+  "Find",
+  "Sort",
+  "Concat",
+  "Merge",
+  "SplitAt",
+  "SplitAfter",
+  "SpliceRange",
+  "Compact"
+};
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static FILE* TraceFile_p = NULL;
+static uint64_t TraceStart = 0;
+static _Thread_local unsigned int Paused = 0;
+
+
+/* > Local Function Declarations **********************************************/
+
+static uint64_t
+Now(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+bool
+SLIST_TraceStart(const char *const Path_p)
+{
+#ifdef SLIST_TRACE
+  SLIST_TraceHeader_t header;
+
+  SLIST_TraceStop();
+  FILE* file_p = fopen(Path_p, "wb");
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.Magic, SLIST_TRACE_MAGIC, sizeof(SLIST_TRACE_MAGIC));
+  header.Version = SLIST_TRACE_VERSION;
+  header.RecordSize = sizeof(SLIST_TraceRecord_t);
+  if (fwrite(&header, sizeof(header), 1, file_p) != 1)
+  {
+    fclose(file_p);
+    return false;
+  }
+
+  TraceStart = Now();
+  TraceFile_p = file_p;
+  return true;
+#else
+  (void)Path_p;
+  return false;
+#endif
+}
+
+void
+SLIST_TraceStop(void)
+{
+  if (TraceFile_p != NULL)
+  {
+    fclose(TraceFile_p);
+    TraceFile_p = NULL;
+  }
+}
+
+bool
+SLIST_TraceIsActive(void)
+{
+  return (TraceFile_p != NULL && Paused == 0);
+}
+
+void
+SLIST_TracePause(void)
+{
+  Paused++;
+}
+
+void
+SLIST_TraceResume(void)
+{
+  Paused--;
+}
+
+void
+SLIST_TraceRecord(SLIST_TraceOp_t Operation, uint64_t ListId, uint64_t Key, bool Found)
+{
+  SLIST_TraceRecord_t record;
+
+  memset(&record, 0, sizeof(record));
+  record.Key = Key;
+  record.ListId = ListId;
+  record.Operation = (uint32_t)Operation;
+  record.Found = Found ? 1 : 0;
+  SLIST_TraceWrite(&record);
+}
+
+void
+SLIST_TraceWrite(SLIST_TraceRecord_t *const Record_p)
+{
+  if (!SLIST_TraceIsActive())
+  {
+    return;
+  }
+
+  // One fwrite() per record, which stdio makes atomic between threads
+  Record_p->Time = Now() - TraceStart;
+  fwrite(Record_p, sizeof(SLIST_TraceRecord_t), 1, TraceFile_p);
+}
+
+const char*
+SLIST_TraceOpName(SLIST_TraceOp_t Operation)
+{
+  return (Operation < SLIST_TRACE_OP_COUNT) ? OperationNames[Operation] : "Unknown";
+}
+
+bool
+SLIST_TraceOpen(SLIST_TraceReader_t *const Reader_p, const char *const Path_p)
+{
+  SLIST_TraceHeader_t header;
+
+  Reader_p->File_p = fopen(Path_p, "rb");
+  if (Reader_p->File_p == NULL)
+  {
+    return false;
+  }
+
+  if (fread(&header, sizeof(header), 1, Reader_p->File_p) != 1 ||
+      memcmp(header.Magic, SLIST_TRACE_MAGIC, sizeof(SLIST_TRACE_MAGIC)) != 0 ||
+      header.Version != SLIST_TRACE_VERSION ||
+      header.RecordSize != sizeof(SLIST_TraceRecord_t))
+  {
+    SLIST_TraceClose(Reader_p);
+    return false;
+  }
+  return true;
+}
+
+bool
+SLIST_TraceNext(SLIST_TraceReader_t *const Reader_p, SLIST_TraceRecord_t *const Record_p)
+{
+  return (fread(Record_p, sizeof(SLIST_TraceRecord_t), 1, Reader_p->File_p) == 1);
+}
+
+void
+SLIST_TraceClose(SLIST_TraceReader_t *const Reader_p)
+{
+  if (Reader_p->File_p != NULL)
+  {
+    fclose(Reader_p->File_p);
+    Reader_p->File_p = NULL;
+  }
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static uint64_t
+Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,268 @@
+#ifndef SLIST_TRACE_H
+#define SLIST_TRACE_H
+
+/*
+ * Operation Trace of Singly Linked Lists
+ *
+ * When slist.c is compiled with SLIST_TRACE defined, every call of the main
+ * SLIST functions can be recorded to a binary file between SLIST_TraceStart()
+ * and SLIST_TraceStop(). A record holds the operation, the list it was made
+ * on, a hash of the key it used and the time it was made; operations that
+ * move elements between lists also hold the other list and the positions
+ * they were given. The file is read
+ * back with SLIST_TraceOpen(), e.g. by the slist_replay tool, which runs the
+ * recorded operations again on any list variant.
+ *
+ * The file starts with a SLIST_TraceHeader_t followed by SLIST_TraceRecord_t
+ * records, both in the byte order of the recording machine.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+/* > Defines ******************************************************************/
+
+#define SLIST_TRACE_MAGIC    "SLTRACE"
+#define SLIST_TRACE_VERSION  2
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Traced Operations
+//
+// A list is identified by its address, which a later list may reuse after
+// SLIST_TRACE_DESTROY. The key of a record is the value of the hash function
+// of the list for the data passed to or returned by the operation, or the
+// address of the data if the list has no hash function, and 0 for
+// operations without data. Merge, Concat, SpliceRange and the splits record
+// the source or receiving list in OtherId and their position arguments in
+// Position, First and Count; SplitAfter also records the key it searched
+// for and whether it was found. Calls of SLIST_InsertLastBatch()
+// and SLIST_RemoveFirstBatch() are recorded as one record per element.
+// Functions of slist.h that do not change the elements, such as the
+// iterators and the setters, are not traced.
+//
+
+typedef enum SLIST_TraceOp
+{
+  SLIST_TRACE_CREATE,
+  SLIST_TRACE_DESTROY,
+  SLIST_TRACE_INSERT_FIRST,
+  SLIST_TRACE_INSERT_LAST,
+  SLIST_TRACE_INSERT_SORTED,
+  SLIST_TRACE_REMOVE_FIRST,
+  SLIST_TRACE_REMOVE_LAST,
+  SLIST_TRACE_REMOVE_SPECIFIC,
+  SLIST_TRACE_FIND,
+  SLIST_TRACE_SORT,
+  SLIST_TRACE_CONCAT,
+  SLIST_TRACE_MERGE,
+  SLIST_TRACE_SPLIT_AT,
+  SLIST_TRACE_SPLIT_AFTER,
+  SLIST_TRACE_SPLICE_RANGE,
+  SLIST_TRACE_COMPACT,
+  SLIST_TRACE_OP_COUNT
+} SLIST_TraceOp_t;
+
+
+//
+// File Format
+//
+
+typedef struct SLIST_TraceHeader
+{
+  char     Magic[8];
+  uint32_t Version;
+  uint32_t RecordSize;
+} SLIST_TraceHeader_t;
+
+typedef struct SLIST_TraceRecord
+{
+  uint64_t Time;
+  uint64_t Key;
+  uint64_t ListId;
+  uint64_t OtherId;
+  uint64_t Position;
+  uint64_t First;
+  uint64_t Count;
+  uint32_t Operation;
+  uint32_t Found;
+} SLIST_TraceRecord_t;
+
+
+//
+// Trace File Reader
+//
+
+typedef struct SLIST_TraceReader
+{
+  FILE* File_p;
+} SLIST_TraceReader_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Starts recording a trace
+ *
+ * Creates the file Path_p and records every traced operation on any list to
+ * it until SLIST_TraceStop(). Times are in nanoseconds since the start. A
+ * trace that is already running is stopped first. Starting and stopping must
+ * not race with operations on lists; the recording itself is thread-safe.
+ *
+ * @param[in]     Path_p  Name of the trace file
+ * @return        false if the file cannot be created, or if slist.c was
+ *                compiled without SLIST_TRACE and nothing would be recorded
+ *
+ ******************************************************************************/
+bool
+SLIST_TraceStart(const char *const Path_p);
+
+
+/**
+ * @brief Stops recording a trace
+ *
+ * Flushes and closes the trace file. Does nothing if no trace is running.
+ *
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_TraceStop(void);
+
+
+/**
+ * @brief Checks if a trace is being recorded
+ *
+ * @return        true between SLIST_TraceStart() and SLIST_TraceStop(),
+ *                unless the calling thread has paused recording
+ *
+ ******************************************************************************/
+bool
+SLIST_TraceIsActive(void);
+
+
+/**
+ * @brief Pauses recording for the calling thread
+ *
+ * Operations the calling thread makes are not recorded until the matching
+ * SLIST_TraceResume(); other threads are not affected. For functions built
+ * on SLIST functions, such as SLIST_ParallelSort(), that record themselves
+ * as one operation on the list of the caller and keep their internal lists
+ * out of the trace. Pauses nest.
+ *
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_TracePause(void);
+
+
+/**
+ * @brief Resumes recording for the calling thread
+ *
+ * Ends one SLIST_TracePause() of the calling thread.
+ *
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_TraceResume(void);
+
+
+/**
+ * @brief Records an operation
+ *
+ * Appends one record to the running trace, if any. Called by slist.c.
+ *
+ * @param[in]     Operation  The operation
+ * @param[in]     ListId     Identifies the list
+ * @param[in]     Key        Key of the operation
+ * @param[in]     Found      false if a search or removal found nothing
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_TraceRecord(SLIST_TraceOp_t Operation, uint64_t ListId, uint64_t Key, bool Found);
+
+
+/**
+ * @brief Records a prepared record
+ *
+ * Appends Record_p to the running trace, if any, after setting its time.
+ * Called by slist.c for operations that need more than SLIST_TraceRecord()
+ * takes.
+ *
+ * @param[in]     Record_p  The record, with every field but Time set
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_TraceWrite(SLIST_TraceRecord_t *const Record_p);
+
+
+/**
+ * @brief Returns the name of a traced operation
+ *
+ * @param[in]     Operation  The operation
+ * @return        Name of the operation, such as "InsertFirst"
+ *
+ ******************************************************************************/
+const char*
+SLIST_TraceOpName(SLIST_TraceOp_t Operation);
+
+
+/**
+ * @brief Opens a trace file for reading
+ *
+ * Opens the file and checks its header.
+ *
+ * @param[in]     Reader_p  The reader to be initialized
+ * @param[in]     Path_p    Name of the trace file
+ * @return        false if the file cannot be opened or is not a trace of this
+ *                version
+ *
+ ******************************************************************************/
+bool
+SLIST_TraceOpen(SLIST_TraceReader_t *const Reader_p, const char *const Path_p);
+
+
+/**
+ * @brief Reads the next record of a trace
+ *
+ * @param[in]     Reader_p  An open reader
+ * @param[out]    Record_p  Receives the record
+ * @return        false at the end of the trace
+ *
+ ******************************************************************************/
+bool
+SLIST_TraceNext(SLIST_TraceReader_t *const Reader_p, SLIST_TraceRecord_t *const Record_p);
+
+
+/**
+ * @brief Closes a trace file
+ *
+ * @param[in]     Reader_p  An open reader
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+SLIST_TraceClose(SLIST_TraceReader_t *const Reader_p);
+
+
+#endif // SLIST_TRACE_H
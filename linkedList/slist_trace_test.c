@@ -0,0 +1,306 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "slist.h"
+#include "slist_trace.h"
+#include "slist_trace_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define TRACE_FILE  "slist_trace_test.trace"
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestRecordAndRead(CuTest* Test_p);
+
+static void
+TestBatchesAndConcat(CuTest* Test_p);
+
+static void
+TestMovesBetweenLists(CuTest* Test_p);
+
+static void
+TestOpenRejectsOtherFiles(CuTest* Test_p);
+
+static CuSuite*
+Get_SLIST_TRACE_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_TRACE_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SLIST_TRACE_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  int Number1 = *(const int*)Data1_p;
+  int Number2 = *(const int*)Data2_p;
+  return (Number1 > Number2) - (Number1 < Number2);
+}
+
+static size_t
+DataHashInt(const void* const Data_p)
+{
+  return (size_t)*(const int*)Data_p;
+}
+
+// Reads the next record and checks its operation, list and key
+static void
+AssertRecord(CuTest* Test_p,
+             SLIST_TraceReader_t *const Reader_p,
+             SLIST_TraceOp_t Operation,
+             const SLIST_List_t *const List_p,
+             uint64_t Key,
+             bool Found)
+{
+  SLIST_TraceRecord_t Record;
+  CuAssertTrue(Test_p, SLIST_TraceNext(Reader_p, &Record));
+  CuAssertStrEquals(Test_p, SLIST_TraceOpName(Operation),
+                    SLIST_TraceOpName((SLIST_TraceOp_t)Record.Operation));
+  CuAssertTrue(Test_p, Record.ListId == (uint64_t)(uintptr_t)List_p);
+  CuAssertTrue(Test_p, Record.Key == Key);
+  CuAssertTrue(Test_p, (Record.Found != 0) == Found);
+}
+
+// Reads the next record of an operation between two lists and checks the
+// other list and the position arguments as well
+static void
+AssertMove(CuTest* Test_p,
+           SLIST_TraceReader_t *const Reader_p,
+           SLIST_TraceOp_t Operation,
+           const SLIST_List_t *const List_p,
+           const SLIST_List_t *const Other_p,
+           size_t Position,
+           size_t First,
+           size_t Count)
+{
+  SLIST_TraceRecord_t Record;
+  CuAssertTrue(Test_p, SLIST_TraceNext(Reader_p, &Record));
+  CuAssertStrEquals(Test_p, SLIST_TraceOpName(Operation),
+                    SLIST_TraceOpName((SLIST_TraceOp_t)Record.Operation));
+  CuAssertTrue(Test_p, Record.ListId == (uint64_t)(uintptr_t)List_p);
+  CuAssertTrue(Test_p, Record.OtherId == (uint64_t)(uintptr_t)Other_p);
+  CuAssertTrue(Test_p, Record.Position == Position);
+  CuAssertTrue(Test_p, Record.First == First);
+  CuAssertTrue(Test_p, Record.Count == Count);
+}
+
+// The trace is only recorded when slist.c is built with SLIST_TRACE
+static void
+TestRecordAndRead(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_TraceReader_t Reader;
+  SLIST_TraceRecord_t Record;
+  int Data[] = { 10, 20, 30 };
+  int Missing = 40;
+
+  if (!SLIST_TraceStart(TRACE_FILE))
+  {
+    CuAssertTrue(Test_p, !SLIST_TraceIsActive());
+    return;
+  }
+  CuAssertTrue(Test_p, SLIST_TraceIsActive());
+
+  SLIST_Create(&List);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_InsertLast(&List, &Data[1]);
+  SLIST_InsertFirst(&List, &Data[0]);
+  SLIST_InsertSorted(&List, &Data[2]);
+  SLIST_Find(&List, &Data[2]);
+  SLIST_Find(&List, &Missing);
+  SLIST_RemoveSpecific(&List, &Data[1]);
+  SLIST_RemoveSpecific(&List, &Missing);
+  SLIST_RemoveLast(&List);
+  SLIST_RemoveFirst(&List);
+  SLIST_Destroy(&List);
+  SLIST_TraceStop();
+  CuAssertTrue(Test_p, !SLIST_TraceIsActive());
+
+  // Operations after the stop are not recorded
+  SLIST_Create(&List);
+  SLIST_Destroy(&List);
+
+  CuAssertTrue(Test_p, SLIST_TraceOpen(&Reader, TRACE_FILE));
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_CREATE, &List, 0, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_INSERT_LAST, &List, 20, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_INSERT_FIRST, &List, 10, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_INSERT_SORTED, &List, 30, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_FIND, &List, 30, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_FIND, &List, 40, false);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_REMOVE_SPECIFIC, &List, 20, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_REMOVE_SPECIFIC, &List, 40, false);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_REMOVE_LAST, &List, 30, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_REMOVE_FIRST, &List, 10, true);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_DESTROY, &List, 0, true);
+  CuAssertTrue(Test_p, !SLIST_TraceNext(&Reader, &Record));
+  SLIST_TraceClose(&Reader);
+  remove(TRACE_FILE);
+}
+
+static void
+TestBatchesAndConcat(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Other;
+  SLIST_TraceReader_t Reader;
+  SLIST_TraceRecord_t Record;
+  int Data[] = { 1, 2, 3 };
+  void* Batch[] = { &Data[0], &Data[1], &Data[2] };
+  void* Removed[3];
+
+  SLIST_Create(&List);
+  SLIST_Create(&Other);
+  if (!SLIST_TraceStart(TRACE_FILE))
+  {
+    SLIST_Destroy(&List);
+    SLIST_Destroy(&Other);
+    return;
+  }
+
+  // Without a hash function the key is the address of the data
+  SLIST_InsertLastBatch(&List, Batch, 3);
+  CuAssertIntEquals(Test_p, 2, (int)SLIST_RemoveFirstBatch(&List, Removed, 2));
+  SLIST_Concat(&Other, &List);
+  SLIST_TraceStop();
+
+  CuAssertTrue(Test_p, SLIST_TraceOpen(&Reader, TRACE_FILE));
+  for (int i = 0; i < 3; i++)
+  {
+    AssertRecord(Test_p, &Reader, SLIST_TRACE_INSERT_LAST, &List,
+                 (uint64_t)(uintptr_t)&Data[i], true);
+  }
+  for (int i = 0; i < 2; i++)
+  {
+    AssertRecord(Test_p, &Reader, SLIST_TRACE_REMOVE_FIRST, &List,
+                 (uint64_t)(uintptr_t)&Data[i], true);
+  }
+  AssertMove(Test_p, &Reader, SLIST_TRACE_CONCAT, &Other, &List, 0, 0, 0);
+  CuAssertTrue(Test_p, !SLIST_TraceNext(&Reader, &Record));
+  SLIST_TraceClose(&Reader);
+  remove(TRACE_FILE);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Other);
+}
+
+static void
+TestMovesBetweenLists(CuTest* Test_p)
+{
+  SLIST_List_t List;
+  SLIST_List_t Other;
+  SLIST_TraceReader_t Reader;
+  SLIST_TraceRecord_t Record;
+  int Missing = 2;
+
+  SLIST_Create(&List);
+  SLIST_Create(&Other);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetHashFunction(&List, DataHashInt);
+  SLIST_SetCompareFunction(&Other, DataCompareInt);
+  if (!SLIST_TraceStart(TRACE_FILE))
+  {
+    SLIST_Destroy(&List);
+    SLIST_Destroy(&Other);
+    return;
+  }
+
+  // Every call is recorded with its arguments, even if it moves nothing
+  SLIST_SplitAt(&List, 7, &Other);
+  SLIST_SplitAfter(&List, &Missing, &Other);
+  SLIST_SpliceRange(&List, 1, &Other, 2, 3);
+  SLIST_Merge(&List, &Other);
+  SLIST_Compact(&List);
+  SLIST_TraceStop();
+
+  CuAssertTrue(Test_p, SLIST_TraceOpen(&Reader, TRACE_FILE));
+  AssertMove(Test_p, &Reader, SLIST_TRACE_SPLIT_AT, &List, &Other, 7, 0, 0);
+  AssertMove(Test_p, &Reader, SLIST_TRACE_SPLIT_AFTER, &List, &Other, 0, 0, 0);
+  AssertMove(Test_p, &Reader, SLIST_TRACE_SPLICE_RANGE, &List, &Other, 1, 2, 3);
+  AssertMove(Test_p, &Reader, SLIST_TRACE_MERGE, &List, &Other, 0, 0, 0);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_COMPACT, &List, 0, true);
+  CuAssertTrue(Test_p, !SLIST_TraceNext(&Reader, &Record));
+  SLIST_TraceClose(&Reader);
+
+  // SplitAfter() keeps the key it searched for and whether it was found
+  CuAssertTrue(Test_p, SLIST_TraceOpen(&Reader, TRACE_FILE));
+  SLIST_TraceNext(&Reader, &Record);
+  AssertRecord(Test_p, &Reader, SLIST_TRACE_SPLIT_AFTER, &List, 2, false);
+  SLIST_TraceClose(&Reader);
+  remove(TRACE_FILE);
+
+  SLIST_Destroy(&List);
+  SLIST_Destroy(&Other);
+}
+
+static void
+TestOpenRejectsOtherFiles(CuTest* Test_p)
+{
+  SLIST_TraceReader_t Reader;
+
+  CuAssertTrue(Test_p, !SLIST_TraceOpen(&Reader, "no/such/" TRACE_FILE));
+
+  FILE* File_p = fopen(TRACE_FILE, "wb");
+  CuAssertPtrNotNull(Test_p, File_p);
+  fputs("not a trace, but long enough for a header", File_p);
+  fclose(File_p);
+  CuAssertTrue(Test_p, !SLIST_TraceOpen(&Reader, TRACE_FILE));
+  CuAssertPtrEquals(Test_p, NULL, Reader.File_p);
+  remove(TRACE_FILE);
+}
+
+
+static CuSuite*
+Get_SLIST_TRACE_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestRecordAndRead);
+  SUITE_ADD_TEST(Suite_p, TestBatchesAndConcat);
+  SUITE_ADD_TEST(Suite_p, TestMovesBetweenLists);
+  SUITE_ADD_TEST(Suite_p, TestOpenRejectsOtherFiles);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef SLIST_TRACE_TEST_H
+#define SLIST_TRACE_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_TRACE_Tests(void);
+
+
+#endif // SLIST_TRACE_TEST_H
@@ -0,0 +1,301 @@
+#ifndef SLIST_TYPED_H
+#define SLIST_TYPED_H
+
+/*
+ * Type-specialized Singly Linked List
+ *
+ * SLIST_DEFINE(Name, T, Compare) generates a list type Name_List_t whose
+ * nodes hold a T by value, together with its functions Name_Create(),
+ * Name_InsertLast() and so on. There is no void* and no callback: the data
+ * lives in the node, so an element costs one allocation instead of two, and
+ * Compare is called directly, so the compiler can inline it.
+ *
+ * Compare is a function or function-like macro taking two const T* and
+ * returning less than, equal to or greater than zero, like the callbacks of
+ * SLIST_SetCompareFunction(). Elements are copied in and out by assignment.
+ *
+ * Place SLIST_DEFINE at file scope, once per translation unit and type:
+ *
+ *   static inline int ComparePoint(const Point_t* A_p, const Point_t* B_p);
+ *   SLIST_DEFINE(POINTLIST, Point_t, ComparePoint)
+ *
+ *   POINTLIST_List_t List;
+ *   POINTLIST_Create(&List);
+ *   POINTLIST_InsertLast(&List, (Point_t){ 1, 2 });
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "nodepool.h"
+
+
+/* > Defines ******************************************************************/
+
+//
+// Visits every element of a list generated by SLIST_DEFINE(Name, ...) in
+// order, with Variable pointing at the element inside its node. Variable must
+// be a plain pointer variable declared by the caller.
+//
+#define SLIST_TYPED_FOREACH(Name, Variable, List_p)                                 \
+  for (Name##_Node_t* Variable##_Node_p = (List_p)->Head_p;                         \
+       Variable##_Node_p != NULL && ((Variable) = &Variable##_Node_p->Data, 1);     \
+       Variable##_Node_p = Variable##_Node_p->Next_p)
+
+//
+// Generates the list type Name_List_t and its functions for elements of
+// type T ordered by Compare
+//
+#define SLIST_DEFINE(Name, T, Compare)                                              \
+/* Node and List Definition */                                                      \
+typedef struct Name##_Node                                                          \
+{                                                                                   \
+  T                   Data;                                                         \
+  struct Name##_Node* Next_p;                                                       \
+} Name##_Node_t;                                                                    \
+                                                                                    \
+typedef struct Name##_List                                                          \
+{                                                                                   \
+  Name##_Node_t*   Head_p;                                                          \
+  Name##_Node_t*   Tail_p;                                                          \
+  NODEPOOL_Pool_t* Pool_p;                                                          \
+  size_t           Length;                                                          \
+} Name##_List_t;                                                                    \
+                                                                                    \
+static inline Name##_Node_t*                                                        \
+Name##_AllocNode(Name##_List_t *const List_p)                                       \
+{                                                                                   \
+  if (List_p->Pool_p != NULL)                                                       \
+  {                                                                                 \
+    return NODEPOOL_Alloc(List_p->Pool_p);                                          \
+  }                                                                                 \
+  return malloc(sizeof(Name##_Node_t));                                             \
+}                                                                                   \
+                                                                                    \
+static inline void                                                                  \
+Name##_FreeNode(Name##_List_t *const List_p, Name##_Node_t *const Node_p)           \
+{                                                                                   \
+  if (List_p->Pool_p != NULL)                                                       \
+  {                                                                                 \
+    NODEPOOL_Free(List_p->Pool_p, Node_p);                                          \
+  }                                                                                 \
+  else                                                                              \
+  {                                                                                 \
+    free(Node_p);                                                                   \
+  }                                                                                 \
+}                                                                                   \
+                                                                                    \
+/* Creates an empty list whose nodes are allocated one by one */                    \
+static inline void                                                                  \
+Name##_Create(Name##_List_t *const List_p)                                          \
+{                                                                                   \
+  List_p->Head_p = NULL;                                                            \
+  List_p->Tail_p = NULL;                                                            \
+  List_p->Pool_p = NULL;                                                            \
+  List_p->Length = 0;                                                               \
+}                                                                                   \
+                                                                                    \
+/* Creates an empty list whose nodes come from a node pool, see                     \
+   SLIST_CreateWithPool() */                                                        \
+static inline void                                                                  \
+Name##_CreateWithPool(Name##_List_t *const List_p, size_t NodesPerSlab)             \
+{                                                                                   \
+  Name##_Create(List_p);                                                            \
+  List_p->Pool_p = malloc(sizeof(NODEPOOL_Pool_t));                                 \
+  NODEPOOL_Create(List_p->Pool_p, sizeof(Name##_Node_t), NodesPerSlab);             \
+}                                                                                   \
+                                                                                    \
+/* Frees all nodes; the elements need no destruction */                             \
+static inline void                                                                  \
+Name##_Destroy(Name##_List_t *const List_p)                                         \
+{                                                                                   \
+  if (List_p->Pool_p != NULL)                                                       \
+  {                                                                                 \
+    NODEPOOL_Destroy(List_p->Pool_p);                                               \
+    free(List_p->Pool_p);                                                           \
+    List_p->Pool_p = NULL;                                                          \
+  }                                                                                 \
+  else                                                                              \
+  {                                                                                 \
+    Name##_Node_t* free_p = List_p->Head_p;                                         \
+    while (free_p != NULL)                                                          \
+    {                                                                               \
+      Name##_Node_t* next_p = free_p->Next_p;                                       \
+      free(free_p);                                                                 \
+      free_p = next_p;                                                              \
+    }                                                                               \
+  }                                                                                 \
+  List_p->Head_p = NULL;                                                            \
+  List_p->Tail_p = NULL;                                                            \
+  List_p->Length = 0;                                                               \
+}                                                                                   \
+                                                                                    \
+static inline bool                                                                  \
+Name##_IsEmpty(const Name##_List_t *const List_p)                                   \
+{                                                                                   \
+  return (List_p->Head_p == NULL);                                                  \
+}                                                                                   \
+                                                                                    \
+static inline size_t                                                                \
+Name##_Length(const Name##_List_t *const List_p)                                    \
+{                                                                                   \
+  return List_p->Length;                                                            \
+}                                                                                   \
+                                                                                    \
+static inline void                                                                  \
+Name##_InsertFirst(Name##_List_t *const List_p, T Data)                             \
+{                                                                                   \
+  Name##_Node_t* newNode = Name##_AllocNode(List_p);                                \
+  newNode->Data = Data;                                                             \
+  newNode->Next_p = List_p->Head_p;                                                 \
+  if (List_p->Head_p == NULL)                                                       \
+  {                                                                                 \
+    List_p->Tail_p = newNode;                                                       \
+  }                                                                                 \
+  List_p->Head_p = newNode;                                                         \
+  List_p->Length++;                                                                 \
+}                                                                                   \
+                                                                                    \
+static inline void                                                                  \
+Name##_InsertLast(Name##_List_t *const List_p, T Data)                              \
+{                                                                                   \
+  Name##_Node_t* newNode = Name##_AllocNode(List_p);                                \
+  newNode->Data = Data;                                                             \
+  newNode->Next_p = NULL;                                                           \
+  if (List_p->Head_p == NULL)                                                       \
+  {                                                                                 \
+    List_p->Head_p = newNode;                                                       \
+  }                                                                                 \
+  else                                                                              \
+  {                                                                                 \
+    List_p->Tail_p->Next_p = newNode;                                               \
+  }                                                                                 \
+  List_p->Tail_p = newNode;                                                         \
+  List_p->Length++;                                                                 \
+}                                                                                   \
+                                                                                    \
+/* Removes the first element, which must exist, and returns it */                   \
+static inline T                                                                     \
+Name##_RemoveFirst(Name##_List_t *const List_p)                                     \
+{                                                                                   \
+  Name##_Node_t* remove_p = List_p->Head_p;                                         \
+  T Data = remove_p->Data;                                                          \
+  List_p->Head_p = remove_p->Next_p;                                                \
+  if (List_p->Head_p == NULL)                                                       \
+  {                                                                                 \
+    List_p->Tail_p = NULL;                                                          \
+  }                                                                                 \
+  Name##_FreeNode(List_p, remove_p);                                                \
+  List_p->Length--;                                                                 \
+  return Data;                                                                      \
+}                                                                                   \
+                                                                                    \
+/* Removes the last element and copies it to *Removed_p unless Removed_p is         \
+   NULL. Returns false if the list is empty. Walks to the node before the           \
+   tail, as SLIST_RemoveLast() does without an index. */                            \
+static inline bool                                                                  \
+Name##_RemoveLast(Name##_List_t *const List_p, T *const Removed_p)                  \
+{                                                                                   \
+  Name##_Node_t* remove_p = List_p->Tail_p;                                         \
+  if (remove_p == NULL)                                                             \
+  {                                                                                 \
+    return false;                                                                   \
+  }                                                                                 \
+                                                                                    \
+  if (List_p->Head_p == remove_p)                                                   \
+  {                                                                                 \
+    List_p->Head_p = NULL;                                                          \
+    List_p->Tail_p = NULL;                                                          \
+  }                                                                                 \
+  else                                                                              \
+  {                                                                                 \
+    Name##_Node_t* previous_p = List_p->Head_p;                                     \
+    while (previous_p->Next_p != remove_p)                                          \
+    {                                                                               \
+      previous_p = previous_p->Next_p;                                              \
+    }                                                                               \
+    previous_p->Next_p = NULL;                                                      \
+    List_p->Tail_p = previous_p;                                                    \
+  }                                                                                 \
+  if (Removed_p != NULL)                                                            \
+  {                                                                                 \
+    *Removed_p = remove_p->Data;                                                    \
+  }                                                                                 \
+  Name##_FreeNode(List_p, remove_p);                                                \
+  List_p->Length--;                                                                 \
+  return true;                                                                      \
+}                                                                                   \
+                                                                                    \
+/* Returns the first element equal to *SearchData_p, or NULL; the pointer           \
+   stays valid until the element is removed */                                      \
+static inline T*                                                                    \
+Name##_Find(Name##_List_t *const List_p, const T *const SearchData_p)               \
+{                                                                                   \
+  for (Name##_Node_t* node_p = List_p->Head_p; node_p != NULL; node_p = node_p->Next_p)\
+  {                                                                                 \
+    if (Compare(&node_p->Data, SearchData_p) == 0)                                  \
+    {                                                                               \
+      return &node_p->Data;                                                         \
+    }                                                                               \
+  }                                                                                 \
+  return NULL;                                                                      \
+}                                                                                   \
+                                                                                    \
+/* Removes the first element equal to *SearchData_p and copies it to                \
+   *Removed_p unless Removed_p is NULL. Returns false if there is none. */          \
+static inline bool                                                                  \
+Name##_RemoveSpecific(Name##_List_t *const List_p,                                  \
+                      const T *const SearchData_p,                                  \
+                      T *const Removed_p)                                           \
+{                                                                                   \
+  Name##_Node_t* previous_p = NULL;                                                 \
+  Name##_Node_t* current_p = List_p->Head_p;                                        \
+  while (current_p != NULL && Compare(&current_p->Data, SearchData_p) != 0)         \
+  {                                                                                 \
+    previous_p = current_p;                                                         \
+    current_p = current_p->Next_p;                                                  \
+  }                                                                                 \
+  if (current_p == NULL)                                                            \
+  {                                                                                 \
+    return false;                                                                   \
+  }                                                                                 \
+                                                                                    \
+  if (previous_p == NULL)                                                           \
+  {                                                                                 \
+    List_p->Head_p = current_p->Next_p;                                             \
+  }                                                                                 \
+  else                                                                              \
+  {                                                                                 \
+    previous_p->Next_p = current_p->Next_p;                                         \
+  }                                                                                 \
+  if (current_p == List_p->Tail_p)                                                  \
+  {                                                                                 \
+    List_p->Tail_p = previous_p;                                                    \
+  }                                                                                 \
+  if (Removed_p != NULL)                                                            \
+  {                                                                                 \
+    *Removed_p = current_p->Data;                                                   \
+  }                                                                                 \
+  Name##_FreeNode(List_p, current_p);                                               \
+  List_p->Length--;                                                                 \
+  return true;                                                                      \
+}
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+#endif // SLIST_TYPED_H
@@ -0,0 +1,206 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "slist_typed.h"
+#include "slist_typed_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define LIST_SIZE    100000
+#define SCAN_ROUNDS  100
+
+#define COMPARE_INT(A_p, B_p)  ((*(A_p) > *(B_p)) - (*(A_p) < *(B_p)))
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct Point
+{
+  int    Id;
+  double X;
+  double Y;
+} Point_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static inline int
+ComparePointId(const Point_t* Point1_p, const Point_t* Point2_p);
+
+SLIST_DEFINE(INTLIST, int, COMPARE_INT)
+
+SLIST_DEFINE(POINTLIST, Point_t, ComparePointId)
+
+static void
+BenchInt(void);
+
+static void
+BenchPoint(void);
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p);
+
+static int
+DataComparePoint(const void* const Data1_p, const void* const Data2_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_TYPED_Benchmarks(void)
+{
+  printf("Typed list vs void* list, N=%d\n", LIST_SIZE);
+  BenchInt();
+  BenchPoint();
+  printf("\n");
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static inline int
+ComparePointId(const Point_t* Point1_p, const Point_t* Point2_p)
+{
+  return COMPARE_INT(&Point1_p->Id, &Point2_p->Id);
+}
+
+static int
+DataCompareInt(const void* const Data1_p, const void* const Data2_p)
+{
+  return COMPARE_INT((const int*)Data1_p, (const int*)Data2_p);
+}
+
+static int
+DataComparePoint(const void* const Data1_p, const void* const Data2_p)
+{
+  return ComparePointId(Data1_p, Data2_p);
+}
+
+//
+// Both lists take their nodes from a pool, so the differences are the
+// separate allocation of every element and the call through DataCompare_fp.
+// The scans search for a missing element and thus visit the whole list.
+//
+
+static void
+BenchInt(void)
+{
+  SLIST_List_t List;
+  INTLIST_List_t Typed;
+  int Missing = -1;
+  volatile long Sink = 0;
+
+  uint64_t Start = BENCH_Now();
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataCompareInt);
+  SLIST_SetDestroyFunction(&List, free);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    int* Data_p = malloc(sizeof(int));
+    *Data_p = i;
+    SLIST_InsertLast(&List, Data_p);
+  }
+  BENCH_Report("Build/void*/int", LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  INTLIST_CreateWithPool(&Typed, 0);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    INTLIST_InsertLast(&Typed, i);
+  }
+  BENCH_Report("Build/typed/int", LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    Sink += (SLIST_RemoveSpecific(&List, &Missing) != NULL);
+  }
+  BENCH_Report("RemoveSpecific(miss)/void*/int", SCAN_ROUNDS * LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    Sink += INTLIST_RemoveSpecific(&Typed, &Missing, NULL);
+  }
+  BENCH_Report("RemoveSpecific(miss)/typed/int", SCAN_ROUNDS * LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  SLIST_Destroy(&List);
+  BENCH_Report("Destroy/void*/int", LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  INTLIST_Destroy(&Typed);
+  BENCH_Report("Destroy/typed/int", LIST_SIZE, BENCH_Now() - Start);
+
+  (void)Sink;
+}
+
+static void
+BenchPoint(void)
+{
+  SLIST_List_t List;
+  POINTLIST_List_t Typed;
+  Point_t Missing = { -1, 0.0, 0.0 };
+  volatile long Sink = 0;
+
+  uint64_t Start = BENCH_Now();
+  SLIST_CreateWithPool(&List, 0);
+  SLIST_SetCompareFunction(&List, DataComparePoint);
+  SLIST_SetDestroyFunction(&List, free);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    Point_t* Data_p = malloc(sizeof(Point_t));
+    *Data_p = (Point_t){ i, i * 0.5, i * 2.0 };
+    SLIST_InsertLast(&List, Data_p);
+  }
+  BENCH_Report("Build/void*/point", LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  POINTLIST_CreateWithPool(&Typed, 0);
+  for (int i = 0; i < LIST_SIZE; i++)
+  {
+    POINTLIST_InsertLast(&Typed, (Point_t){ i, i * 0.5, i * 2.0 });
+  }
+  BENCH_Report("Build/typed/point", LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    Sink += (SLIST_RemoveSpecific(&List, &Missing) != NULL);
+  }
+  BENCH_Report("RemoveSpecific(miss)/void*/point", SCAN_ROUNDS * LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    Sink += POINTLIST_RemoveSpecific(&Typed, &Missing, NULL);
+  }
+  BENCH_Report("RemoveSpecific(miss)/typed/point", SCAN_ROUNDS * LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  SLIST_Destroy(&List);
+  BENCH_Report("Destroy/void*/point", LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  POINTLIST_Destroy(&Typed);
+  BENCH_Report("Destroy/typed/point", LIST_SIZE, BENCH_Now() - Start);
+
+  (void)Sink;
+}
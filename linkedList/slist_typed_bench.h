@@ -0,0 +1,26 @@
+#ifndef SLIST_TYPED_BENCH_H
+#define SLIST_TYPED_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_TYPED_Benchmarks(void);
+
+
+#endif // SLIST_TYPED_BENCH_H
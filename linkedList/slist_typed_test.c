@@ -0,0 +1,275 @@
+/* > Includes *****************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "slist_typed.h"
+#include "slist_typed_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define COMPARE_INT(A_p, B_p)  ((*(A_p) > *(B_p)) - (*(A_p) < *(B_p)))
+
+
+/* > Type Declarations  *******************************************************/
+
+typedef struct Point
+{
+  int    Id;
+  double X;
+  double Y;
+} Point_t;
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static inline int
+ComparePointId(const Point_t* Point1_p, const Point_t* Point2_p);
+
+SLIST_DEFINE(INTLIST, int, COMPARE_INT)
+
+SLIST_DEFINE(POINTLIST, Point_t, ComparePointId)
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p);
+
+static void
+TestInsertRemoveFirst(CuTest* Test_p);
+
+static void
+TestRemoveSpecific(CuTest* Test_p);
+
+static void
+TestRemoveLast(CuTest* Test_p);
+
+static void
+TestStructPayload(CuTest* Test_p);
+
+static void
+TestPool(CuTest* Test_p);
+
+static CuSuite*
+Get_SLIST_TYPED_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_SLIST_TYPED_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_SLIST_TYPED_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static inline int
+ComparePointId(const Point_t* Point1_p, const Point_t* Point2_p)
+{
+  return COMPARE_INT(&Point1_p->Id, &Point2_p->Id);
+}
+
+
+static void
+TestCreateDestroyEmptyList(CuTest* Test_p)
+{
+  INTLIST_List_t List;
+  int Missing = 1;
+
+  INTLIST_Create(&List);
+  CuAssertTrue(Test_p, INTLIST_IsEmpty(&List) == true);
+  CuAssertTrue(Test_p, INTLIST_Length(&List) == 0);
+  CuAssertPtrEquals(Test_p, NULL, INTLIST_Find(&List, &Missing));
+  CuAssertTrue(Test_p, INTLIST_RemoveSpecific(&List, &Missing, NULL) == false);
+  INTLIST_Destroy(&List);
+}
+
+
+static void
+TestInsertRemoveFirst(CuTest* Test_p)
+{
+  INTLIST_List_t List;
+
+  INTLIST_Create(&List);
+  INTLIST_InsertLast(&List, 2);
+  INTLIST_InsertLast(&List, 3);
+  INTLIST_InsertFirst(&List, 1);
+  CuAssertTrue(Test_p, INTLIST_Length(&List) == 3);
+
+  int* Number_p;
+  int Expected = 1;
+  SLIST_TYPED_FOREACH(INTLIST, Number_p, &List)
+  {
+    CuAssertIntEquals(Test_p, Expected, *Number_p);
+    Expected++;
+  }
+  CuAssertIntEquals(Test_p, 4, Expected);
+
+  CuAssertIntEquals(Test_p, 1, INTLIST_RemoveFirst(&List));
+  CuAssertIntEquals(Test_p, 2, INTLIST_RemoveFirst(&List));
+  CuAssertIntEquals(Test_p, 3, INTLIST_RemoveFirst(&List));
+  CuAssertTrue(Test_p, INTLIST_IsEmpty(&List) == true);
+  CuAssertPtrEquals(Test_p, NULL, List.Tail_p);
+
+  // The list is usable again after it was drained
+  INTLIST_InsertLast(&List, 4);
+  CuAssertPtrEquals(Test_p, List.Head_p, List.Tail_p);
+
+  INTLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveSpecific(CuTest* Test_p)
+{
+  INTLIST_List_t List;
+  int Removed = 0;
+
+  INTLIST_Create(&List);
+  for (int i = 1; i <= 4; i++)
+  {
+    INTLIST_InsertLast(&List, i);
+  }
+
+  int Search = 2;
+  CuAssertTrue(Test_p, INTLIST_RemoveSpecific(&List, &Search, &Removed) == true);
+  CuAssertIntEquals(Test_p, 2, Removed);
+  Search = 4;
+  CuAssertTrue(Test_p, INTLIST_RemoveSpecific(&List, &Search, NULL) == true);
+  CuAssertIntEquals(Test_p, 3, List.Tail_p->Data);
+  Search = 1;
+  CuAssertTrue(Test_p, INTLIST_RemoveSpecific(&List, &Search, NULL) == true);
+  CuAssertTrue(Test_p, INTLIST_RemoveSpecific(&List, &Search, NULL) == false);
+  CuAssertIntEquals(Test_p, 3, List.Head_p->Data);
+  CuAssertTrue(Test_p, INTLIST_Length(&List) == 1);
+
+  INTLIST_Destroy(&List);
+}
+
+
+static void
+TestRemoveLast(CuTest* Test_p)
+{
+  INTLIST_List_t List;
+  int Removed = 0;
+
+  INTLIST_Create(&List);
+  CuAssertTrue(Test_p, INTLIST_RemoveLast(&List, &Removed) == false);
+  for (int i = 1; i <= 3; i++)
+  {
+    INTLIST_InsertLast(&List, i);
+  }
+
+  CuAssertTrue(Test_p, INTLIST_RemoveLast(&List, &Removed) == true);
+  CuAssertIntEquals(Test_p, 3, Removed);
+  CuAssertIntEquals(Test_p, 2, List.Tail_p->Data);
+  CuAssertPtrEquals(Test_p, NULL, List.Tail_p->Next_p);
+  CuAssertTrue(Test_p, INTLIST_RemoveLast(&List, NULL) == true);
+  CuAssertPtrEquals(Test_p, List.Head_p, List.Tail_p);
+  CuAssertTrue(Test_p, INTLIST_RemoveLast(&List, &Removed) == true);
+  CuAssertIntEquals(Test_p, 1, Removed);
+  CuAssertTrue(Test_p, INTLIST_IsEmpty(&List) == true);
+  CuAssertPtrEquals(Test_p, NULL, List.Tail_p);
+  CuAssertTrue(Test_p, INTLIST_Length(&List) == 0);
+
+  // The list is usable again after it was drained from the back
+  INTLIST_InsertLast(&List, 4);
+  CuAssertPtrEquals(Test_p, List.Head_p, List.Tail_p);
+
+  INTLIST_Destroy(&List);
+}
+
+
+static void
+TestStructPayload(CuTest* Test_p)
+{
+  POINTLIST_List_t List;
+
+  POINTLIST_Create(&List);
+  POINTLIST_InsertLast(&List, (Point_t){ 1, 1.5, 2.5 });
+  POINTLIST_InsertLast(&List, (Point_t){ 2, 3.5, 4.5 });
+
+  // Elements are found by the fields the comparator looks at only
+  Point_t Search = { 2, 0.0, 0.0 };
+  Point_t* Found_p = POINTLIST_Find(&List, &Search);
+  CuAssertPtrNotNull(Test_p, Found_p);
+  CuAssertDblEquals(Test_p, 3.5, Found_p->X, 0.0);
+
+  // The element is stored by value and can be updated in place
+  Found_p->Y = 9.0;
+  Point_t Removed = { 0 };
+  CuAssertTrue(Test_p, POINTLIST_RemoveSpecific(&List, &Search, &Removed) == true);
+  CuAssertDblEquals(Test_p, 9.0, Removed.Y, 0.0);
+  CuAssertIntEquals(Test_p, 1, POINTLIST_RemoveFirst(&List).Id);
+
+  POINTLIST_Destroy(&List);
+}
+
+
+static void
+TestPool(CuTest* Test_p)
+{
+  INTLIST_List_t List;
+
+  INTLIST_CreateWithPool(&List, 4);
+  for (int i = 0; i < 10; i++)
+  {
+    INTLIST_InsertLast(&List, i);
+  }
+  CuAssertIntEquals(Test_p, 0, INTLIST_RemoveFirst(&List));
+
+  // A released node is handed out again by the next insert; its address is
+  // kept as an integer as the pointer is dangling in between
+  uintptr_t Head = (uintptr_t)List.Head_p;
+  INTLIST_RemoveFirst(&List);
+  INTLIST_InsertFirst(&List, 1);
+  CuAssertTrue(Test_p, Head == (uintptr_t)List.Head_p);
+  CuAssertTrue(Test_p, INTLIST_Length(&List) == 9);
+
+  INTLIST_Destroy(&List);
+  CuAssertPtrEquals(Test_p, NULL, List.Pool_p);
+}
+
+
+static CuSuite*
+Get_SLIST_TYPED_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyEmptyList);
+  SUITE_ADD_TEST(Suite_p, TestInsertRemoveFirst);
+  SUITE_ADD_TEST(Suite_p, TestRemoveSpecific);
+  SUITE_ADD_TEST(Suite_p, TestRemoveLast);
+  SUITE_ADD_TEST(Suite_p, TestStructPayload);
+  SUITE_ADD_TEST(Suite_p, TestPool);
+
+  return Suite_p;
+}
@@ -0,0 +1,26 @@
+#ifndef SLIST_TYPED_TEST_H
+#define SLIST_TYPED_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_SLIST_TYPED_Tests(void);
+
+
+#endif // SLIST_TYPED_TEST_H
@@ -0,0 +1,156 @@
+/* > Includes *****************************************************************/
+#include "threadpool.h"
+#include <stdlib.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void*
+WorkerMain(void* Argument_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+THREADPOOL_Create(THREADPOOL_Pool_t *const Pool_p, size_t ThreadCount)
+{
+  pthread_mutex_init(&Pool_p->Lock, NULL);
+  pthread_cond_init(&Pool_p->WorkReady, NULL);
+  pthread_cond_init(&Pool_p->WorkDone, NULL);
+  Pool_p->Head_p = NULL;
+  Pool_p->Tail_p = NULL;
+  Pool_p->Pending = 0;
+  Pool_p->Stopping = false;
+  Pool_p->ThreadCount = (ThreadCount > 0) ? ThreadCount : 1;
+  Pool_p->Threads_p = malloc(sizeof(pthread_t) * Pool_p->ThreadCount);
+
+  for (size_t i = 0; i < Pool_p->ThreadCount; i++)
+  {
+    pthread_create(&Pool_p->Threads_p[i], NULL, WorkerMain, Pool_p);
+  }
+}
+
+void
+THREADPOOL_Destroy(THREADPOOL_Pool_t *const Pool_p)
+{
+  THREADPOOL_Wait(Pool_p);
+
+  pthread_mutex_lock(&Pool_p->Lock);
+  Pool_p->Stopping = true;
+  pthread_cond_broadcast(&Pool_p->WorkReady);
+  pthread_mutex_unlock(&Pool_p->Lock);
+
+  for (size_t i = 0; i < Pool_p->ThreadCount; i++)
+  {
+    pthread_join(Pool_p->Threads_p[i], NULL);
+  }
+  free(Pool_p->Threads_p);
+  Pool_p->Threads_p = NULL;
+
+  pthread_cond_destroy(&Pool_p->WorkDone);
+  pthread_cond_destroy(&Pool_p->WorkReady);
+  pthread_mutex_destroy(&Pool_p->Lock);
+}
+
+size_t
+THREADPOOL_ThreadCount(const THREADPOOL_Pool_t *const Pool_p)
+{
+  return Pool_p->ThreadCount;
+}
+
+void
+THREADPOOL_Submit(THREADPOOL_Pool_t *const Pool_p,
+                  THREADPOOL_Job_t Job_fp,
+                  void *const Argument_p)
+{
+  THREADPOOL_Task_t* task_p = malloc(sizeof(THREADPOOL_Task_t));
+  task_p->Job_fp = Job_fp;
+  task_p->Argument_p = Argument_p;
+  task_p->Next_p = NULL;
+
+  pthread_mutex_lock(&Pool_p->Lock);
+  if (Pool_p->Tail_p == NULL)
+  {
+    Pool_p->Head_p = task_p;
+  }
+  else
+  {
+    Pool_p->Tail_p->Next_p = task_p;
+  }
+  Pool_p->Tail_p = task_p;
+  Pool_p->Pending++;
+  pthread_cond_signal(&Pool_p->WorkReady);
+  pthread_mutex_unlock(&Pool_p->Lock);
+}
+
+void
+THREADPOOL_Wait(THREADPOOL_Pool_t *const Pool_p)
+{
+  pthread_mutex_lock(&Pool_p->Lock);
+  while (Pool_p->Pending > 0)
+  {
+    pthread_cond_wait(&Pool_p->WorkDone, &Pool_p->Lock);
+  }
+  pthread_mutex_unlock(&Pool_p->Lock);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+// Takes jobs from the queue until the pool is stopped. Pending counts queued
+// and running jobs, so THREADPOOL_Wait() also waits for the running ones.
+static void*
+WorkerMain(void* Argument_p)
+{
+  THREADPOOL_Pool_t* pool_p = Argument_p;
+
+  pthread_mutex_lock(&pool_p->Lock);
+  for (;;)
+  {
+    while (pool_p->Head_p == NULL && !pool_p->Stopping)
+    {
+      pthread_cond_wait(&pool_p->WorkReady, &pool_p->Lock);
+    }
+    if (pool_p->Head_p == NULL)
+    {
+      break;
+    }
+
+    THREADPOOL_Task_t* task_p = pool_p->Head_p;
+    pool_p->Head_p = task_p->Next_p;
+    if (pool_p->Head_p == NULL)
+    {
+      pool_p->Tail_p = NULL;
+    }
+    pthread_mutex_unlock(&pool_p->Lock);
+
+    task_p->Job_fp(task_p->Argument_p);
+    free(task_p);
+
+    pthread_mutex_lock(&pool_p->Lock);
+    if (--pool_p->Pending == 0)
+    {
+      pthread_cond_broadcast(&pool_p->WorkDone);
+    }
+  }
+  pthread_mutex_unlock(&pool_p->Lock);
+  return NULL;
+}
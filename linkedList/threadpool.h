@@ -0,0 +1,145 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+/*
+ * Thread Pool
+ *
+ * Fixed number of worker threads that run jobs from a shared FIFO queue. Jobs
+ * are submitted by one controlling thread, which then waits until all of them
+ * have finished. Used by the parallel list operations in slist_parallel.h.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Job Function, called on a worker thread with the argument it was submitted
+// with
+//
+
+typedef void (*THREADPOOL_Job_t)(void* const Argument_p);
+
+
+//
+// Queued Job
+//
+
+typedef struct THREADPOOL_Task
+{
+  THREADPOOL_Job_t        Job_fp;
+  void*                   Argument_p;
+  struct THREADPOOL_Task* Next_p;
+} THREADPOOL_Task_t;
+
+
+//
+// Pool Definition
+//
+
+typedef struct THREADPOOL_Pool
+{
+  pthread_t*         Threads_p;
+  size_t             ThreadCount;
+  pthread_mutex_t    Lock;
+  pthread_cond_t     WorkReady;
+  pthread_cond_t     WorkDone;
+  THREADPOOL_Task_t* Head_p;
+  THREADPOOL_Task_t* Tail_p;
+  size_t             Pending;
+  bool               Stopping;
+} THREADPOOL_Pool_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a thread pool
+ *
+ * Starts ThreadCount worker threads that wait for jobs.
+ *
+ * @param[in]     Pool_p       The pool to be initialized.
+ * @param[in]     ThreadCount  Number of worker threads, at least 1.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+THREADPOOL_Create(THREADPOOL_Pool_t *const Pool_p, size_t ThreadCount);
+
+
+/**
+ * @brief Destroys a thread pool
+ *
+ * Waits for all submitted jobs to finish, then stops and joins the worker
+ * threads.
+ *
+ * @param[in]     Pool_p  The pool to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+THREADPOOL_Destroy(THREADPOOL_Pool_t *const Pool_p);
+
+
+/**
+ * @brief Returns the number of worker threads
+ *
+ * @param[in]     Pool_p  Pointer to the pool
+ * @return        Number of worker threads
+ *
+ ******************************************************************************/
+size_t
+THREADPOOL_ThreadCount(const THREADPOOL_Pool_t *const Pool_p);
+
+
+/**
+ * @brief Submits a job
+ *
+ * Queues the job behind all jobs submitted before. It runs on the first
+ * worker thread that becomes idle.
+ *
+ * @param[in]     Pool_p      Pointer to the pool
+ * @param[in]     Job_fp      The function to run
+ * @param[in]     Argument_p  The argument passed to the function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+THREADPOOL_Submit(THREADPOOL_Pool_t *const Pool_p,
+                  THREADPOOL_Job_t Job_fp,
+                  void *const Argument_p);
+
+
+/**
+ * @brief Waits for all jobs
+ *
+ * Returns once every job submitted so far has finished. Jobs may not submit
+ * further jobs.
+ *
+ * @param[in]     Pool_p  Pointer to the pool
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+THREADPOOL_Wait(THREADPOOL_Pool_t *const Pool_p);
+
+
+#endif // THREADPOOL_H
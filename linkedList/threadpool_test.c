@@ -0,0 +1,191 @@
+/* > Includes *****************************************************************/
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "CuTest.h"
+#include "threadpool.h"
+#include "threadpool_test.h"
+
+
+/* > Defines ******************************************************************/
+
+#define JOB_COUNT  1000
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+TestCreateDestroyIdlePool(CuTest* Test_p);
+
+static void
+TestRunsEveryJob(CuTest* Test_p);
+
+static void
+TestWaitCanBeRepeated(CuTest* Test_p);
+
+static void
+TestJobsRunOnWorkers(CuTest* Test_p);
+
+static CuSuite*
+Get_THREADPOOL_Suite(void);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_THREADPOOL_Tests(void)
+{
+  CuString* OutputText_p = CuStringNew();
+  CuSuite* TestSuite_p = CuSuiteNew();
+
+  CuSuiteAddSuite(TestSuite_p, Get_THREADPOOL_Suite());
+
+  CuSuiteRun(TestSuite_p);
+  CuSuiteSummary(TestSuite_p, OutputText_p);
+  CuSuiteDetails(TestSuite_p, OutputText_p);
+
+  printf("%s\n", OutputText_p->buffer);
+
+  CuSuiteDelete(TestSuite_p);
+  CuStringDelete(OutputText_p);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+CountJob(void* const Argument_p)
+{
+  atomic_fetch_add((atomic_int*)Argument_p, 1);
+}
+
+static void
+MarkJob(void* const Argument_p)
+{
+  *(int*)Argument_p += 1;
+}
+
+static void
+RecordThreadJob(void* const Argument_p)
+{
+  *(pthread_t*)Argument_p = pthread_self();
+}
+
+
+static void
+TestCreateDestroyIdlePool(CuTest* Test_p)
+{
+  THREADPOOL_Pool_t Pool;
+
+  THREADPOOL_Create(&Pool, 3);
+  CuAssertTrue(Test_p, THREADPOOL_ThreadCount(&Pool) == 3);
+  THREADPOOL_Wait(&Pool);
+  THREADPOOL_Destroy(&Pool);
+
+  // A pool has at least one thread
+  THREADPOOL_Create(&Pool, 0);
+  CuAssertTrue(Test_p, THREADPOOL_ThreadCount(&Pool) == 1);
+  THREADPOOL_Destroy(&Pool);
+}
+
+
+static void
+TestRunsEveryJob(CuTest* Test_p)
+{
+  THREADPOOL_Pool_t Pool;
+  atomic_int Count = 0;
+  int* Marks_p = calloc(JOB_COUNT, sizeof(int));
+
+  THREADPOOL_Create(&Pool, 4);
+  for (int i = 0; i < JOB_COUNT; i++)
+  {
+    THREADPOOL_Submit(&Pool, CountJob, &Count);
+    THREADPOOL_Submit(&Pool, MarkJob, &Marks_p[i]);
+  }
+  THREADPOOL_Wait(&Pool);
+
+  // Every job ran exactly once, and its effects are visible after the wait
+  CuAssertIntEquals(Test_p, JOB_COUNT, atomic_load(&Count));
+  for (int i = 0; i < JOB_COUNT; i++)
+  {
+    CuAssertIntEquals(Test_p, 1, Marks_p[i]);
+  }
+
+  THREADPOOL_Destroy(&Pool);
+  free(Marks_p);
+}
+
+
+static void
+TestWaitCanBeRepeated(CuTest* Test_p)
+{
+  THREADPOOL_Pool_t Pool;
+  atomic_int Count = 0;
+
+  THREADPOOL_Create(&Pool, 2);
+  for (int Round = 1; Round <= 10; Round++)
+  {
+    for (int i = 0; i < 10; i++)
+    {
+      THREADPOOL_Submit(&Pool, CountJob, &Count);
+    }
+    THREADPOOL_Wait(&Pool);
+    CuAssertIntEquals(Test_p, Round * 10, atomic_load(&Count));
+  }
+
+  // Destroy finishes jobs that nobody waited for
+  for (int i = 0; i < 10; i++)
+  {
+    THREADPOOL_Submit(&Pool, CountJob, &Count);
+  }
+  THREADPOOL_Destroy(&Pool);
+  CuAssertIntEquals(Test_p, 110, atomic_load(&Count));
+}
+
+
+static void
+TestJobsRunOnWorkers(CuTest* Test_p)
+{
+  THREADPOOL_Pool_t Pool;
+  pthread_t Thread = pthread_self();
+
+  THREADPOOL_Create(&Pool, 1);
+  THREADPOOL_Submit(&Pool, RecordThreadJob, &Thread);
+  THREADPOOL_Wait(&Pool);
+  CuAssertTrue(Test_p, pthread_equal(Thread, pthread_self()) == 0);
+  CuAssertTrue(Test_p, pthread_equal(Thread, Pool.Threads_p[0]) != 0);
+  THREADPOOL_Destroy(&Pool);
+}
+
+
+static CuSuite*
+Get_THREADPOOL_Suite(void)
+{
+  CuSuite* Suite_p = CuSuiteNew();
+
+  SUITE_ADD_TEST(Suite_p, TestCreateDestroyIdlePool);
+  SUITE_ADD_TEST(Suite_p, TestRunsEveryJob);
+  SUITE_ADD_TEST(Suite_p, TestWaitCanBeRepeated);
+  SUITE_ADD_TEST(Suite_p, TestJobsRunOnWorkers);
+
+  return Suite_p;
+}
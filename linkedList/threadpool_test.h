@@ -0,0 +1,26 @@
+#ifndef THREADPOOL_TEST_H
+#define THREADPOOL_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_THREADPOOL_Tests(void);
+
+
+#endif // THREADPOOL_TEST_H
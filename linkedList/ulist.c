@@ -0,0 +1,320 @@
+/* > Includes *****************************************************************/
+#include "ulist.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+
+/* > Local Function Declarations **********************************************/
+
+static ULIST_Node_t*
+NewNode(void);
+
+static void
+UnlinkNode(ULIST_List_t *const List_p,
+           ULIST_Node_t *const Previous_p,
+           ULIST_Node_t *const Node_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+ULIST_Create(ULIST_List_t *const List_p)
+{
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+  memset(&List_p->Callbacks, 0, sizeof(SLIST_Callbacks_t));
+}
+
+void
+ULIST_Destroy(ULIST_List_t *const List_p)
+{
+  ULIST_Node_t* node_p = List_p->Head_p;
+  while (node_p != NULL)
+  {
+    ULIST_Node_t* next_p = node_p->Next_p;
+    if (List_p->Callbacks.DataDestroy_fp != NULL)
+    {
+      for (unsigned int i = 0; i < node_p->Count; i++)
+      {
+        List_p->Callbacks.DataDestroy_fp(node_p->Data_p[i]);
+      }
+    }
+    free(node_p);
+    node_p = next_p;
+  }
+  List_p->Head_p = NULL;
+  List_p->Tail_p = NULL;
+}
+
+bool
+ULIST_IsEmpty(const ULIST_List_t *const List_p)
+{
+  return (List_p->Head_p == NULL);
+}
+
+size_t
+ULIST_Length(const ULIST_List_t *const List_p)
+{
+  size_t listLength = 0;
+  const ULIST_Node_t* node_p = List_p->Head_p;
+
+  while (node_p != NULL)
+  {
+    listLength += node_p->Count;
+    node_p = node_p->Next_p;
+  }
+  return listLength;
+}
+
+void
+ULIST_InsertFirst(ULIST_List_t *const List_p, const void *const Data_p)
+{
+  ULIST_Node_t* head_p = List_p->Head_p;
+
+  if (head_p == NULL || head_p->Count == ULIST_NODE_CAPACITY)
+  {
+    ULIST_Node_t* newNode = NewNode();
+    newNode->Next_p = head_p;
+    List_p->Head_p = newNode;
+    if (head_p == NULL)
+    {
+      List_p->Tail_p = newNode;
+    }
+    head_p = newNode;
+  }
+  else
+  {
+    memmove(&head_p->Data_p[1], &head_p->Data_p[0], head_p->Count * sizeof(void*));
+  }
+  head_p->Data_p[0] = (void*)Data_p;
+  head_p->Count++;
+}
+
+void
+ULIST_InsertLast(ULIST_List_t *const List_p, const void *const Data_p)
+{
+  ULIST_Node_t* tail_p = List_p->Tail_p;
+
+  if (tail_p == NULL || tail_p->Count == ULIST_NODE_CAPACITY)
+  {
+    ULIST_Node_t* newNode = NewNode();
+    if (tail_p == NULL)
+    {
+      List_p->Head_p = newNode;
+    }
+    else
+    {
+      tail_p->Next_p = newNode;
+    }
+    List_p->Tail_p = newNode;
+    tail_p = newNode;
+  }
+  tail_p->Data_p[tail_p->Count++] = (void*)Data_p;
+}
+
+void*
+ULIST_RemoveFirst(ULIST_List_t *const List_p)
+{
+  ULIST_Node_t* head_p = List_p->Head_p;
+  void* Data_p = head_p->Data_p[0];
+
+  head_p->Count--;
+  if (head_p->Count == 0)
+  {
+    UnlinkNode(List_p, NULL, head_p);
+  }
+  else
+  {
+    memmove(&head_p->Data_p[0], &head_p->Data_p[1], head_p->Count * sizeof(void*));
+  }
+  return Data_p;
+}
+
+void*
+ULIST_RemoveLast(ULIST_List_t *const List_p)
+{
+  ULIST_Node_t* tail_p = List_p->Tail_p;
+  void* Data_p = tail_p->Data_p[--tail_p->Count];
+
+  if (tail_p->Count == 0)
+  {
+    ULIST_Node_t* previous_p = NULL;
+    if (List_p->Head_p != tail_p)
+    {
+      previous_p = List_p->Head_p;
+      while (previous_p->Next_p != tail_p)
+      {
+        previous_p = previous_p->Next_p;
+      }
+    }
+    UnlinkNode(List_p, previous_p, tail_p);
+  }
+  return Data_p;
+}
+
+void*
+ULIST_RemoveSpecific(ULIST_List_t *const List_p, const void* const SearchData_p)
+{
+  ULIST_Node_t* previous_p = NULL;
+  ULIST_Node_t* node_p = List_p->Head_p;
+
+  while (node_p != NULL)
+  {
+    for (unsigned int i = 0; i < node_p->Count; i++)
+    {
+      if (List_p->Callbacks.DataCompare_fp(node_p->Data_p[i], SearchData_p) != 0)
+      {
+        continue;
+      }
+
+      void* Data_p = node_p->Data_p[i];
+      node_p->Count--;
+      memmove(&node_p->Data_p[i], &node_p->Data_p[i + 1],
+              (node_p->Count - i) * sizeof(void*));
+
+      ULIST_Node_t* next_p = node_p->Next_p;
+      if (node_p->Count == 0)
+      {
+        UnlinkNode(List_p, previous_p, node_p);
+      }
+      else if (node_p->Count < ULIST_NODE_CAPACITY / 2 &&
+               next_p != NULL &&
+               node_p->Count + next_p->Count <= ULIST_NODE_CAPACITY)
+      {
+        // Keep the nodes dense by absorbing the successor
+        memcpy(&node_p->Data_p[node_p->Count], &next_p->Data_p[0],
+               next_p->Count * sizeof(void*));
+        node_p->Count += next_p->Count;
+        UnlinkNode(List_p, node_p, next_p);
+      }
+      return Data_p;
+    }
+    previous_p = node_p;
+    node_p = node_p->Next_p;
+  }
+  return NULL;
+}
+
+void
+ULIST_Print(const ULIST_List_t *const List_p)
+{
+  const ULIST_Node_t* node_p = List_p->Head_p;
+  while (node_p != NULL)
+  {
+    for (unsigned int i = 0; i < node_p->Count; i++)
+    {
+      List_p->Callbacks.DataPrint_fp(node_p->Data_p[i]);
+    }
+    node_p = node_p->Next_p;
+  }
+}
+
+void
+ULIST_SetDestroyFunction(ULIST_List_t *const List_p, DataDestroy_t DataDestroy_fp)
+{
+  List_p->Callbacks.DataDestroy_fp = DataDestroy_fp;
+}
+
+void
+ULIST_SetPrintFunction(ULIST_List_t *const List_p, DataPrint_t DataPrint_fp)
+{
+  List_p->Callbacks.DataPrint_fp = DataPrint_fp;
+}
+
+void
+ULIST_SetCompareFunction(ULIST_List_t *const List_p, DataCompare_t DataCompare_fp)
+{
+  List_p->Callbacks.DataCompare_fp = DataCompare_fp;
+}
+
+//
+// ITERATOR
+//
+
+void
+ULIST_IteratorInit(ULIST_Iterator_t *const Iterator_p,
+                   const ULIST_List_t *const List_p)
+{
+  Iterator_p->List_p = List_p;
+  ULIST_IteratorReset(Iterator_p);
+}
+
+bool
+ULIST_IteratorHasNext(const ULIST_Iterator_t *const Iterator_p)
+{
+  return (Iterator_p->Node_p != NULL);
+}
+
+void*
+ULIST_IteratorGetNext(ULIST_Iterator_t *const Iterator_p)
+{
+  const ULIST_Node_t* node_p = Iterator_p->Node_p;
+  void* Data_p = node_p->Data_p[Iterator_p->Index++];
+
+  if (Iterator_p->Index == node_p->Count)
+  {
+    Iterator_p->Node_p = node_p->Next_p;
+    Iterator_p->Index = 0;
+  }
+  return Data_p;
+}
+
+void
+ULIST_IteratorReset(ULIST_Iterator_t *const Iterator_p)
+{
+  Iterator_p->Node_p = Iterator_p->List_p->Head_p;
+  Iterator_p->Index = 0;
+}
+
+/* > Local Function Definitions ***********************************************/
+
+static ULIST_Node_t*
+NewNode(void)
+{
+  ULIST_Node_t* newNode = malloc(sizeof(ULIST_Node_t));
+  newNode->Next_p = NULL;
+  newNode->Count = 0;
+  return newNode;
+}
+
+// Removes Node_p, which follows Previous_p (NULL for the head), from the list
+// and frees it
+static void
+UnlinkNode(ULIST_List_t *const List_p,
+           ULIST_Node_t *const Previous_p,
+           ULIST_Node_t *const Node_p)
+{
+  if (Previous_p == NULL)
+  {
+    List_p->Head_p = Node_p->Next_p;
+  }
+  else
+  {
+    Previous_p->Next_p = Node_p->Next_p;
+  }
+  if (List_p->Tail_p == Node_p)
+  {
+    List_p->Tail_p = Previous_p;
+  }
+  free(Node_p);
+}
@@ -0,0 +1,302 @@
+#ifndef ULIST_H
+#define ULIST_H
+
+/*
+ * Unrolled Linked List
+ *
+ * Every node stores up to ULIST_NODE_CAPACITY data pointers, so a traversal
+ * touches one node per ULIST_NODE_CAPACITY elements instead of one node per
+ * element. The list uses the same callbacks as the singly linked list.
+ *
+ */
+
+
+/* > Includes *****************************************************************/
+
+#include <stdbool.h>
+
+#include "slist.h"
+
+
+/* > Defines ******************************************************************/
+
+// Number of data pointers in a node; 8 pointers fill a 64 byte cache line
+// on 64-bit targets
+#define ULIST_NODE_CAPACITY  (64 / sizeof(void*))
+
+
+/* > Type Declarations ********************************************************/
+
+
+//
+// Node Definition
+//
+
+typedef struct ULIST_Node
+{
+  void*              Data_p[ULIST_NODE_CAPACITY];
+  struct ULIST_Node* Next_p;
+  unsigned int       Count;
+} ULIST_Node_t;
+
+
+//
+// List Definition
+//
+
+typedef struct ULIST_List
+{
+  SLIST_Callbacks_t Callbacks;
+  ULIST_Node_t*     Head_p;
+  ULIST_Node_t*     Tail_p;
+} ULIST_List_t;
+
+
+//
+// Data Iterator
+//
+
+typedef struct ULIST_Iterator
+{
+  const ULIST_List_t* List_p;
+  const ULIST_Node_t* Node_p;
+  unsigned int        Index;
+} ULIST_Iterator_t;
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+/**
+ * @brief Creates a new list
+ *
+ * Creates an unrolled linked list.
+ *
+ * @param[in]     List_p  The list to be initialized.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_Create(ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Destroys a list
+ *
+ * Destroys a list created by ULIST_Create() and frees all nodes. The data in
+ * the list is freed by the function set by ULIST_SetDestroyFunction(). If no
+ * destroy function is set, the data in the nodes is not freed.
+ *
+ * @param[in]     List_p  The list to be destroyed.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_Destroy(ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+ULIST_IsEmpty(const ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Calculates the number of elements in the list
+ *
+ * Sums up the element counts of the nodes, visiting one node per
+ * ULIST_NODE_CAPACITY elements at best.
+ *
+ * @param[in]     List_p Pointer to the list
+ * @return        Number of elements
+ *
+ ******************************************************************************/
+size_t
+ULIST_Length(const ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Inserts an item first in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_InsertFirst(ULIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Inserts an item last in the list
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @param[in]     Data_p  The data to insert
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_InsertLast(ULIST_List_t *const List_p, const void *const Data_p);
+
+
+/**
+ * @brief Removes the first item in the list.
+ *
+ * Does not de-allocate the data in the removed node; this data is returned and
+ * should be de-allocated manually.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+ULIST_RemoveFirst(ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes the last item in the list.
+ *
+ * Does not de-allocate the data in the removed node; this data is returned and
+ * should be de-allocated manually. The list is only traversed when the last
+ * node becomes empty.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        Pointer to the removed data
+ *
+ ******************************************************************************/
+void*
+ULIST_RemoveLast(ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Removes a specific item from the list
+ *
+ * Removes the first item in the list that is equal to SearchData_p, according
+ * to the comparison function. A node that drops below half capacity absorbs
+ * the elements of its successor when they fit.
+ * Does not de-allocate the removed data; this data is returned and should be
+ * de-allocated manually.
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     SearchData_p  The data to remove
+ * @return        Pointer to the removed data, or NULL if not found
+ *
+ ******************************************************************************/
+void*
+ULIST_RemoveSpecific(ULIST_List_t *const List_p, const void* const SearchData_p);
+
+
+/**
+ * @brief Print the list
+ *
+ * Calls the print function for the list for every element in the list.
+ *
+ * @param[in]     List_p  Pointer to the list
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_Print(const ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Sets destroy function for the list
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataDestroy_fp  Pointer to the destroy function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_SetDestroyFunction(ULIST_List_t *const List_p, DataDestroy_t DataDestroy_fp);
+
+
+/**
+ * @brief Sets print function for the list
+ *
+ * @param[in]     List_p        Pointer to the list
+ * @param[in]     DataPrint_fp  Pointer to the print function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_SetPrintFunction(ULIST_List_t *const List_p, DataPrint_t DataPrint_fp);
+
+
+/**
+ * @brief Sets comparison function for the list
+ *
+ * The function follows the same rules as for SLIST_SetCompareFunction().
+ *
+ * @param[in]     List_p          Pointer to the list
+ * @param[in]     DataCompare_fp  Pointer to the compare function
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_SetCompareFunction(ULIST_List_t *const List_p, DataCompare_t DataCompare_fp);
+
+
+/**
+ * @brief Initializes an iterator
+ *
+ * Initializes an iterator placed by the caller, typically on the stack. The
+ * iterator does not modify the list and needs no destruction.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @param[in]     List_p      The list to be iterated.
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_IteratorInit(ULIST_Iterator_t *const Iterator_p,
+                   const ULIST_List_t *const List_p);
+
+
+/**
+ * @brief Checks if the iterator has more elements
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        true/false
+ *
+ ******************************************************************************/
+bool
+ULIST_IteratorHasNext(const ULIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Returns the next element and advances the iterator
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        A pointer to the data of the current element
+ *
+ ******************************************************************************/
+void*
+ULIST_IteratorGetNext(ULIST_Iterator_t *const Iterator_p);
+
+
+/**
+ * @brief Resets the iterator
+ *
+ * Moves the iterator back to the first element of the list.
+ *
+ * @param[in]     Iterator_p  Pointer to the iterator
+ * @return        N/A
+ *
+ ******************************************************************************/
+void
+ULIST_IteratorReset(ULIST_Iterator_t *const Iterator_p);
+
+
+#endif // ULIST_H
@@ -0,0 +1,136 @@
+/* > Includes *****************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "slist.h"
+#include "ulist.h"
+#include "ulist_bench.h"
+
+
+/* > Defines ******************************************************************/
+
+#define SCAN_LIST_SIZE  1000000
+#define SCAN_ROUNDS     20
+
+
+/* > Type Declarations  *******************************************************/
+
+
+/* > Global Constant Definitions **********************************************/
+
+
+/* > Global Variable Definitions **********************************************/
+
+
+/* > Local Constant Definitions ***********************************************/
+
+
+/* > Local Variable Definitions ***********************************************/
+
+static size_t Visited;
+
+
+/* > Local Function Declarations **********************************************/
+
+static void
+CountPrint(const void* const Data_p);
+
+static int
+NeverEqual(const void* const Data1_p, const void* const Data2_p);
+
+
+/* > Global Function Definitions **********************************************/
+
+void
+Run_ULIST_Benchmarks(void)
+{
+  SLIST_List_t SList;
+  ULIST_List_t UList;
+  static int Data;
+  char Name[64];
+  uint64_t Start;
+
+  printf("Scans: singly linked vs unrolled (%zu pointers per node)\n",
+         (size_t)ULIST_NODE_CAPACITY);
+
+  SLIST_Create(&SList);
+  SLIST_SetPrintFunction(&SList, CountPrint);
+  SLIST_SetCompareFunction(&SList, NeverEqual);
+  ULIST_Create(&UList);
+  ULIST_SetPrintFunction(&UList, CountPrint);
+  ULIST_SetCompareFunction(&UList, NeverEqual);
+
+  for (size_t i = 0; i < SCAN_LIST_SIZE; i++)
+  {
+    SLIST_InsertLast(&SList, &Data);
+  }
+  for (size_t i = 0; i < SCAN_LIST_SIZE; i++)
+  {
+    ULIST_InsertLast(&UList, &Data);
+  }
+
+  // SLIST_Length() reads a kept count, so there is no scan to compare with;
+  // slist_ops_bench.c times it per call
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    Visited += ULIST_Length(&UList);
+  }
+  snprintf(Name, sizeof(Name), "Length/ulist/N=%d", SCAN_LIST_SIZE);
+  BENCH_Report(Name, (size_t)SCAN_ROUNDS * SCAN_LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    SLIST_Print(&SList);
+  }
+  snprintf(Name, sizeof(Name), "Print/slist/N=%d", SCAN_LIST_SIZE);
+  BENCH_Report(Name, (size_t)SCAN_ROUNDS * SCAN_LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    ULIST_Print(&UList);
+  }
+  snprintf(Name, sizeof(Name), "Print/ulist/N=%d", SCAN_LIST_SIZE);
+  BENCH_Report(Name, (size_t)SCAN_ROUNDS * SCAN_LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    SLIST_RemoveSpecific(&SList, &Data);
+  }
+  snprintf(Name, sizeof(Name), "RemoveSpecific(miss)/slist/N=%d", SCAN_LIST_SIZE);
+  BENCH_Report(Name, (size_t)SCAN_ROUNDS * SCAN_LIST_SIZE, BENCH_Now() - Start);
+
+  Start = BENCH_Now();
+  for (int r = 0; r < SCAN_ROUNDS; r++)
+  {
+    ULIST_RemoveSpecific(&UList, &Data);
+  }
+  snprintf(Name, sizeof(Name), "RemoveSpecific(miss)/ulist/N=%d", SCAN_LIST_SIZE);
+  BENCH_Report(Name, (size_t)SCAN_ROUNDS * SCAN_LIST_SIZE, BENCH_Now() - Start);
+
+  printf("\n");
+
+  SLIST_Destroy(&SList);
+  ULIST_Destroy(&UList);
+}
+
+
+/* > Local Function Definitions ***********************************************/
+
+static void
+CountPrint(const void* const Data_p)
+{
+  (void)Data_p;
+  Visited++;
+}
+
+static int
+NeverEqual(const void* const Data1_p, const void* const Data2_p)
+{
+  return (Data1_p == Data2_p) ? 1 : -1;
+}
@@ -0,0 +1,26 @@
+#ifndef ULIST_BENCH_H
+#define ULIST_BENCH_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_ULIST_Benchmarks(void);
+
+
+#endif // ULIST_BENCH_H
@@ -0,0 +1,26 @@
+#ifndef ULIST_TEST_H
+#define ULIST_TEST_H
+
+/* > Includes *****************************************************************/
+
+
+/* > Defines ******************************************************************/
+
+
+/* > Type Declarations ********************************************************/
+
+
+/* > Constant Declarations ****************************************************/
+
+
+/* > Variable Declarations ****************************************************/
+
+
+/* > Function Declarations ****************************************************/
+
+
+void
+Run_ULIST_Tests(void);
+
+
+#endif // ULIST_TEST_H